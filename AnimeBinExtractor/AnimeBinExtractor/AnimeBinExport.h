@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <fbxsdk.h>
+
+// ==========================================================
+// ִϸ̼ :    ( ⿡ )
+// - scene ConvertSceneToExportSpace  
+// -   δ outOutputs ߰ (ͽƮ ĳ Ͽ)
+// - EXPORT_ALL_ANIM_STACKS AnimStack ABIN ϳ (<name>_<>.bin)
+// - BAKE_CROWD_PALETTE ABIN  ũ  (<ABIN ̸>_crowd.bin, Common/AbinBakeFormat.h)
+// ==========================================================
+
+namespace AnimeBin
+{
+    //   + EXPORT_SCALE / MIRROR_X / EXPORT_ROT / EXPORT_SKELETON_ONLY /   / Ŀ  / Ű  / ABIN v2 (ä и) / ABIN v3 / ̷  /  ũ
+    uint64_t ComputeExportSettingsHash();
+
+    // skipIfEmpty: AnimStack    ʰ  ó
+    bool ExportAnimationScene(
+        FbxScene* scene,
+        const std::string& name,
+        const std::string& exportDir,
+        bool skipIfEmpty,
+        std::vector<std::string>& outOutputs);
+}
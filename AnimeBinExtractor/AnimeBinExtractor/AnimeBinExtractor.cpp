@@ -4,14 +4,33 @@
 #include <vector>
 #include <unordered_map>
 #include <set>
+#include <map>
+#include <array>
 #include <fstream>
 #include <cstdint>
 #include <algorithm>
 #include <filesystem>
 #include <functional>
 #include <cfloat>   // FLT_MAX
+#include <cmath>
+#include <cstring>
+
+#include "../../Common/AbinBakeFormat.h"
+#include "../../Common/AbinFormat.h"
+#include "../../Common/BatchExport.h"
+#include "../../Common/BinaryWriter.h"
+#include "../../Common/ExportCache.h"
+#include "../../Common/FbxCurveEvaluator.h"
+#include "../../Common/FbxSceneImport.h"
+#include "../../Common/MbinSkeleton.h"
+#include "../../Common/ParallelFor.h"
+#include "AnimeBinExport.h"
 
 using namespace std;
+
+namespace AnimeBin
+{
+
 static constexpr float EXPORT_SCALE_F = 0.01f;
 static constexpr bool MIRROR_X_EXPORT = true; //    ɼ
 
@@ -70,21 +89,272 @@ static FbxAMatrix BuildExportRotation()
 // =========================================================
 #define EXPORT_SKELETON_ONLY 0
 
+// =========================================================
+// Ű  ( ѵ ȿ  Ǵ Ű )
+// - Ÿ  : ̵/ lerp, ȸ slerp
+// - Ű ϳ T/R/S  Ƿ  ä  ѵ   
+// -  ׻  Ű  (  ), Ŭ   α׷
+// -   ABIN v2  Ʈ   
+// =========================================================
+static constexpr bool REDUCE_KEYFRAMES = false;
+static constexpr float kReduceTranslationTolerance = 1e-4f;   // m (EXPORT_SCALE_F  )
+static constexpr float kReduceRotationToleranceDeg = 0.05f;   // 
+static constexpr float kReduceScaleTolerance = 1e-4f;         // к 밪
+
+// =========================================================
+// ABIN v2 ȭ Ŭ (Common/AbinFormat.h). false v1 ״
+// - ȸ 48Ʈ smallest-three, ̵/ Ʈ   16Ʈ, ð 16Ʈ  ȣ
+// -  ȣ uint16 Ѱų,  ӷƮ  Ű(60/120Hz ĸ,  Ű)
+//     ȣ ġ Ŭ v1 
+// =========================================================
+static constexpr bool WRITE_ABIN_V2 = false;
+static constexpr double kDefaultFrameRate = 30.0;  //  Ÿ 带   
+
+// =========================================================
+// T/R/S äκ Ű (WRITE_ABIN_V2 , ABIN_CLIP_SPLIT_CHANNELS)
+// - äθ ڱ Ŀ(x/y/z) Ű ð  -> ȸ Ű   ̵/ Ű ״
+// - Ű ҵ äκ (ٸ ä   Ű  )
+// -   迭 Ŭ ð ̺   ΰ ä ȣ 
+// - ȸ/ ǹ ִ   ̵ R/S Ű ٲǷ ̵ äο R/S Ű ð ִ´
+// =========================================================
+static constexpr bool SPLIT_TRACK_CHANNELS = false;
+
+// =========================================================
+//  Ʈ  켱 Ŭ (ABIN v3, ߿). Ѹ v1/v2  ̰͸ 
+// - Ű  kUniformSampleRate EvaluateLocalTransform  (T   )
+// - Ӹ ü  R -> T -> S (float4) -> Ÿ  ȣ  +   lerp (AbinFormat.h)
+// - Ű /ä и    (Ű )
+// =========================================================
+static constexpr bool WRITE_ABIN_UNIFORM = false;
+static constexpr double kUniformSampleRate = 30.0;   // 30 / 60
+
+// =========================================================
+// Ʈ Ų MBIN ̷濡  (Common/MbinSkeleton.h)
+// - kSkeletonModelBinPath   boneIndex  + Ʈ  + skeletonHash
+//   (Ÿ ؽ ϳ ϰ ̸  )
+// - ؽô v2/v3  Ƿ WRITE_ABIN_V2 Ǵ WRITE_ABIN_UNIFORM ʿ
+//   v2 v1 ü Ǵ Ŭ boneIndex -1 (̸ )
+// - ̷濡  (/Ʈ  ) Ʈ   
+// - ̷ 뵵 ĳ Ű  (װ ٲ ü )
+// =========================================================
+static constexpr bool BIND_TRACKS_TO_SKELETON = false;
+static constexpr const char* kSkeletonModelBinPath = "export/skeleton.bin"; // SkinnedModelBinExtractor  (v3/v6/v7)
+static_assert(!BIND_TRACKS_TO_SKELETON || WRITE_ABIN_V2 || WRITE_ABIN_UNIFORM,
+    "BIND_TRACKS_TO_SKELETON needs a clip format with a skeleton hash (WRITE_ABIN_V2 or WRITE_ABIN_UNIFORM)");
+
+// =========================================================
+// FBX ϳ  AnimStack(ũ)   (Ʈ/ConvertScene  )
+// - false:  ( 0) ϳ ≮>.bin
+// - true : ø ≮>_< ̸>.bin ( ϳ ≮>.bin ״)
+//   Ͽ   ڴ '_', ̸ ġ ڿ _<ȣ>
+// =========================================================
+static constexpr bool EXPORT_ALL_ANIM_STACKS = false;
+
+// =========================================================
+// Ŀ   (Common/FbxCurveEvaluator.h, EvaluateLocalTransform )
+// - 帶 T/R/S Ŀ Ű + ǹ/ȸ    ϰ,   Ŀ 忡 
+//   (SDK 򰡱 ĳø /ð  ʰ, FbxAMatrix /ص )
+// - ̾  ̻  SDK  ״ (̾  )
+// - ͼ  CurveEvalCheck ( / SDK , ѵ Ʒ )
+// - VERIFY_NATIVE_CURVE_EVAL:   kNativeEvalVerifyStride ø ϳ(+ ) SDK  α,
+//   ѵ Ѵ   SDK ٽ  (Ѹ ׸ŭ SDK ȣ þ)
+// =========================================================
+static constexpr bool NATIVE_CURVE_EVAL = false;
+static constexpr bool VERIFY_NATIVE_CURVE_EVAL = false;
+static constexpr size_t kNativeEvalVerifyStride = 16;
+static constexpr float kNativeEvalTranslationTolerance = 1e-5f;  // m (EXPORT_SCALE_F  )
+static constexpr float kNativeEvalRotationToleranceDeg = 0.01f;
+static constexpr float kNativeEvalScaleTolerance = 1e-5f;
+
+// =========================================================
+//  ũ (Common/AbinBakeFormat.h): Ŭ <ABIN ̸>_crowd.bin ߰
+// - kSkeletonModelBinPath ̷ ü  Ű (3x4) kUniformSampleRate Ӹ ̸ 
+//   Ʈ  ̸ Ī, Ʈ   bindLocal 
+// - BAKE_CROWD_HALF: ؼ fp16 (ũ , ̵ е ū  mm  )
+// - BAKE_CROWD_VERTICES: kCrowdMeshModelBinPath  LOD ޽ø Ӹ Ű ġ/ֱ
+//   ( ̷ v7 Ų MBIN, float . ȭ/  ٽ  )
+// - ̷ ε  / ޽ 뵵 ĳ Ű 
+// =========================================================
+static constexpr bool BAKE_CROWD_PALETTE = false;
+static constexpr bool BAKE_CROWD_HALF = false;
+static constexpr bool BAKE_CROWD_VERTICES = false;
+static constexpr const char* kCrowdMeshModelBinPath = "export/crowd_lod.bin"; // SkinnedModelBinExtractor  (v7)
+
+// =========================================================
+//  ͽƮ ĳ
+// - (ABIN) ޶  ϸ kExportToolVersion ø 
+// -  ü : export/.exportcache_anime 
+// =========================================================
+static constexpr uint32_t kExportToolVersion = 4;
+
+// =========================================================
+// ̷ (BIND_TRACKS_TO_SKELETON / BAKE_CROWD_PALETTE)
+// =========================================================
+
+struct ExportSkeleton
+{
+    bool loaded = false;
+    std::string error;
+    std::vector<MbinSkeletonBone> bones;
+    std::unordered_map<std::string, int32_t> nameToBone;
+    uint64_t hash = 0;
+    uint64_t bindHash = 0;   // bindLocal / offsetMatrix ( ũ ĳ Ű)
+};
+
+// ġ Ŀ  Ƿ ó   д´
+static const ExportSkeleton& GetExportSkeleton()
+{
+    static const ExportSkeleton skeleton = []
+        {
+            ExportSkeleton s;
+            s.loaded = LoadMbinSkeleton(kSkeletonModelBinPath, s.bones, &s.error);
+            if (s.loaded)
+            {
+                s.hash = ComputeMbinSkeletonHash(s.bones);
+                ExportHasher bind;
+                for (size_t i = 0; i < s.bones.size(); ++i)
+                {
+                    s.nameToBone.emplace(s.bones[i].name, (int32_t)i);
+                    bind.Update(s.bones[i].bindLocal, sizeof(s.bones[i].bindLocal));
+                    bind.Update(s.bones[i].offsetMatrix, sizeof(s.bones[i].offsetMatrix));
+                }
+                s.bindHash = bind.Finish();
+            }
+            return s;
+        }();
+    return skeleton;
+}
+
+// SkinnedModelBinExtractor Vertex  ġ (v7 float )
+struct CrowdBakeVertex
+{
+    float position[3];
+    float normal[3];
+    float uv[2];
+    float tangent[4];
+    uint32_t boneIndices[4];
+    float boneWeights[4];
+};
+static_assert(sizeof(CrowdBakeVertex) == 80, "CrowdBakeVertex must match the skinned MBIN float vertex");
+
+struct CrowdBakeMesh
+{
+    bool loaded = false;
+    std::string error;
+    std::vector<CrowdBakeVertex> vertices;   // ޽  ̾ 
+    uint64_t skeletonHash = 0;
+    uint64_t contentHash = 0;
+};
+
+// BAKE_CROWD_VERTICES:  LOD ޽õ ó   д´
+static const CrowdBakeMesh& GetCrowdBakeMesh()
+{
+    static const CrowdBakeMesh mesh = []
+        {
+            CrowdBakeMesh m;
+            std::vector<MbinSkeletonBone> bones;
+            if (!LoadMbinSkeleton(kCrowdMeshModelBinPath, bones, &m.error))
+                return m;
+            m.skeletonHash = ComputeMbinSkeletonHash(bones);
+
+            MbinFile file;
+            if (!file.Open(kCrowdMeshModelBinPath, &m.error))
+                return m;
+
+            const MbinView& view = file.View();
+            if (view.Flags() & (MBIN_FLAG_QUANTIZED_VERTEX | MBIN_FLAG_COMPRESSED_STREAMS))
+            {
+                m.error = "ȭ/     (float  ٽ )";
+                return m;
+            }
+
+            ExportHasher content;
+            for (uint32_t i = 0; i < view.SubMeshCount(); ++i)
+            {
+                const MbinSubMeshRecord& sm = view.SubMeshes()[i];
+                if (sm.vertexStride != sizeof(CrowdBakeVertex))
+                {
+                    m.error = " ũⰡ 80Ʈ ƴ";
+                    m.vertices.clear();
+                    return m;
+                }
+                const CrowdBakeVertex* v = static_cast<const CrowdBakeVertex*>(view.VertexData(sm));
+                m.vertices.insert(m.vertices.end(), v, v + sm.vertexCount);
+                content.Update(v, size_t(sm.vertexCount) * sizeof(CrowdBakeVertex));
+            }
+            m.contentHash = content.Finish();
+            m.loaded = true;
+            return m;
+        }();
+    return mesh;
+}
+
+uint64_t ComputeExportSettingsHash()
+{
+    ExportHasher h;
+    h.AddString("AnimeBinExtractor");
+    h.AddU32(kExportToolVersion);
+    h.AddFloat(EXPORT_SCALE_F);
+    h.AddBool(MIRROR_X_EXPORT);
+    h.AddDouble(EXPORT_ROT_X_DEG);
+    h.AddDouble(EXPORT_ROT_Y_DEG);
+    h.AddDouble(EXPORT_ROT_Z_DEG);
+    h.AddU32(EXPORT_SKELETON_ONLY);
+    h.AddBool(EXPORT_ALL_ANIM_STACKS);
+    h.AddBool(NATIVE_CURVE_EVAL);
+    if (NATIVE_CURVE_EVAL)
+    {
+        h.AddBool(VERIFY_NATIVE_CURVE_EVAL);
+        h.AddU32(static_cast<uint32_t>(kNativeEvalVerifyStride));
+        h.AddFloat(kNativeEvalTranslationTolerance);
+        h.AddFloat(kNativeEvalRotationToleranceDeg);
+        h.AddFloat(kNativeEvalScaleTolerance);
+    }
+    h.AddBool(REDUCE_KEYFRAMES);
+    h.AddFloat(kReduceTranslationTolerance);
+    h.AddFloat(kReduceRotationToleranceDeg);
+    h.AddFloat(kReduceScaleTolerance);
+    h.AddBool(WRITE_ABIN_V2);
+    h.AddDouble(kDefaultFrameRate);
+    h.AddBool(SPLIT_TRACK_CHANNELS);
+    h.AddBool(WRITE_ABIN_UNIFORM);
+    h.AddDouble(kUniformSampleRate);
+    h.AddBool(BIND_TRACKS_TO_SKELETON);
+    h.AddBool(BAKE_CROWD_PALETTE);
+    if (BIND_TRACKS_TO_SKELETON || BAKE_CROWD_PALETTE)
+    {
+        h.AddString(kSkeletonModelBinPath);
+        h.AddU64(GetExportSkeleton().hash);
+    }
+    if (BAKE_CROWD_PALETTE)
+    {
+        h.AddU64(GetExportSkeleton().bindHash);
+        h.AddBool(BAKE_CROWD_HALF);
+        h.AddBool(BAKE_CROWD_VERTICES);
+        if (BAKE_CROWD_VERTICES)
+        {
+            h.AddString(kCrowdMeshModelBinPath);
+            h.AddU64(GetCrowdBakeMesh().contentHash);
+        }
+    }
+    return h.Finish();
+}
+
 // ======================================================================
 // BIN  
 // ======================================================================
 
-static void WriteRaw(ofstream& out, const void* data, size_t size)
+static void WriteRaw(BinaryWriter& out, const void* data, size_t size)
 {
-    out.write(reinterpret_cast<const char*>(data), size);
+    out.WriteRaw(data, size);
 }
 
-static void WriteUInt16(ofstream& out, uint16_t v) { WriteRaw(out, &v, sizeof(v)); }
-static void WriteUInt32(ofstream& out, uint32_t v) { WriteRaw(out, &v, sizeof(v)); }
-static void WriteInt32(ofstream& out, int32_t  v) { WriteRaw(out, &v, sizeof(v)); }
-static void WriteFloat(ofstream& out, float    f) { WriteRaw(out, &f, sizeof(f)); }
+static void WriteUInt16(BinaryWriter& out, uint16_t v) { WriteRaw(out, &v, sizeof(v)); }
+static void WriteUInt32(BinaryWriter& out, uint32_t v) { WriteRaw(out, &v, sizeof(v)); }
+static void WriteInt32(BinaryWriter& out, int32_t  v) { WriteRaw(out, &v, sizeof(v)); }
+static void WriteFloat(BinaryWriter& out, float    f) { WriteRaw(out, &f, sizeof(f)); }
 
-static void WriteStringUtf8(ofstream& out, const std::string& s)
+static void WriteStringUtf8(BinaryWriter& out, const std::string& s)
 {
     uint16_t len = static_cast<uint16_t>(s.size());
     WriteUInt16(out, len);
@@ -103,7 +373,7 @@ static const char* SafeNameStack(FbxAnimStack* s)
 
 static void PrintVec3(const char* tag, const FbxVector4& v)
 {
-    cout << tag << "=("
+    BatchLog() << tag << "=("
         << (double)v[0] << ","
         << (double)v[1] << ","
         << (double)v[2] << ")\n";
@@ -111,7 +381,7 @@ static void PrintVec3(const char* tag, const FbxVector4& v)
 
 static void PrintQuat(const char* tag, const FbxQuaternion& q)
 {
-    cout << tag << "=("
+    BatchLog() << tag << "=("
         << (double)q[0] << ","
         << (double)q[1] << ","
         << (double)q[2] << ","
@@ -141,10 +411,25 @@ struct KeyframeBin
     float sx, sy, sz;
 };
 
+enum KeyChannel
+{
+    KEY_CHANNEL_T = 0,
+    KEY_CHANNEL_R,
+    KEY_CHANNEL_S,
+    KEY_CHANNEL_COUNT,
+};
+
+static constexpr uint32_t kAllKeyChannels = (1u << KEY_CHANNEL_COUNT) - 1;
+
 struct TrackBin
 {
     std::string boneName;
-    std::vector<KeyframeBin> keys;
+    FbxNode* node = nullptr;  // ó ã  (WRITE_ABIN_UNIFORM ÿ)
+    int32_t boneIndex = -1;   // ̷  ȣ (BIND_TRACKS_TO_SKELETON), ƴϸ -1
+    std::vector<KeyframeBin> keys;   //  ä Ű ð  (v1 / ģ v2)
+
+    // SPLIT_TRACK_CHANNELS: äκ Ű (KeyframeBin TRS   ڱ ä  )
+    std::vector<KeyframeBin> channelKeys[KEY_CHANNEL_COUNT];
 };
 
 // ======================================================================
@@ -158,46 +443,135 @@ static bool IsSkeletonNode(FbxNode* node)
     return (attr && attr->GetAttributeType() == FbxNodeAttribute::eSkeleton);
 }
 
+// ȸ/ ǹ  EvaluateLocalTransform ̵ п R/S δ
+// (ȸ  θ  )
+static bool TranslationDependsOnRotationScale(FbxNode* node)
+{
+    auto nonZero = [](const FbxVector4& v) { return v[0] != 0.0 || v[1] != 0.0 || v[2] != 0.0; };
+    return nonZero(node->GetRotationPivot(FbxNode::eSourcePivot))
+        || nonZero(node->GetScalingPivot(FbxNode::eSourcePivot))
+        || nonZero(node->GetScalingOffset(FbxNode::eSourcePivot));
+}
+
 // ======================================================================
-// FBX Ű Ÿ : node T/R/S Ŀ꿡  Ű ð outTimes ִ´
+// FBX Ű Ÿ : node T/R/S Ŀ Ű ð äκ outChannelTimes ִ´
 // ======================================================================
 
-static void CollectKeyTimes(FbxNode* node, FbxAnimLayer* layer, std::set<FbxTime>& outTimes)
+static void CollectKeyTimes(FbxNode* node, FbxAnimLayer* layer, std::set<FbxTime> outChannelTimes[KEY_CHANNEL_COUNT])
 {
     if (!node || !layer) return;
 
-    auto addCurve = [&](FbxAnimCurve* curve)
+    auto addCurve = [&](FbxAnimCurve* curve, KeyChannel channel)
         {
             if (!curve) return;
             int keyCount = curve->KeyGetCount();
             for (int i = 0; i < keyCount; ++i)
-                outTimes.insert(curve->KeyGetTime(i));
+                outChannelTimes[channel].insert(curve->KeyGetTime(i));
         };
 
-    addCurve(node->LclTranslation.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_X));
-    addCurve(node->LclTranslation.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_Y));
-    addCurve(node->LclTranslation.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_Z));
+    addCurve(node->LclTranslation.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_X), KEY_CHANNEL_T);
+    addCurve(node->LclTranslation.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_Y), KEY_CHANNEL_T);
+    addCurve(node->LclTranslation.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_Z), KEY_CHANNEL_T);
+
+    addCurve(node->LclRotation.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_X), KEY_CHANNEL_R);
+    addCurve(node->LclRotation.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_Y), KEY_CHANNEL_R);
+    addCurve(node->LclRotation.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_Z), KEY_CHANNEL_R);
+
+    addCurve(node->LclScaling.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_X), KEY_CHANNEL_S);
+    addCurve(node->LclScaling.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_Y), KEY_CHANNEL_S);
+    addCurve(node->LclScaling.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_Z), KEY_CHANNEL_S);
+
+    if (TranslationDependsOnRotationScale(node))
+    {
+        outChannelTimes[KEY_CHANNEL_T].insert(outChannelTimes[KEY_CHANNEL_R].begin(), outChannelTimes[KEY_CHANNEL_R].end());
+        outChannelTimes[KEY_CHANNEL_T].insert(outChannelTimes[KEY_CHANNEL_S].begin(), outChannelTimes[KEY_CHANNEL_S].end());
+    }
+}
+
+static bool KeyTimeLess(const KeyframeBin& a, const KeyframeBin& b)
+{
+    return a.timeSec < b.timeSec;
+}
+
+// ä ù Ű Ʈ ù Ű  (Ŀ  / T ŷ  Ű ) Ʈ ù Ű տ ִ´
+// -> Ÿ ù Ű Ŭص ģ Ű  .  Ŀ굵  Ű  ϹǷ ״
+static void AlignChannelKeyStart(TrackBin& track)
+{
+    if (track.keys.empty()) return;
+    for (std::vector<KeyframeBin>& ck : track.channelKeys)
+    {
+        if (ck.empty() || ck.front().timeSec > track.keys.front().timeSec)
+            ck.insert(ck.begin(), track.keys.front());
+    }
+}
+
+// ======================================================================
+// t  TRS (DirectX + meter ȯ  ), timeSec  ð
+// ======================================================================
+
+static KeyframeBin EvaluateExportKey(FbxNode* node, const FbxTime& t, float timeSec)
+{
+    FbxAMatrix fbxLocal = node->EvaluateLocalTransform(t);
+
+    static FbxAMatrix BasisRot = BuildExportRotation();
+    static FbxAMatrix BasisRotInv = BasisRot.Inverse();
+    fbxLocal = BasisRot * fbxLocal * BasisRotInv;
+
+    if (MIRROR_X_EXPORT)
+    {
+        static FbxAMatrix MirrorX = MakeMirrorX();
+        fbxLocal = MirrorX * fbxLocal * MirrorX;   //     ׺ȯ
+    }
 
-    addCurve(node->LclRotation.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_X));
-    addCurve(node->LclRotation.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_Y));
-    addCurve(node->LclRotation.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_Z));
+    FbxVector4 T = fbxLocal.GetT();
+    FbxQuaternion Q = fbxLocal.GetQ();
+    FbxVector4 Scale = fbxLocal.GetS();
 
-    addCurve(node->LclScaling.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_X));
-    addCurve(node->LclScaling.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_Y));
-    addCurve(node->LclScaling.GetCurve(layer, FBXSDK_CURVENODE_COMPONENT_Z));
+    // quaternion ȭ(ġ )
+    Q.Normalize();
+
+    KeyframeBin k{};
+    k.timeSec = timeSec;
+
+    // [߿] Ź   : ߰ 0.01  
+    k.tx = (float)T[0] * EXPORT_SCALE_F;
+    k.ty = (float)T[1] * EXPORT_SCALE_F;
+    k.tz = (float)T[2] * EXPORT_SCALE_F;
+
+    k.rx = (float)Q[0];
+    k.ry = (float)Q[1];
+    k.rz = (float)Q[2];
+    k.rw = (float)Q[3];
+
+    k.sx = (float)Scale[0];
+    k.sy = (float)Scale[1];
+    k.sz = (float)Scale[2];
+    return k;
 }
 
+//  ϳ  ð ϴ ۾ (򰡴 EvaluateSampleJobs Ѳ)
+struct NodeSampleJob
+{
+    FbxNode* node = nullptr;
+    int trackIndex = -1;
+    std::vector<FbxTime> times;
+    std::vector<float> timeSecs;          //  ð
+    std::vector<uint8_t> channelMasks;    // 1 << KeyChannel ( ð Ű ä, SPLIT_TRACK_CHANNELS)
+    std::vector<KeyframeBin> keys;        //  
+};
+
 // ======================================================================
-//  ȸϸ鼭  (= ̸)  TrackBin ä
+//  ȸϸ鼭  (= ̸)  TrackBin  Ű ð jobs 
 // ======================================================================
 
 static void TraverseAndExtractTracks(
     FbxNode* node,
-    FbxAnimLayer* layer,
+    const std::vector<FbxAnimLayer*>& layers,
     const FbxTimeSpan& timeSpan,
     float timeScale,
     std::vector<TrackBin>& tracks,
-    std::unordered_map<std::string, int>& nameToTrack)
+    std::unordered_map<std::string, int>& nameToTrack,
+    std::vector<NodeSampleJob>& jobs)
 {
     if (!node) return;
 
@@ -211,11 +585,12 @@ static void TraverseAndExtractTracks(
             {
                 TraverseAndExtractTracks(
                     node->GetChild(i),
-                    layer,
+                    layers,
                     timeSpan,
                     timeScale,
                     tracks,
-                    nameToTrack);
+                    nameToTrack,
+                    jobs);
             }
         };
 
@@ -227,9 +602,14 @@ static void TraverseAndExtractTracks(
     }
 #endif
 
-    //  忡 Ű ִ Ȯ
+    //  忡 Ű ִ Ȯ (̾ ,  EvaluateLocalTransform ̾  )
+    std::set<FbxTime> channelTimes[KEY_CHANNEL_COUNT];
+    for (FbxAnimLayer* layer : layers)
+        CollectKeyTimes(node, layer, channelTimes);
+
     std::set<FbxTime> keyTimes;
-    CollectKeyTimes(node, layer, keyTimes);
+    for (const std::set<FbxTime>& times : channelTimes)
+        keyTimes.insert(times.begin(), times.end());
 
     if (!keyTimes.empty())
     {
@@ -243,6 +623,7 @@ static void TraverseAndExtractTracks(
             trackIndex = (int)tracks.size();
             TrackBin tb;
             tb.boneName = nodeName;
+            tb.node = node;
             tracks.push_back(tb);
             nameToTrack[nodeName] = trackIndex;
         }
@@ -251,7 +632,9 @@ static void TraverseAndExtractTracks(
             trackIndex = it->second;
         }
 
-        TrackBin& track = tracks[trackIndex];
+        NodeSampleJob job;
+        job.node = node;
+        job.trackIndex = trackIndex;
 
         const double startSec = timeSpan.GetStart().GetSecondDouble();
 
@@ -260,178 +643,1175 @@ static void TraverseAndExtractTracks(
             if (t < timeSpan.GetStart() || t > timeSpan.GetStop())
                 continue;
 
-            //  TRS (DirectX + meter ȯ  )
-            FbxAMatrix fbxLocal = node->EvaluateLocalTransform(t);
+            uint8_t mask = 0;
+            for (int c = 0; c < KEY_CHANNEL_COUNT; ++c)
+                if (channelTimes[c].count(t)) mask |= (uint8_t)(1u << c);
 
-            static FbxAMatrix BasisRot = BuildExportRotation();
-            static FbxAMatrix BasisRotInv = BasisRot.Inverse();
-            fbxLocal = BasisRot * fbxLocal * BasisRotInv;
+            job.times.push_back(t);
+            job.timeSecs.push_back((float)((t.GetSecondDouble() - startSec) * timeScale));
+            job.channelMasks.push_back(mask);
+        }
 
-            if (MIRROR_X_EXPORT)
-            {
-                static FbxAMatrix MirrorX = MakeMirrorX();
-                fbxLocal = MirrorX * fbxLocal * MirrorX;   //     ׺ȯ
-            }
+        jobs.push_back(std::move(job));
+    }
 
-            FbxVector4 T = fbxLocal.GetT();
-            FbxQuaternion Q = fbxLocal.GetQ();
-            FbxVector4 Scale = fbxLocal.GetS();
+    TraverseChildren();
+}
 
-            // quaternion ȭ(ġ )
-            Q.Normalize();
+// ======================================================================
+// Ű  (REDUCE_KEYFRAMES)
+// ======================================================================
 
-            KeyframeBin k{};
-            k.timeSec = (float)((t.GetSecondDouble() - startSec) * timeScale);
+struct KeyReductionStats
+{
+    size_t sourceKeys = 0;
+    size_t keptKeys = 0;
+    float maxTranslationError = 0.0f;
+    float maxRotationErrorDeg = 0.0f;
+    float maxScaleError = 0.0f;
+};
 
-            // [߿] Ź   : ߰ 0.01  
-            k.tx = (float)T[0] * EXPORT_SCALE_F;
-            k.ty = (float)T[1] * EXPORT_SCALE_F;
-            k.tz = (float)T[2] * EXPORT_SCALE_F;
+static constexpr float kRadToDeg = 57.29577951308232f;
 
-            k.rx = (float)Q[0];
-            k.ry = (float)Q[1];
-            k.rz = (float)Q[2];
-            k.rw = (float)Q[3];
+//  ȸ   (, q -q  ȸ)
+// acos(dot) 1 ó float е 0.04  鸮Ƿ 4 * atan2(|a - b|, |a + b|) double
+static float QuatAngleDeg(const float a[4], const float b[4])
+{
+    const double dot = double(a[0]) * b[0] + double(a[1]) * b[1] + double(a[2]) * b[2] + double(a[3]) * b[3];
+    const double sign = (dot < 0.0) ? -1.0 : 1.0;
 
-            k.sx = (float)Scale[0];
-            k.sy = (float)Scale[1];
-            k.sz = (float)Scale[2];
+    double diff = 0.0, sum = 0.0;
+    for (int i = 0; i < 4; ++i)
+    {
+        const double d = double(a[i]) - sign * b[i];
+        const double s = double(a[i]) + sign * b[i];
+        diff += d * d;
+        sum += s * s;
+    }
+    return (float)(4.0 * atan2(sqrt(diff), sqrt(sum)) * kRadToDeg);
+}
 
-            track.keys.push_back(k);
-        }
+// ִ  slerp (ŸӰ  :   ̸ nlerp)
+static void SlerpRotation(const KeyframeBin& a, const KeyframeBin& b, float u, float out[4])
+{
+    float bx = b.rx, by = b.ry, bz = b.rz, bw = b.rw;
+    float d = a.rx * bx + a.ry * by + a.rz * bz + a.rw * bw;
+    if (d < 0.0f) { bx = -bx; by = -by; bz = -bz; bw = -bw; d = -d; }
 
-        // ð 
-        std::sort(track.keys.begin(), track.keys.end(),
-            [](const KeyframeBin& a, const KeyframeBin& b)
-            {
-                return a.timeSec < b.timeSec;
-            });
+    float wa = 1.0f - u, wb = u;
+    if (d < 0.9995f)
+    {
+        const float theta = acosf(d);
+        const float sinTheta = sinf(theta);
+        wa = sinf(wa * theta) / sinTheta;
+        wb = sinf(wb * theta) / sinTheta;
     }
 
-    TraverseChildren();
+    out[0] = wa * a.rx + wb * bx;
+    out[1] = wa * a.ry + wb * by;
+    out[2] = wa * a.rz + wb * bz;
+    out[3] = wa * a.rw + wb * bw;
+
+    const float len = sqrtf(out[0] * out[0] + out[1] * out[1] + out[2] * out[2] + out[3] * out[3]);
+    if (len > 0.0f)
+        for (int i = 0; i < 4; ++i) out[i] /= len;
 }
 
-static void DumpAnimExtractorDebug(
-    const char* phaseTag,
-    FbxScene* scene,
-    FbxAnimStack* stack,
-    FbxAnimLayer* layer,
-    const FbxTimeSpan& span,
-    const vector<TrackBin>* tracks,                       //  nullptr
-    const unordered_map<string, int>* nameToTrack,         //  nullptr
-    const vector<string>& probeBones,                     //  (: Hips/Hands)
-    float timeScale)
+// a~b  k   äκ 
+static void MeasureInterpolationError(
+    const KeyframeBin& a,
+    const KeyframeBin& b,
+    const KeyframeBin& k,
+    float& outTranslation,
+    float& outRotationDeg,
+    float& outScale)
 {
-    cout << "\n==================== [AnimDump] " << phaseTag << " ====================\n";
+    const float span = b.timeSec - a.timeSec;
+    const float u = (span > 0.0f) ? (k.timeSec - a.timeSec) / span : 0.0f;
+
+    const float dx = a.tx + (b.tx - a.tx) * u - k.tx;
+    const float dy = a.ty + (b.ty - a.ty) * u - k.ty;
+    const float dz = a.tz + (b.tz - a.tz) * u - k.tz;
+    outTranslation = sqrtf(dx * dx + dy * dy + dz * dz);
+
+    float q[4];
+    SlerpRotation(a, b, u, q);
+    const float kq[4] = { k.rx, k.ry, k.rz, k.rw };
+    outRotationDeg = QuatAngleDeg(q, kq);
+
+    outScale = std::max({
+        fabsf(a.sx + (b.sx - a.sx) * u - k.sx),
+        fabsf(a.sy + (b.sy - a.sy) * u - k.sy),
+        fabsf(a.sz + (b.sz - a.sz) * u - k.sz) });
+}
 
-    // ---- Scene / Stack / Span
-    cout << "[Scene] root=" << SafeName(scene ? scene->GetRootNode() : nullptr) << "\n";
-    cout << "[Stack] name=" << SafeNameStack(stack) << " layer=" << (layer ? "ok" : "null") << "\n";
+// ä ũ(1 << KeyChannel)  ä  0
+static void MaskInterpolationError(uint32_t channels, float& t, float& r, float& s)
+{
+    if (!(channels & (1u << KEY_CHANNEL_T))) t = 0.0f;
+    if (!(channels & (1u << KEY_CHANNEL_R))) r = 0.0f;
+    if (!(channels & (1u << KEY_CHANNEL_S))) s = 0.0f;
+}
 
-    const double s0 = span.GetStart().GetSecondDouble();
-    const double s1 = span.GetStop().GetSecondDouble();
-    cout << "[Span] start=" << s0 << " end=" << s1 << " dur=" << (s1 - s0) << " timeScale=" << timeScale << "\n";
+// keys[first]~keys[last]  Ű   channels ä ѵ 
+static bool KeySegmentFits(const std::vector<KeyframeBin>& keys, size_t first, size_t last, uint32_t channels)
+{
+    for (size_t i = first + 1; i < last; ++i)
+    {
+        float t, r, s;
+        MeasureInterpolationError(keys[first], keys[last], keys[i], t, r, s);
+        MaskInterpolationError(channels, t, r, s);
+        if (t > kReduceTranslationTolerance || r > kReduceRotationToleranceDeg || s > kReduceScaleTolerance)
+            return false;
+    }
+    return true;
+}
 
-    // ---- Skeleton  /̸ 
-    int skelCount = 0;
-    vector<string> skelNames;
-    function<void(FbxNode*)> dfs = [&](FbxNode* n)
-        {
-            if (!n) return;
-            if (IsSkeletonNode(n))
-            {
-                skelCount++;
-                if ((int)skelNames.size() < 20) skelNames.push_back(n->GetName());
-            }
-            for (int i = 0; i < n->GetChildCount(); ++i) dfs(n->GetChild(i));
-        };
-    dfs(scene ? scene->GetRootNode() : nullptr);
+//  Ű   ִ   Ű ã   ( 辿 ÷    ̺ Ž)
+// ׻ ˻縦   Ƿ  ѵ  ʴ´. ù/ Ű ׻ 
+static void ReduceTrackKeys(std::vector<KeyframeBin>& keys, uint32_t channels, KeyReductionStats& stats)
+{
+    stats.sourceKeys += keys.size();
 
-    cout << "[Skeleton] count=" << skelCount << " sample(<=20)=";
-    for (size_t i = 0; i < skelNames.size(); ++i)
+    if (keys.size() > 2)
     {
-        if (i) cout << ", ";
-        cout << skelNames[i];
-    }
-    cout << "\n";
+        const size_t n = keys.size();
+        std::vector<size_t> kept;
+        kept.push_back(0);
 
-    // ----   /۷ι Ư ð  (start/mid/end)
-    auto DumpNodeAt = [&](FbxNode* n, const char* label, const FbxTime& t)
+        size_t anchor = 0;
+        while (anchor < n - 1)
         {
-            if (!n) { cout << "  [" << label << "] node=null\n"; return; }
+            size_t good = anchor + 1;
+            size_t bad = n;
+            for (size_t step = 1; good + step < n; step *= 2)
+            {
+                if (!KeySegmentFits(keys, anchor, good + step, channels))
+                {
+                    bad = good + step;
+                    break;
+                }
+                good += step;
+            }
 
-            FbxAMatrix L = n->EvaluateLocalTransform(t);
+            while (bad - good > 1)
+            {
+                const size_t mid = good + (bad - good) / 2;
+                if (KeySegmentFits(keys, anchor, mid, channels)) good = mid;
+                else bad = mid;
+            }
 
-            static FbxAMatrix BasisRot = BuildExportRotation();
-            static FbxAMatrix BasisRotInv = BasisRot.Inverse();
-            L = BasisRot * L * BasisRotInv;
+            for (size_t i = anchor + 1; i < good; ++i)
+            {
+                float t, r, s;
+                MeasureInterpolationError(keys[anchor], keys[good], keys[i], t, r, s);
+                MaskInterpolationError(channels, t, r, s);
+                stats.maxTranslationError = std::max(stats.maxTranslationError, t);
+                stats.maxRotationErrorDeg = std::max(stats.maxRotationErrorDeg, r);
+                stats.maxScaleError = std::max(stats.maxScaleError, s);
+            }
 
-            if (MIRROR_X_EXPORT) { static FbxAMatrix MirrorX = MakeMirrorX(); L = MirrorX * L * MirrorX; }
+            kept.push_back(good);
+            anchor = good;
+        }
 
-            FbxVector4 T = L.GetT();
-            FbxQuaternion Q = L.GetQ(); Q.Normalize();
-            FbxVector4 S = L.GetS();
+        std::vector<KeyframeBin> reduced;
+        reduced.reserve(kept.size());
+        for (size_t i : kept) reduced.push_back(keys[i]);
+        keys.swap(reduced);
+    }
 
-            cout << "  [" << label << "] " << n->GetName()
-                << " det3=" << Det3x3(L)
-                << " T=(" << (double)T[0] << "," << (double)T[1] << "," << (double)T[2] << ")"
-                << " S=(" << (double)S[0] << "," << (double)S[1] << "," << (double)S[2] << ")"
-                << " Q=(" << (double)Q[0] << "," << (double)Q[1] << "," << (double)Q[2] << "," << (double)Q[3] << ")"
-                << "\n";
-        };
+    stats.keptKeys += keys.size();
+}
 
-    if (scene && scene->GetRootNode())
+// SPLIT_TRACK_CHANNELS äκ ̰   α (ģ Ű v1   δ)
+static void ReduceClipKeys(const std::string& clipName, std::vector<TrackBin>& tracks)
+{
+    KeyReductionStats stats, channelStats;
+    for (TrackBin& tr : tracks)
     {
-        FbxTime tStart = span.GetStart();
-        FbxTime tEnd = span.GetStop();
-        FbxTime tMid;  tMid.SetSecondDouble((s0 + s1) * 0.5);
+        ReduceTrackKeys(tr.keys, kAllKeyChannels, stats);
+        if (SPLIT_TRACK_CHANNELS)
+        {
+            for (int c = 0; c < KEY_CHANNEL_COUNT; ++c)
+                ReduceTrackKeys(tr.channelKeys[c], 1u << c, channelStats);
+        }
+    }
+    if (SPLIT_TRACK_CHANNELS)
+        stats = channelStats;
 
-        cout << "[ProbeBones] (local after mirror-conjugation)\n";
-        for (const string& bn : probeBones)
+    if (stats.sourceKeys == 0) return;
+
+    const double ratio = 100.0 * (double)stats.keptKeys / (double)stats.sourceKeys;
+    BatchLog() << "Ű  [" << clipName << "]: Ʈ " << tracks.size()
+        << (SPLIT_TRACK_CHANNELS ? ", ä Ű " : ", Ű ") << stats.sourceKeys << " -> " << stats.keptKeys << " (" << ratio << "%)"
+        << ", " << stats.sourceKeys * sizeof(KeyframeBin) << " -> " << stats.keptKeys * sizeof(KeyframeBin) << " bytes"
+        << ", ִ  T=" << stats.maxTranslationError << "m R=" << stats.maxRotationErrorDeg
+        << "deg S=" << stats.maxScaleError << "\n";
+}
+
+// ======================================================================
+//   (SDK EvaluateLocalTransform / Ŀ  )
+// ======================================================================
+
+//   -> ͽƮ   (EvaluateExportKey BasisRot / MirrorX  ,   )
+struct ExportConjugation
+{
+    double c[3][3];
+};
+
+static const ExportConjugation& GetExportConjugation()
+{
+    static const ExportConjugation conj = []
         {
-            // ̸  ã( DFS)
-            FbxNode* found = nullptr;
-            function<void(FbxNode*)> findDfs = [&](FbxNode* n)
+            auto axisRotation = [](int axis, double deg, double m[3][3])
                 {
-                    if (!n || found) return;
-                    if (bn == n->GetName()) { found = n; return; }
-                    for (int i = 0; i < n->GetChildCount(); ++i) findDfs(n->GetChild(i));
+                    const double r = deg * 3.14159265358979323846 / 180.0;
+                    const double cs = cos(r), sn = sin(r);
+                    const int a = (axis + 1) % 3, b = (axis + 2) % 3;
+                    for (int i = 0; i < 3; ++i)
+                        for (int j = 0; j < 3; ++j)
+                            m[i][j] = (i == j) ? 1.0 : 0.0;
+                    m[a][a] = cs; m[a][b] = -sn;
+                    m[b][a] = sn; m[b][b] = cs;
+                };
+            auto mul = [](const double a[3][3], const double b[3][3], double out[3][3])
+                {
+                    double r[3][3];
+                    for (int i = 0; i < 3; ++i)
+                        for (int j = 0; j < 3; ++j)
+                            r[i][j] = a[i][0] * b[0][j] + a[i][1] * b[1][j] + a[i][2] * b[2][j];
+                    memcpy(out, r, sizeof(r));
                 };
-            findDfs(scene->GetRootNode());
 
-            DumpNodeAt(found, "Start", tStart);
-            DumpNodeAt(found, "Mid", tMid);
-            DumpNodeAt(found, "End", tEnd);
-        }
-    }
+            // BuildExportRotation: Rz * Ry * Rx
+            double rx[3][3], ry[3][3], rz[3][3];
+            axisRotation(0, EXPORT_ROT_X_DEG, rx);
+            axisRotation(1, EXPORT_ROT_Y_DEG, ry);
+            axisRotation(2, EXPORT_ROT_Z_DEG, rz);
 
-    // ---- Track ()  +   key 
-    if (tracks && nameToTrack)
-    {
-        cout << "[Tracks] count=" << tracks->size() << "\n";
+            ExportConjugation e;
+            mul(rz, ry, e.c);
+            mul(e.c, rx, e.c);
 
-        //  (ּ/ִ)   
-        size_t minK = (size_t)-1, maxK = 0;
-        string minN, maxN;
-        for (auto& tr : *tracks)
+            if (MIRROR_X_EXPORT)
+                for (int j = 0; j < 3; ++j) e.c[0][j] = -e.c[0][j];
+            return e;
+        }();
+    return conj;
+}
+
+//   TRS -> ͽƮ Ű (C * L * C^-1  : ̵ = C t, 3x3 = C R S C^T ->   = )
+static void ConvertNativeSamplesToExportKeys(const FbxLocalTrsSamples& in, const std::vector<float>& timeSecs, std::vector<KeyframeBin>& out)
+{
+    const ExportConjugation& e = GetExportConjugation();
+    const size_t count = timeSecs.size();
+    out.resize(count);
+
+    for (size_t j = 0; j < count; ++j)
+    {
+        const double x = in.q[0][j], y = in.q[1][j], z = in.q[2][j], w = in.q[3][j];
+        const double r[3][3] =
         {
-            size_t k = tr.keys.size();
-            if (k < minK) { minK = k; minN = tr.boneName; }
-            if (k > maxK) { maxK = k; maxN = tr.boneName; }
+            { 1 - 2 * (y * y + z * z), 2 * (x * y - z * w),     2 * (x * z + y * w) },
+            { 2 * (x * y + z * w),     1 - 2 * (x * x + z * z), 2 * (y * z - x * w) },
+            { 2 * (x * z - y * w),     2 * (y * z + x * w),     1 - 2 * (x * x + y * y) },
+        };
+        const double s[3] = { in.s[0][j], in.s[1][j], in.s[2][j] };
+
+        // m = C * R * S * C^T
+        double cr[3][3], m[3][3];
+        for (int a = 0; a < 3; ++a)
+            for (int b = 0; b < 3; ++b)
+                cr[a][b] = (e.c[a][0] * r[0][b] + e.c[a][1] * r[1][b] + e.c[a][2] * r[2][b]) * s[b];
+        for (int a = 0; a < 3; ++a)
+            for (int b = 0; b < 3; ++b)
+                m[a][b] = cr[a][0] * e.c[b][0] + cr[a][1] * e.c[b][1] + cr[a][2] * e.c[b][2];
+
+        double scale[3];
+        for (int b = 0; b < 3; ++b)
+        {
+            scale[b] = sqrt(m[0][b] * m[0][b] + m[1][b] * m[1][b] + m[2][b] * m[2][b]);
+            const double inv = (scale[b] > 0.0) ? 1.0 / scale[b] : 0.0;
+            for (int a = 0; a < 3; ++a) m[a][b] *= inv;
         }
-        cout << "  keysMin=" << minK << " (" << minN << "), keysMax=" << maxK << " (" << maxN << ")\n";
 
-        auto DumpTrackSample = [&](const string& bn)
-            {
-                auto it = nameToTrack->find(bn);
-                if (it == nameToTrack->end()) { cout << "  [TrackSample] " << bn << " : NOT FOUND\n"; return; }
-                const TrackBin& tr = (*tracks)[it->second];
-                cout << "  [TrackSample] " << bn << " keys=" << tr.keys.size() << "\n";
+        // ȸ  -> ʹϾ
+        double q[4];
+        const double trace = m[0][0] + m[1][1] + m[2][2];
+        if (trace > 0.0)
+        {
+            const double k = 0.5 / sqrt(trace + 1.0);
+            q[3] = 0.25 / k;
+            q[0] = (m[2][1] - m[1][2]) * k;
+            q[1] = (m[0][2] - m[2][0]) * k;
+            q[2] = (m[1][0] - m[0][1]) * k;
+        }
+        else if (m[0][0] > m[1][1] && m[0][0] > m[2][2])
+        {
+            const double k = 2.0 * sqrt(1.0 + m[0][0] - m[1][1] - m[2][2]);
+            q[3] = (m[2][1] - m[1][2]) / k;
+            q[0] = 0.25 * k;
+            q[1] = (m[0][1] + m[1][0]) / k;
+            q[2] = (m[0][2] + m[2][0]) / k;
+        }
+        else if (m[1][1] > m[2][2])
+        {
+            const double k = 2.0 * sqrt(1.0 + m[1][1] - m[0][0] - m[2][2]);
+            q[3] = (m[0][2] - m[2][0]) / k;
+            q[0] = (m[0][1] + m[1][0]) / k;
+            q[1] = 0.25 * k;
+            q[2] = (m[1][2] + m[2][1]) / k;
+        }
+        else
+        {
+            const double k = 2.0 * sqrt(1.0 + m[2][2] - m[0][0] - m[1][1]);
+            q[3] = (m[1][0] - m[0][1]) / k;
+            q[0] = (m[0][2] + m[2][0]) / k;
+            q[1] = (m[1][2] + m[2][1]) / k;
+            q[2] = 0.25 * k;
+        }
+        const double qLen = sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+
+        const double t[3] = { in.t[0][j], in.t[1][j], in.t[2][j] };
+
+        KeyframeBin& k = out[j];
+        k.timeSec = timeSecs[j];
+        k.tx = (float)((e.c[0][0] * t[0] + e.c[0][1] * t[1] + e.c[0][2] * t[2]) * EXPORT_SCALE_F);
+        k.ty = (float)((e.c[1][0] * t[0] + e.c[1][1] * t[1] + e.c[1][2] * t[2]) * EXPORT_SCALE_F);
+        k.tz = (float)((e.c[2][0] * t[0] + e.c[2][1] * t[1] + e.c[2][2] * t[2]) * EXPORT_SCALE_F);
+        k.rx = (float)(q[0] / qLen);
+        k.ry = (float)(q[1] / qLen);
+        k.rz = (float)(q[2] / qLen);
+        k.rw = (float)(q[3] / qLen);
+        k.sx = (float)scale[0];
+        k.sy = (float)scale[1];
+        k.sz = (float)scale[2];
+    }
+}
+
+//    Ϻ(kNativeEvalVerifyStride  +  ) SDK 򰡿 ,
+// ѵ Ѵ  ü  SDK ٽ Ѵ
+static void VerifyNativeSampleJobs(const std::string& clipName, std::vector<NodeSampleJob>& jobs)
+{
+    size_t samples = 0, replaced = 0;
+    float maxT = 0.0f, maxR = 0.0f, maxS = 0.0f;
+
+    for (NodeSampleJob& job : jobs)
+    {
+        float jobT = 0.0f, jobR = 0.0f, jobS = 0.0f;
+        const size_t count = job.times.size();
+
+        // 0, stride, 2 * stride, ...,   ( Ű    Ȯ)
+        for (size_t i = 0; i < count; i = (i + 1 == count) ? count : std::min(i + kNativeEvalVerifyStride, count - 1))
+        {
+            const KeyframeBin ref = EvaluateExportKey(job.node, job.times[i], job.timeSecs[i]);
+            const KeyframeBin& k = job.keys[i];
+            ++samples;
+
+            const float dx = k.tx - ref.tx, dy = k.ty - ref.ty, dz = k.tz - ref.tz;
+            const float qa[4] = { k.rx, k.ry, k.rz, k.rw };
+            const float qb[4] = { ref.rx, ref.ry, ref.rz, ref.rw };
+            jobT = std::max(jobT, sqrtf(dx * dx + dy * dy + dz * dz));
+            jobR = std::max(jobR, QuatAngleDeg(qa, qb));
+            jobS = std::max({ jobS, fabsf(k.sx - ref.sx), fabsf(k.sy - ref.sy), fabsf(k.sz - ref.sz) });
+        }
+        maxT = std::max(maxT, jobT);
+        maxR = std::max(maxR, jobR);
+        maxS = std::max(maxS, jobS);
+
+        if (jobT > kNativeEvalTranslationTolerance || jobR > kNativeEvalRotationToleranceDeg || jobS > kNativeEvalScaleTolerance)
+        {
+            BatchLog() << "Ŀ   ġ [" << clipName << "] " << SafeName(job.node)
+                << ": T=" << jobT << "m R=" << jobR << "deg S=" << jobS << " -> SDK  \n";
+            for (size_t i = 0; i < count; ++i)
+                job.keys[i] = EvaluateExportKey(job.node, job.times[i], job.timeSecs[i]);
+            ++replaced;
+        }
+    }
+
+    BatchLog() << "Ŀ    [" << clipName << "]:  " << jobs.size() << ",   " << samples
+        << ", ִ  T=" << maxT << "m R=" << maxR << "deg S=" << maxS
+        << ", SDK ü  " << replaced << "\n";
+}
+
+// jobs[i].keys ä.  :   (SDK), 򰡴   ParallelFor
+static void EvaluateSampleJobs(
+    const std::string& clipName,
+    const std::vector<FbxAnimLayer*>& layers,
+    std::vector<NodeSampleJob>& jobs)
+{
+    const bool native = NATIVE_CURVE_EVAL && layers.size() == 1;
+    if (NATIVE_CURVE_EVAL && !native)
+        BatchLog() << "Ŀ    [" << clipName << "]: ̾ " << layers.size() << ", SDK  \n";
+
+    if (!native)
+    {
+        for (NodeSampleJob& job : jobs)
+        {
+            job.keys.clear();
+            job.keys.reserve(job.times.size());
+            for (size_t i = 0; i < job.times.size(); ++i)
+                job.keys.push_back(EvaluateExportKey(job.node, job.times[i], job.timeSecs[i]));
+        }
+        return;
+    }
+
+    std::vector<FbxNodeCurveSnapshot> snapshots(jobs.size());
+    std::vector<std::vector<double>> times(jobs.size());
+    for (size_t i = 0; i < jobs.size(); ++i)
+    {
+        CaptureFbxNodeCurves(jobs[i].node, layers[0], snapshots[i]);
+        times[i].reserve(jobs[i].times.size());
+        for (const FbxTime& t : jobs[i].times)
+            times[i].push_back(t.GetSecondDouble());
+    }
+
+    ParallelFor(jobs.size(), [&](size_t i)
+        {
+            FbxLocalTrsSamples local;
+            EvaluateFbxNodeCurves(snapshots[i], times[i].data(), times[i].size(), local);
+            ConvertNativeSamplesToExportKeys(local, jobs[i].timeSecs, jobs[i].keys);
+        });
+
+    if (VERIFY_NATIVE_CURVE_EVAL)
+        VerifyNativeSampleJobs(clipName, jobs);
+}
+
+// ȸ  Ʈ ̰ ð 
+static void MergeSampleJobsIntoTracks(std::vector<NodeSampleJob>& jobs, std::vector<TrackBin>& tracks)
+{
+    for (NodeSampleJob& job : jobs)
+    {
+        TrackBin& track = tracks[job.trackIndex];
+        for (size_t i = 0; i < job.keys.size(); ++i)
+        {
+            track.keys.push_back(job.keys[i]);
+
+            if (SPLIT_TRACK_CHANNELS)
+            {
+                for (int c = 0; c < KEY_CHANNEL_COUNT; ++c)
+                    if (job.channelMasks[i] & (1u << c))
+                        track.channelKeys[c].push_back(job.keys[i]);
+            }
+        }
+
+        // ð 
+        std::sort(track.keys.begin(), track.keys.end(), KeyTimeLess);
+        if (SPLIT_TRACK_CHANNELS)
+        {
+            for (std::vector<KeyframeBin>& ck : track.channelKeys)
+                std::sort(ck.begin(), ck.end(), KeyTimeLess);
+        }
+    }
+}
+
+// ======================================================================
+// ABIN  (v1 / v2)
+// ======================================================================
+
+static void WriteClipV1(
+    BinaryWriter& out,
+    const std::string& clipName,
+    float duration,
+    const std::vector<TrackBin>& tracks)
+{
+    // Header
+    char magic[4] = { 'A','B','I','N' };
+    WriteRaw(out, magic, 4);
+    WriteUInt32(out, kAbinVersion1);
+
+    // Clip
+    WriteStringUtf8(out, clipName);
+    WriteFloat(out, duration);
+
+    WriteUInt32(out, (uint32_t)tracks.size());
+
+    for (auto& tr : tracks)
+    {
+        WriteStringUtf8(out, tr.boneName);
+        WriteInt32(out, -1); // v1 ̷ ؽð Ƿ ׻ ̸ 
+
+        WriteUInt32(out, (uint32_t)tr.keys.size());
+
+        // KeyframeBin ġ =  ġ (time, T xyz, R xyzw, S xyz)
+        static_assert(sizeof(KeyframeBin) == sizeof(float) * 11, "KeyframeBin must be tightly packed");
+        if (!tr.keys.empty())
+            WriteRaw(out, tr.keys.data(), sizeof(KeyframeBin) * tr.keys.size());
+    }
+}
+
+static double GetSceneFrameRate(FbxScene* scene)
+{
+    const FbxGlobalSettings& settings = scene->GetGlobalSettings();
+    const FbxTime::EMode mode = settings.GetTimeMode();
+    const double rate = (mode == FbxTime::eCustom) ? settings.GetCustomFrameRate() : FbxTime::GetFrameRate(mode);
+    return (rate > 0.0) ? rate : kDefaultFrameRate;
+}
+
+struct ClipV2Stats
+{
+    size_t channels = 0;
+    size_t constantChannels = 0;
+    float maxTranslationError = 0.0f;
+    float maxRotationErrorDeg = 0.0f;
+    float maxScaleError = 0.0f;
+    float maxTimeError = 0.0f;   //  ( ȣ ݿø)
+    size_t timeTables = 0;       // SPLIT_TRACK_CHANNELS
+    const char* fallbackReason = nullptr;  // v2    (WriteClipV2 false )
+};
+
+// ̵/ ä ϳ (KeyframeBin  float 3 )
+struct Vec3Channel
+{
+    float minValue[3];
+    float extent[3];
+    bool constant;
+};
+
+static Vec3Channel AnalyzeVec3Channel(const std::vector<KeyframeBin>& keys, float KeyframeBin::* x, float tolerance, bool euclidean)
+{
+    Vec3Channel c{};
+    for (int i = 0; i < 3; ++i)
+    {
+        float lo = FLT_MAX, hi = -FLT_MAX;
+        for (const KeyframeBin& k : keys)
+        {
+            const float v = (&(k.*x))[i];
+            lo = std::min(lo, v);
+            hi = std::max(hi, v);
+        }
+        c.minValue[i] = lo;
+        c.extent[i] = hi - lo;
+    }
+
+    //     ->    (̵ ,  к)
+    const float hx = c.extent[0] * 0.5f, hy = c.extent[1] * 0.5f, hz = c.extent[2] * 0.5f;
+    const float halfError = euclidean ? sqrtf(hx * hx + hy * hy + hz * hz) : std::max({ hx, hy, hz });
+    c.constant = halfError <= tolerance;
+    return c;
+}
+
+// Ű   (̵ 0,  1)
+static Vec3Channel AnalyzeTranslationChannel(const std::vector<KeyframeBin>& keys)
+{
+    if (keys.empty()) return Vec3Channel{ { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, true };
+    return AnalyzeVec3Channel(keys, &KeyframeBin::tx, kReduceTranslationTolerance, true);
+}
+
+static Vec3Channel AnalyzeScaleChannel(const std::vector<KeyframeBin>& keys)
+{
+    if (keys.empty()) return Vec3Channel{ { 1.0f, 1.0f, 1.0f }, { 0.0f, 0.0f, 0.0f }, true };
+    return AnalyzeVec3Channel(keys, &KeyframeBin::sx, kReduceScaleTolerance, false);
+}
+
+// ݱ : ̿ Ű   ȣ  ( ȸ)
+static void MakeRotationsContinuous(std::vector<KeyframeBin>& keys)
+{
+    for (size_t i = 1; i < keys.size(); ++i)
+    {
+        const KeyframeBin& p = keys[i - 1];
+        KeyframeBin& k = keys[i];
+        if (p.rx * k.rx + p.ry * k.ry + p.rz * k.rz + p.rw * k.rw < 0.0f)
+        {
+            k.rx = -k.rx; k.ry = -k.ry; k.rz = -k.rz; k.rw = -k.rw;
+        }
+    }
+}
+
+//  Ű ù Ű ѵ ̸  (Ű  ,  ׵)
+static bool IsConstantRotation(const std::vector<KeyframeBin>& keys)
+{
+    if (keys.empty()) return true;
+    const float q0[4] = { keys[0].rx, keys[0].ry, keys[0].rz, keys[0].rw };
+    for (const KeyframeBin& k : keys)
+    {
+        const float q[4] = { k.rx, k.ry, k.rz, k.rw };
+        if (QuatAngleDeg(q0, q) > kReduceRotationToleranceDeg) return false;
+    }
+    return true;
+}
+
+static void WriteConstantRotation(BinaryWriter& out, const std::vector<KeyframeBin>& keys)
+{
+    float q[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    if (!keys.empty())
+    {
+        q[0] = keys[0].rx; q[1] = keys[0].ry; q[2] = keys[0].rz; q[3] = keys[0].rw;
+    }
+    WriteRaw(out, q, sizeof(q));
+}
+
+static void WriteVec3ChannelHeader(BinaryWriter& out, const Vec3Channel& c)
+{
+    if (c.constant)
+    {
+        const float value[3] =
+        {
+            c.minValue[0] + c.extent[0] * 0.5f,
+            c.minValue[1] + c.extent[1] * 0.5f,
+            c.minValue[2] + c.extent[2] * 0.5f,
+        };
+        WriteRaw(out, value, sizeof(value));
+        return;
+    }
+    WriteRaw(out, c.minValue, sizeof(c.minValue));
+    WriteRaw(out, c.extent, sizeof(c.extent));
+}
+
+// ȭ Ʈ  +   (euclidean: ̵ ,  к ִ)
+static float WriteVec3ChannelStream(
+    BinaryWriter& out,
+    const std::vector<KeyframeBin>& keys,
+    float KeyframeBin::* x,
+    const Vec3Channel& c,
+    bool euclidean)
+{
+    float maxError = 0.0f;
+    std::vector<uint16_t> stream;
+    stream.reserve(keys.size() * 3);
+
+    for (const KeyframeBin& k : keys)
+    {
+        const float* v = &(k.*x);
+        float e[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            const float center = c.minValue[i] + c.extent[i] * 0.5f;
+            if (c.constant)
+            {
+                e[i] = v[i] - center;
+                continue;
+            }
+            const uint16_t q = QuantizeAbinUnorm16(v[i], c.minValue[i], c.extent[i]);
+            stream.push_back(q);
+            e[i] = DequantizeAbinUnorm16(q, c.minValue[i], c.extent[i]) - v[i];
+        }
+        const float err = euclidean
+            ? sqrtf(e[0] * e[0] + e[1] * e[1] + e[2] * e[2])
+            : std::max({ fabsf(e[0]), fabsf(e[1]), fabsf(e[2]) });
+        maxError = std::max(maxError, err);
+    }
+
+    if (!c.constant)
+        WriteRaw(out, stream.data(), stream.size() * sizeof(uint16_t));
+    return maxError;
+}
+
+// ŷ ȸ Ʈ  (  ) +   (,  ù Ű )
+static float WriteRotationStream(BinaryWriter& out, const std::vector<KeyframeBin>& keys, bool constant)
+{
+    if (keys.empty()) return 0.0f;
+
+    float maxError = 0.0f;
+    std::vector<AbinPackedQuat> rotations;
+    rotations.reserve(constant ? 0 : keys.size());
+
+    const float q0[4] = { keys[0].rx, keys[0].ry, keys[0].rz, keys[0].rw };
+    for (const KeyframeBin& k : keys)
+    {
+        const float q[4] = { k.rx, k.ry, k.rz, k.rw };
+        float decoded[4] = { q0[0], q0[1], q0[2], q0[3] };
+        if (!constant)
+        {
+            rotations.push_back(PackAbinQuat(q));
+            UnpackAbinQuat(rotations.back(), decoded);
+        }
+        maxError = std::max(maxError, QuatAngleDeg(q, decoded));
+    }
+
+    if (!constant)
+        WriteRaw(out, rotations.data(), rotations.size() * sizeof(AbinPackedQuat));
+    return maxError;
+}
+
+// Ű ð ->  ȣ (ȣ  uint16  Ȯ)
+static void QuantizeKeyFrames(
+    const std::vector<KeyframeBin>& keys,
+    double frameRate,
+    std::vector<uint16_t>& outFrames,
+    ClipV2Stats& stats)
+{
+    outFrames.clear();
+    for (const KeyframeBin& k : keys)
+    {
+        const uint16_t f = (uint16_t)std::llround(k.timeSec * frameRate);
+        outFrames.push_back(f);
+        stats.maxTimeError = std::max(stats.maxTimeError, fabsf((float)(f / frameRate) - k.timeSec));
+    }
+}
+
+// SPLIT_TRACK_CHANNELS: ð ̺ + Ʈ T/R/S ä (AbinFormat.h ä и ġ)
+//  / 迭    ̺ տ   ־   
+static void WriteSplitChannelTracksV2(
+    BinaryWriter& out,
+    double frameRate,
+    const std::vector<TrackBin>& tracks,
+    ClipV2Stats& stats)
+{
+    struct Channel
+    {
+        std::vector<KeyframeBin> keys;   // ȸ ݱ  ó 
+        Vec3Channel vec{};               // T / S
+        bool constant = true;
+        uint32_t timeTable = 0;
+    };
+
+    std::vector<std::array<Channel, KEY_CHANNEL_COUNT>> channels(tracks.size());
+    std::vector<std::vector<uint16_t>> timeTables;
+    std::map<std::vector<uint16_t>, uint32_t> timeTableIndex;
+    std::vector<uint16_t> frames;
+
+    for (size_t ti = 0; ti < tracks.size(); ++ti)
+    {
+        for (int c = 0; c < KEY_CHANNEL_COUNT; ++c)
+        {
+            Channel& ch = channels[ti][c];
+            ch.keys = tracks[ti].channelKeys[c];
+
+            if (c == KEY_CHANNEL_R)
+            {
+                MakeRotationsContinuous(ch.keys);
+                ch.constant = IsConstantRotation(ch.keys);
+            }
+            else
+            {
+                ch.vec = (c == KEY_CHANNEL_T) ? AnalyzeTranslationChannel(ch.keys) : AnalyzeScaleChannel(ch.keys);
+                ch.constant = ch.vec.constant;
+            }
+
+            stats.channels += 1;
+            if (ch.constant)
+            {
+                stats.constantChannels += 1;
+                continue;
+            }
+
+            QuantizeKeyFrames(ch.keys, frameRate, frames, stats);
+            auto inserted = timeTableIndex.emplace(frames, (uint32_t)timeTables.size());
+            if (inserted.second)
+                timeTables.push_back(frames);
+            ch.timeTable = inserted.first->second;
+        }
+    }
+    stats.timeTables = timeTables.size();
+
+    WriteUInt32(out, (uint32_t)timeTables.size());
+    for (const std::vector<uint16_t>& table : timeTables)
+    {
+        WriteUInt32(out, (uint32_t)table.size());
+        WriteRaw(out, table.data(), table.size() * sizeof(uint16_t));
+    }
+
+    for (size_t ti = 0; ti < tracks.size(); ++ti)
+    {
+        const TrackBin& tr = tracks[ti];
+        const Channel& t = channels[ti][KEY_CHANNEL_T];
+        const Channel& r = channels[ti][KEY_CHANNEL_R];
+        const Channel& sc = channels[ti][KEY_CHANNEL_S];
+
+        uint32_t trackFlags = 0;
+        if (t.constant) trackFlags |= ABIN_TRACK_CONSTANT_T;
+        if (r.constant) trackFlags |= ABIN_TRACK_CONSTANT_R;
+        if (sc.constant) trackFlags |= ABIN_TRACK_CONSTANT_S;
+
+        WriteStringUtf8(out, tr.boneName);
+        WriteInt32(out, tr.boneIndex);
+        WriteUInt32(out, trackFlags);
+
+        if (!t.constant) WriteUInt32(out, t.timeTable);
+        WriteVec3ChannelHeader(out, t.vec);
+        stats.maxTranslationError = std::max(stats.maxTranslationError,
+            WriteVec3ChannelStream(out, t.keys, &KeyframeBin::tx, t.vec, true));
+
+        if (r.constant) WriteConstantRotation(out, r.keys);
+        else            WriteUInt32(out, r.timeTable);
+        stats.maxRotationErrorDeg = std::max(stats.maxRotationErrorDeg,
+            WriteRotationStream(out, r.keys, r.constant));
+
+        if (!sc.constant) WriteUInt32(out, sc.timeTable);
+        WriteVec3ChannelHeader(out, sc.vec);
+        stats.maxScaleError = std::max(stats.maxScaleError,
+            WriteVec3ChannelStream(out, sc.keys, &KeyframeBin::sx, sc.vec, false));
+    }
+}
+
+// Ű ð frameRate  ȣ ״    ,    nullptr
+// - uint16 ʰ
+// -  Ʈ/ä ̿ Ű   ȣ ( 0  +  ӱ ð )
+static const char* FindV2FrameQuantizationProblem(const std::vector<TrackBin>& tracks, double frameRate)
+{
+    auto check = [frameRate](const std::vector<KeyframeBin>& keys) -> const char*
+        {
+            long long prev = -1;
+            for (const KeyframeBin& k : keys)
+            {
+                const long long f = std::llround(k.timeSec * frameRate);
+                if (f > 0xFFFF) return " ȣ 16Ʈ  ʰ";
+                if (f == prev) return "Ű ӷƮ  (  ȣ)";
+                prev = f;
+            }
+            return nullptr;
+        };
+
+    for (const TrackBin& tr : tracks)
+    {
+        if (SPLIT_TRACK_CHANNELS)
+        {
+            for (const auto& ck : tr.channelKeys)
+                if (const char* reason = check(ck)) return reason;
+        }
+        else if (const char* reason = check(tr.keys))
+        {
+            return reason;
+        }
+    }
+    return nullptr;
+}
+
+//  ȣ   Ŭ̸ false + stats.fallbackReason (ȣڰ v1)
+// skeletonHash: ̷濡  Ŭ̸ ؽ, ƴϸ nullptr
+static bool WriteClipV2(
+    BinaryWriter& out,
+    const std::string& clipName,
+    float duration,
+    double frameRate,
+    const uint64_t* skeletonHash,
+    const std::vector<TrackBin>& tracks,
+    ClipV2Stats& stats)
+{
+    stats.fallbackReason = FindV2FrameQuantizationProblem(tracks, frameRate);
+    if (stats.fallbackReason)
+        return false;
+
+    char magic[4] = { 'A','B','I','N' };
+    WriteRaw(out, magic, 4);
+    WriteUInt32(out, kAbinVersion2);
+    uint32_t clipFlags = 0;
+    if (skeletonHash) clipFlags |= ABIN_CLIP_SKELETON_BOUND;
+    if (SPLIT_TRACK_CHANNELS) clipFlags |= ABIN_CLIP_SPLIT_CHANNELS;
+    WriteUInt32(out, clipFlags);
+    if (skeletonHash)
+        WriteRaw(out, skeletonHash, sizeof(*skeletonHash));
+
+    WriteStringUtf8(out, clipName);
+    WriteFloat(out, duration);
+    WriteFloat(out, (float)frameRate);
+    WriteUInt32(out, (uint32_t)tracks.size());
+
+    if (SPLIT_TRACK_CHANNELS)
+    {
+        WriteSplitChannelTracksV2(out, frameRate, tracks, stats);
+        return true;
+    }
+
+    std::vector<KeyframeBin> keys;
+    std::vector<uint16_t> frames;
+
+    for (const TrackBin& tr : tracks)
+    {
+        keys = tr.keys;
+        MakeRotationsContinuous(keys);
+
+        const Vec3Channel t = AnalyzeTranslationChannel(keys);
+        const Vec3Channel sc = AnalyzeScaleChannel(keys);
+        const bool constantR = IsConstantRotation(keys);
+
+        uint32_t trackFlags = 0;
+        if (t.constant) trackFlags |= ABIN_TRACK_CONSTANT_T;
+        if (constantR) trackFlags |= ABIN_TRACK_CONSTANT_R;
+        if (sc.constant) trackFlags |= ABIN_TRACK_CONSTANT_S;
+
+        stats.channels += 3;
+        stats.constantChannels += (t.constant ? 1 : 0) + (constantR ? 1 : 0) + (sc.constant ? 1 : 0);
+
+        const bool allConstant = t.constant && constantR && sc.constant;
+        const uint32_t keyCount = allConstant ? 0 : (uint32_t)keys.size();
+
+        WriteStringUtf8(out, tr.boneName);
+        WriteInt32(out, tr.boneIndex);
+        WriteUInt32(out, keyCount);
+        WriteUInt32(out, trackFlags);
+
+        WriteVec3ChannelHeader(out, t);
+        if (constantR)
+            WriteConstantRotation(out, keys);
+        WriteVec3ChannelHeader(out, sc);
+
+        if (keys.empty()) continue;
+
+        //  ä Ʈ   ( Ű ),   keyCount = 0̶ ƹ͵  
+        if (keyCount > 0)
+        {
+            QuantizeKeyFrames(keys, frameRate, frames, stats);
+            WriteRaw(out, frames.data(), frames.size() * sizeof(uint16_t));
+        }
+
+        stats.maxTranslationError = std::max(stats.maxTranslationError,
+            WriteVec3ChannelStream(out, keys, &KeyframeBin::tx, t, true));
+
+        stats.maxRotationErrorDeg = std::max(stats.maxRotationErrorDeg,
+            WriteRotationStream(out, keys, constantR));
+
+        stats.maxScaleError = std::max(stats.maxScaleError,
+            WriteVec3ChannelStream(out, keys, &KeyframeBin::sx, sc, false));
+    }
+
+    return true;
+}
+
+// ======================================================================
+// ABIN v3 (WRITE_ABIN_UNIFORM)
+// ======================================================================
+
+// Ŭ ð 0~duration sampleRate Ʈ  -> outSamples[track][frame],   ȯ
+// clipStartSec: Ŭ ð 0  ð (T  ݿ)
+//   η  ӵ f / sampleRate (duration    , Ŀ   )
+static uint32_t SampleClipUniform(
+    const std::string& clipName,
+    const std::vector<FbxAnimLayer*>& layers,
+    const std::vector<TrackBin>& tracks,
+    double clipStartSec,
+    float duration,
+    float timeScale,
+    double sampleRate,
+    std::vector<std::vector<KeyframeBin>>& outSamples)
+{
+    const uint32_t frameCount = (uint32_t)std::ceil(duration * sampleRate - 1e-4) + 1;
+
+    std::vector<NodeSampleJob> jobs(tracks.size());
+    for (size_t ti = 0; ti < tracks.size(); ++ti)
+    {
+        NodeSampleJob& job = jobs[ti];
+        job.node = tracks[ti].node;
+        job.trackIndex = (int)ti;
+        job.times.resize(frameCount);
+        job.timeSecs.resize(frameCount);
+        for (uint32_t f = 0; f < frameCount; ++f)
+        {
+            const double sec = f / sampleRate;
+            job.times[f].SetSecondDouble(clipStartSec + sec / timeScale);
+            job.timeSecs[f] = (float)sec;
+        }
+    }
+
+    EvaluateSampleJobs(clipName, layers, jobs);
+
+    outSamples.assign(tracks.size(), {});
+    for (size_t ti = 0; ti < tracks.size(); ++ti)
+    {
+        outSamples[ti].swap(jobs[ti].keys);
+        MakeRotationsContinuous(outSamples[ti]);
+    }
+    return frameCount;
+}
+
+static void WriteClipUniform(
+    BinaryWriter& out,
+    const std::string& clipName,
+    float duration,
+    double sampleRate,
+    const uint64_t* skeletonHash,
+    const std::vector<TrackBin>& tracks,
+    const std::vector<std::vector<KeyframeBin>>& samples,
+    uint32_t frameCount)
+{
+    char magic[4] = { 'A','B','I','N' };
+    WriteRaw(out, magic, 4);
+    WriteUInt32(out, kAbinVersion3);
+    WriteUInt32(out, skeletonHash ? ABIN_CLIP_SKELETON_BOUND : 0u);
+    if (skeletonHash)
+        WriteRaw(out, skeletonHash, sizeof(*skeletonHash));
+
+    WriteStringUtf8(out, clipName);
+    WriteFloat(out, duration);
+    WriteFloat(out, (float)sampleRate);
+    WriteUInt32(out, frameCount);
+    WriteUInt32(out, (uint32_t)tracks.size());
+
+    for (const TrackBin& tr : tracks)
+    {
+        WriteStringUtf8(out, tr.boneName);
+        WriteInt32(out, tr.boneIndex);
+    }
+
+    static const uint8_t kZeros[kAbinUniformFrameAlignment] = {};
+    const size_t misalign = out.Size() % kAbinUniformFrameAlignment;
+    if (misalign != 0)
+        WriteRaw(out, kZeros, kAbinUniformFrameAlignment - misalign);
+
+    const size_t trackCount = tracks.size();
+    std::vector<float> block(trackCount * 12);
+    for (uint32_t f = 0; f < frameCount; ++f)
+    {
+        float* r = block.data();
+        float* t = r + trackCount * 4;
+        float* sc = t + trackCount * 4;
+        for (size_t ti = 0; ti < trackCount; ++ti)
+        {
+            const KeyframeBin& k = samples[ti][f];
+            r[ti * 4 + 0] = k.rx; r[ti * 4 + 1] = k.ry; r[ti * 4 + 2] = k.rz; r[ti * 4 + 3] = k.rw;
+            t[ti * 4 + 0] = k.tx; t[ti * 4 + 1] = k.ty; t[ti * 4 + 2] = k.tz; t[ti * 4 + 3] = 0.0f;
+            sc[ti * 4 + 0] = k.sx; sc[ti * 4 + 1] = k.sy; sc[ti * 4 + 2] = k.sz; sc[ti * 4 + 3] = 1.0f;
+        }
+        WriteRaw(out, block.data(), block.size() * sizeof(float));
+    }
+}
+
+// Ʈ  ȣ ã  Ʈ ,  ȣ   ( Ʈ  false)
+static bool BindTracksToSkeleton(
+    const std::string& clipName,
+    std::vector<TrackBin>& tracks,
+    const ExportSkeleton& skeleton)
+{
+    const size_t sourceCount = tracks.size();
+    for (TrackBin& tr : tracks)
+    {
+        auto it = skeleton.nameToBone.find(tr.boneName);
+        if (it == skeleton.nameToBone.end())
+        {
+            BatchLog() << "̷濡  Ʈ  [" << clipName << "]: " << tr.boneName << "\n";
+            tr.boneIndex = -1;
+            continue;
+        }
+        tr.boneIndex = it->second;
+    }
+
+    tracks.erase(
+        remove_if(tracks.begin(), tracks.end(),
+            [](const TrackBin& tr) { return tr.boneIndex < 0; }),
+        tracks.end());
+
+    std::sort(tracks.begin(), tracks.end(),
+        [](const TrackBin& a, const TrackBin& b) { return a.boneIndex < b.boneIndex; });
+
+    BatchLog() << "̷ ε [" << clipName << "]: Ʈ " << tracks.size() << "/" << sourceCount
+        << ",  " << skeleton.bones.size() << " (Ʈ   " << (skeleton.bones.size() - tracks.size()) << ")\n";
+
+    return !tracks.empty();
+}
+
+static void DumpAnimExtractorDebug(
+    const char* phaseTag,
+    FbxScene* scene,
+    FbxAnimStack* stack,
+    FbxAnimLayer* layer,
+    const FbxTimeSpan& span,
+    const vector<TrackBin>* tracks,                       //  nullptr
+    const unordered_map<string, int>* nameToTrack,         //  nullptr
+    const vector<string>& probeBones,                     //  (: Hips/Hands)
+    float timeScale)
+{
+    BatchLog() << "\n==================== [AnimDump] " << phaseTag << " ====================\n";
+
+    // ---- Scene / Stack / Span
+    BatchLog() << "[Scene] root=" << SafeName(scene ? scene->GetRootNode() : nullptr) << "\n";
+    BatchLog() << "[Stack] name=" << SafeNameStack(stack) << " layer=" << (layer ? "ok" : "null") << "\n";
+
+    const double s0 = span.GetStart().GetSecondDouble();
+    const double s1 = span.GetStop().GetSecondDouble();
+    BatchLog() << "[Span] start=" << s0 << " end=" << s1 << " dur=" << (s1 - s0) << " timeScale=" << timeScale << "\n";
+
+    // ---- Skeleton  /̸ 
+    int skelCount = 0;
+    vector<string> skelNames;
+    function<void(FbxNode*)> dfs = [&](FbxNode* n)
+        {
+            if (!n) return;
+            if (IsSkeletonNode(n))
+            {
+                skelCount++;
+                if ((int)skelNames.size() < 20) skelNames.push_back(n->GetName());
+            }
+            for (int i = 0; i < n->GetChildCount(); ++i) dfs(n->GetChild(i));
+        };
+    dfs(scene ? scene->GetRootNode() : nullptr);
+
+    BatchLog() << "[Skeleton] count=" << skelCount << " sample(<=20)=";
+    for (size_t i = 0; i < skelNames.size(); ++i)
+    {
+        if (i) BatchLog() << ", ";
+        BatchLog() << skelNames[i];
+    }
+    BatchLog() << "\n";
+
+    // ----   /۷ι Ư ð  (start/mid/end)
+    auto DumpNodeAt = [&](FbxNode* n, const char* label, const FbxTime& t)
+        {
+            if (!n) { BatchLog() << "  [" << label << "] node=null\n"; return; }
+
+            FbxAMatrix L = n->EvaluateLocalTransform(t);
+
+            static FbxAMatrix BasisRot = BuildExportRotation();
+            static FbxAMatrix BasisRotInv = BasisRot.Inverse();
+            L = BasisRot * L * BasisRotInv;
+
+            if (MIRROR_X_EXPORT) { static FbxAMatrix MirrorX = MakeMirrorX(); L = MirrorX * L * MirrorX; }
+
+            FbxVector4 T = L.GetT();
+            FbxQuaternion Q = L.GetQ(); Q.Normalize();
+            FbxVector4 S = L.GetS();
+
+            BatchLog() << "  [" << label << "] " << n->GetName()
+                << " det3=" << Det3x3(L)
+                << " T=(" << (double)T[0] << "," << (double)T[1] << "," << (double)T[2] << ")"
+                << " S=(" << (double)S[0] << "," << (double)S[1] << "," << (double)S[2] << ")"
+                << " Q=(" << (double)Q[0] << "," << (double)Q[1] << "," << (double)Q[2] << "," << (double)Q[3] << ")"
+                << "\n";
+        };
+
+    if (scene && scene->GetRootNode())
+    {
+        FbxTime tStart = span.GetStart();
+        FbxTime tEnd = span.GetStop();
+        FbxTime tMid;  tMid.SetSecondDouble((s0 + s1) * 0.5);
+
+        BatchLog() << "[ProbeBones] (local after mirror-conjugation)\n";
+        for (const string& bn : probeBones)
+        {
+            // ̸  ã( DFS)
+            FbxNode* found = nullptr;
+            function<void(FbxNode*)> findDfs = [&](FbxNode* n)
+                {
+                    if (!n || found) return;
+                    if (bn == n->GetName()) { found = n; return; }
+                    for (int i = 0; i < n->GetChildCount(); ++i) findDfs(n->GetChild(i));
+                };
+            findDfs(scene->GetRootNode());
+
+            DumpNodeAt(found, "Start", tStart);
+            DumpNodeAt(found, "Mid", tMid);
+            DumpNodeAt(found, "End", tEnd);
+        }
+    }
+
+    // ---- Track ()  +   key 
+    if (tracks && nameToTrack)
+    {
+        BatchLog() << "[Tracks] count=" << tracks->size() << "\n";
+
+        //  (ּ/ִ)   
+        size_t minK = (size_t)-1, maxK = 0;
+        string minN, maxN;
+        for (auto& tr : *tracks)
+        {
+            size_t k = tr.keys.size();
+            if (k < minK) { minK = k; minN = tr.boneName; }
+            if (k > maxK) { maxK = k; maxN = tr.boneName; }
+        }
+        BatchLog() << "  keysMin=" << minK << " (" << minN << "), keysMax=" << maxK << " (" << maxN << ")\n";
+
+        auto DumpTrackSample = [&](const string& bn)
+            {
+                auto it = nameToTrack->find(bn);
+                if (it == nameToTrack->end()) { BatchLog() << "  [TrackSample] " << bn << " : NOT FOUND\n"; return; }
+                const TrackBin& tr = (*tracks)[it->second];
+                BatchLog() << "  [TrackSample] " << bn << " keys=" << tr.keys.size() << "\n";
 
                 // // 1 ( )
                 auto printK = [&](const KeyframeBin& k, const char* tag)
                     {
-                        cout << "    " << tag << " t=" << k.timeSec
+                        BatchLog() << "    " << tag << " t=" << k.timeSec
                             << " T=(" << k.tx << "," << k.ty << "," << k.tz << ")"
                             << " S=(" << k.sx << "," << k.sy << "," << k.sz << ")"
                             << " Q=(" << k.rx << "," << k.ry << "," << k.rz << "," << k.rw << ")"
@@ -446,228 +1826,607 @@ static void DumpAnimExtractorDebug(
                 }
             };
 
-        cout << "[TrackProbe] (after export packing)\n";
+        BatchLog() << "[TrackProbe] (after export packing)\n";
         for (const string& bn : probeBones) DumpTrackSample(bn);
     }
 
-    cout << "==================== [AnimDump End] ====================\n";
+    BatchLog() << "==================== [AnimDump End] ====================\n";
 }
 
-
 // ======================================================================
-// main: ִϸ̼ FBX  ִϸ̼ BIN(ABIN) 
+//  ũ (BAKE_CROWD_PALETTE, Common/AbinBakeFormat.h)
 // ======================================================================
 
-int main()
+// ͽƮ Ű ->   (FbxAMatrix ġ,  :  i = ȸ  i * s_i,  3 = ̵)
+static void ComposeLocalRowMatrix(const KeyframeBin& k, float m[16])
 {
-    string importDir = "import";
-    string exportDir = "export";
+    const float x = k.rx, y = k.ry, z = k.rz, w = k.rw;
+    const float r[3][3] = {
+        { 1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y - w * z),        2.0f * (x * z + w * y) },
+        { 2.0f * (x * y + w * z),        1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z - w * x) },
+        { 2.0f * (x * z - w * y),        2.0f * (y * z + w * x),        1.0f - 2.0f * (x * x + y * y) },
+    };
+    const float s[3] = { k.sx, k.sy, k.sz };
+
+    for (int i = 0; i < 3; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+            m[i * 4 + j] = r[j][i] * s[i];
+        m[i * 4 + 3] = 0.0f;
+    }
+    m[12] = k.tx; m[13] = k.ty; m[14] = k.tz; m[15] = 1.0f;
+}
 
-    namespace fs = std::filesystem;
+// out = a * b (  ġ, out a/b ġ  )
+static void MulRowMatrix(const float a[16], const float b[16], float out[16])
+{
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j)
+            out[i * 4 + j] = a[i * 4 + 0] * b[0 * 4 + j] + a[i * 4 + 1] * b[1 * 4 + j]
+                           + a[i * 4 + 2] * b[2 * 4 + j] + a[i * 4 + 3] * b[3 * 4 + j];
+}
 
-    //   
-    std::error_code ec;
-    fs::create_directories(exportDir, ec);
+// ≮>.bin -> ≮>_crowd.bin
+static string BuildCrowdBakeFilePath(const string& binFileName)
+{
+    const string ext = ".bin";
+    const bool hasExt = binFileName.size() >= ext.size()
+        && binFileName.compare(binFileName.size() - ext.size(), ext.size(), ext) == 0;
+    return (hasExt ? binFileName.substr(0, binFileName.size() - ext.size()) : binFileName) + "_crowd.bin";
+}
 
-    // FBX SDK ʱȭ
-    FbxManager* manager = FbxManager::Create();
-    if (!manager)
+// samples: SampleClipUniform  (tracks ), ̷ ü  Ӹ  ȷƮ (+ ) 
+static bool BakeCrowdClip(
+    BinaryWriter& out,
+    const std::string& clipName,
+    float duration,
+    double sampleRate,
+    const std::vector<TrackBin>& tracks,
+    const std::vector<std::vector<KeyframeBin>>& samples,
+    uint32_t frameCount)
+{
+    const ExportSkeleton& skeleton = GetExportSkeleton();
+    if (!skeleton.loaded)
     {
-        cout << "FBX Manager  .\n";
-        return -1;
+        BatchLog() << "̷ MBIN б : " << kSkeletonModelBinPath << " (" << skeleton.error << ")\n";
+        return false;
     }
 
-    FbxIOSettings* ioSettings = FbxIOSettings::Create(manager, IOSROOT);
-    manager->SetIOSettings(ioSettings);
-
-    // ================================================
-    // import  ȸ: *.fbx  ִϸ̼ BIN 
-    // ================================================
-    for (const auto& entry : fs::directory_iterator(importDir))
+    const CrowdBakeMesh* mesh = nullptr;
+    if (BAKE_CROWD_VERTICES)
     {
-        if (!entry.is_regular_file()) continue;
+        mesh = &GetCrowdBakeMesh();
+        if (!mesh->loaded)
+        {
+            BatchLog() << " ޽ MBIN б : " << kCrowdMeshModelBinPath << " (" << mesh->error << ")\n";
+            return false;
+        }
+        if (mesh->skeletonHash != skeleton.hash)
+        {
+            BatchLog() << " ޽ ̷ ٸϴ: " << kCrowdMeshModelBinPath << " / " << kSkeletonModelBinPath << "\n";
+            return false;
+        }
+    }
 
-        fs::path path = entry.path();
-        if (path.extension() != ".fbx") continue;
+    const size_t boneCount = skeleton.bones.size();
+    for (size_t b = 0; b < boneCount; ++b)
+    {
+        if (skeleton.bones[b].parentIndex >= (int32_t)b)
+        {
+            BatchLog() << "̷   θ  ƴմϴ: " << skeleton.bones[b].name << "\n";
+            return false;
+        }
+    }
 
-        string name = path.stem().string();
-        string fbxFileName = path.string();
-        string binFileName = exportDir + "/" + name + ".bin";
+    //  -> Ʈ (̸  ù Ʈ)
+    std::vector<int> boneTrack(boneCount, -1);
+    size_t matched = 0;
+    for (size_t ti = 0; ti < tracks.size(); ++ti)
+    {
+        auto it = skeleton.nameToBone.find(tracks[ti].boneName);
+        if (it != skeleton.nameToBone.end() && boneTrack[it->second] < 0)
+        {
+            boneTrack[it->second] = (int)ti;
+            ++matched;
+        }
+    }
+    if (matched == 0)
+    {
+        BatchLog() << " ũ [" << clipName << "]: ̷濡 ´ Ʈ ϴ.\n";
+        return false;
+    }
 
-        cout << "\n==========================================\n";
-        cout << "ó : " << fbxFileName << "\n";
+    const size_t vertexCount = mesh ? mesh->vertices.size() : 0;
+    const size_t paletteRowFloats = boneCount * kAbakTexelsPerBone * 4;
+    std::vector<float> palette((size_t)frameCount * paletteRowFloats);
+    std::vector<float> positions((size_t)frameCount * vertexCount * 4);
+    std::vector<float> normals((size_t)frameCount * vertexCount * 4);
 
-        // FBX Import
-        FbxImporter* importer = FbxImporter::Create(manager, "");
-        if (!importer->Initialize(fbxFileName.c_str(), -1, manager->GetIOSettings()))
+    // ӳ  ( Ű κ̶   )
+    ParallelFor(frameCount, [&](size_t f)
         {
-            cout << "FBX    ϴ: " << fbxFileName << "\n";
-            importer->Destroy();
-            continue;
-        }
+            std::vector<float> global(boneCount * 16);
+            std::vector<float> skin(boneCount * 16);
+            float local[16];
 
-        FbxScene* scene = FbxScene::Create(manager, ("AnimScene_" + name).c_str());
-        importer->Import(scene);
-        importer->Destroy();
+            for (size_t b = 0; b < boneCount; ++b)
+            {
+                const MbinSkeletonBone& bone = skeleton.bones[b];
+                if (boneTrack[b] >= 0) ComposeLocalRowMatrix(samples[boneTrack[b]][f], local);
+                else                   std::memcpy(local, bone.bindLocal, sizeof(local));
 
-        // DirectX ǥ + meter  ȯ
-        FbxAxisSystem::DirectX.ConvertScene(scene);
-        FbxSystemUnit::m.ConvertScene(scene);
+                float* g = &global[b * 16];
+                if (bone.parentIndex >= 0) MulRowMatrix(local, &global[(size_t)bone.parentIndex * 16], g);
+                else                       std::memcpy(g, local, sizeof(local));
 
-        // -----------------------------
-        // AnimStack / AnimLayer / TimeSpan
-        // -----------------------------
-        FbxAnimStack* stack = scene->GetCurrentAnimationStack();
-        if (!stack && scene->GetSrcObjectCount<FbxAnimStack>() > 0)
-            stack = scene->GetSrcObject<FbxAnimStack>(0);
+                float* m = &skin[b * 16];
+                MulRowMatrix(bone.offsetMatrix, g, m);
 
-        if (!stack)
-        {
-            cout << "ִϸ̼  ϴ.\n";
-            scene->Destroy();
-            continue;
-        }
+                float* texel = &palette[f * paletteRowFloats + b * kAbakTexelsPerBone * 4];
+                for (uint32_t c = 0; c < kAbakTexelsPerBone; ++c)
+                    for (int r = 0; r < 4; ++r)
+                        texel[c * 4 + r] = m[r * 4 + c];
+            }
+
+            for (size_t v = 0; v < vertexCount; ++v)
+            {
+                const CrowdBakeVertex& src = mesh->vertices[v];
+                float p[3] = { 0.0f, 0.0f, 0.0f };
+                float n[3] = { 0.0f, 0.0f, 0.0f };
+                for (int i = 0; i < 4; ++i)
+                {
+                    const float w = src.boneWeights[i];
+                    if (w <= 0.0f || src.boneIndices[i] >= boneCount) continue;
 
-        scene->SetCurrentAnimationStack(stack);
+                    const float* m = &skin[(size_t)src.boneIndices[i] * 16];
+                    for (int c = 0; c < 3; ++c)
+                    {
+                        p[c] += w * (src.position[0] * m[c] + src.position[1] * m[4 + c] + src.position[2] * m[8 + c] + m[12 + c]);
+                        n[c] += w * (src.normal[0] * m[c] + src.normal[1] * m[4 + c] + src.normal[2] * m[8 + c]);
+                    }
+                }
 
-        FbxTimeSpan timeSpan = stack->GetLocalTimeSpan();
-        FbxAnimLayer* layer = stack->GetMember<FbxAnimLayer>(0);
-        if (!layer)
+                const float len = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+                if (len > 0.0f)
+                    for (float& c : n) c /= len;
+
+                float* pos = &positions[(f * vertexCount + v) * 4];
+                float* nrm = &normals[(f * vertexCount + v) * 4];
+                pos[0] = p[0]; pos[1] = p[1]; pos[2] = p[2]; pos[3] = 1.0f;
+                nrm[0] = n[0]; nrm[1] = n[1]; nrm[2] = n[2]; nrm[3] = 0.0f;
+            }
+        });
+
+    const uint32_t flags = (BAKE_CROWD_HALF ? ABAK_FLAG_HALF : 0u) | (mesh ? ABAK_FLAG_VERTICES : 0u);
+
+    char magic[4] = { 'A','B','A','K' };
+    WriteRaw(out, magic, 4);
+    WriteUInt32(out, kAbakVersion);
+    WriteUInt32(out, flags);
+    WriteRaw(out, &skeleton.hash, sizeof(skeleton.hash));
+    WriteStringUtf8(out, clipName);
+    WriteFloat(out, duration);
+    WriteFloat(out, (float)sampleRate);
+    WriteUInt32(out, frameCount);
+    WriteUInt32(out, (uint32_t)boneCount);
+    WriteUInt32(out, (uint32_t)vertexCount);
+
+    auto writeBlock = [&out](const std::vector<float>& block)
         {
-            cout << "AnimLayer ϴ.\n";
-            scene->Destroy();
-            continue;
-        }
+            static const uint8_t kZeros[kAbakBlockAlignment] = {};
+            const size_t misalign = out.Size() % kAbakBlockAlignment;
+            if (misalign != 0)
+                WriteRaw(out, kZeros, kAbakBlockAlignment - misalign);
 
-        const float timeScale = 1.0f;
-        const double startSec = timeSpan.GetStart().GetSecondDouble();
-        const double endSec = timeSpan.GetStop().GetSecondDouble();
-        float duration = (float)((endSec - startSec) * timeScale);
+            if (BAKE_CROWD_HALF)
+            {
+                std::vector<uint16_t> half(block.size());
+                for (size_t i = 0; i < block.size(); ++i)
+                    half[i] = FloatToAbakHalf(block[i]);
+                WriteRaw(out, half.data(), half.size() * sizeof(uint16_t));
+            }
+            else
+            {
+                WriteRaw(out, block.data(), block.size() * sizeof(float));
+            }
+        };
 
-        // Ŭ ̸
-        string clipName;
-        const char* stackNameC = stack->GetName();
-        if (stackNameC && stackNameC[0] != '\0') clipName = stackNameC;
-        else                                     clipName = name;
-
-        // -----------------------------
-        // Track 
-        // -----------------------------
-        vector<TrackBin> tracks;
-        unordered_map<string, int> nameToTrack;
-
-        vector<string> probe = { "Bind_Hips", "Bind_Spine", "Bind_LeftHand", "Bind_RightHand" };
-
-        DumpAnimExtractorDebug(
-            "PRE-EXTRACT",
-            scene, stack, layer, timeSpan,
-            nullptr, nullptr,      // tracks/nameToTrack  
-            probe,
-            timeScale);
-
-
-        TraverseAndExtractTracks(
-            scene->GetRootNode(),
-            layer,
-            timeSpan,
-            timeScale,
-            tracks,
-            nameToTrack);
-
-        DumpAnimExtractorDebug(
-            "POST-EXTRACT",
-            scene, stack, layer, timeSpan,
-            &tracks, &nameToTrack,
-            probe,
-            timeScale);
-
-        if (tracks.empty())
-        {
-            cout << "Ű  ʽϴ.\n";
-            scene->Destroy();
-            continue;
-        }
+    out.Reserve(out.Size() + kAbakBlockAlignment * 3 + (palette.size() + positions.size() + normals.size()) * sizeof(float));
+    writeBlock(palette);
+    if (mesh)
+    {
+        writeBlock(positions);
+        writeBlock(normals);
+    }
 
-        // -----------------------------
-        // 0(T) : minTime ŭ ü shift
-        // -----------------------------
-        float minTime = FLT_MAX;
-        for (auto& tr : tracks)
-            for (auto& k : tr.keys)
-                if (k.timeSec > 0.0f && k.timeSec < minTime)
-                    minTime = k.timeSec;
+    BatchLog() << " ũ [" << clipName << "]: " << frameCount << " (" << sampleRate << "Hz)"
+        << ",  " << boneCount << " (Ʈ " << matched << "/" << tracks.size() << ")"
+        << ",  " << vertexCount << ", " << (BAKE_CROWD_HALF ? "fp16" : "float32")
+        << ", " << out.Size() << " bytes\n";
+    return true;
+}
 
-        if (minTime != FLT_MAX)
-        {
-            for (auto& tr : tracks)
+// ======================================================================
+//  ϳ ó (AnimeBinExport.h)
+// ======================================================================
+
+static string BuildAnimBinFilePath(const string& exportDir, const string& name)
+{
+    return exportDir + "/" + name + ".bin";
+}
+
+//  ̸ ->  ̸  (/  '_')
+static string SanitizeStackFileName(const string& s)
+{
+    string out = s;
+    for (char& c : out)
+    {
+        const unsigned char u = (unsigned char)c;
+        if (u < 0x20 || strchr("<>:\"/\\|?*", c)) c = '_';
+    }
+    return out;
+}
+
+//  ϳ -> ABIN ϳ (binFileName)
+static bool ExportAnimationStack(
+    FbxScene* scene,
+    FbxAnimStack* stack,
+    const string& name,
+    const string& binFileName,
+    vector<string>& outOutputs)
+{
+    // -----------------------------
+    // AnimStack / AnimLayer / TimeSpan
+    // -----------------------------
+    scene->SetCurrentAnimationStack(stack);
+
+    FbxTimeSpan timeSpan = stack->GetLocalTimeSpan();
+    vector<FbxAnimLayer*> layers;
+    for (int i = 0; i < stack->GetMemberCount<FbxAnimLayer>(); ++i)
+        layers.push_back(stack->GetMember<FbxAnimLayer>(i));
+
+    FbxAnimLayer* layer = layers.empty() ? nullptr : layers[0];
+    if (!layer)
+    {
+        BatchLog() << "AnimLayer ϴ.\n";
+        return false;
+    }
+
+    const float timeScale = 1.0f;
+    const double startSec = timeSpan.GetStart().GetSecondDouble();
+    const double endSec = timeSpan.GetStop().GetSecondDouble();
+    float duration = (float)((endSec - startSec) * timeScale);
+
+    // Ŭ ̸
+    string clipName;
+    const char* stackNameC = stack->GetName();
+    if (stackNameC && stackNameC[0] != '\0') clipName = stackNameC;
+    else                                     clipName = name;
+
+    // -----------------------------
+    // Track 
+    // -----------------------------
+    vector<TrackBin> tracks;
+    unordered_map<string, int> nameToTrack;
+
+    vector<string> probe = { "Bind_Hips", "Bind_Spine", "Bind_LeftHand", "Bind_RightHand" };
+
+    DumpAnimExtractorDebug(
+        "PRE-EXTRACT",
+        scene, stack, layer, timeSpan,
+        nullptr, nullptr,      // tracks/nameToTrack  
+        probe,
+        timeScale);
+
+
+    vector<NodeSampleJob> jobs;
+    TraverseAndExtractTracks(
+        scene->GetRootNode(),
+        layers,
+        timeSpan,
+        timeScale,
+        tracks,
+        nameToTrack,
+        jobs);
+
+    EvaluateSampleJobs(clipName, layers, jobs);
+    MergeSampleJobsIntoTracks(jobs, tracks);
+
+    DumpAnimExtractorDebug(
+        "POST-EXTRACT",
+        scene, stack, layer, timeSpan,
+        &tracks, &nameToTrack,
+        probe,
+        timeScale);
+
+    if (tracks.empty())
+    {
+        BatchLog() << "Ű  ʽϴ.\n";
+        return false;
+    }
+
+    // -----------------------------
+    // 0(T) : minTime ŭ ü shift
+    // -----------------------------
+    float minTime = FLT_MAX;
+    for (auto& tr : tracks)
+        for (auto& k : tr.keys)
+            if (k.timeSec > 0.0f && k.timeSec < minTime)
+                minTime = k.timeSec;
+
+    if (minTime != FLT_MAX)
+    {
+        auto shiftKeys = [minTime](vector<KeyframeBin>& keys)
             {
-                for (auto& k : tr.keys)
+                for (auto& k : keys)
                     k.timeSec -= minTime;
 
-                tr.keys.erase(
-                    remove_if(tr.keys.begin(), tr.keys.end(),
+                keys.erase(
+                    remove_if(keys.begin(), keys.end(),
                         [](const KeyframeBin& k) { return k.timeSec < 0.0f; }),
-                    tr.keys.end());
-            }
+                    keys.end());
+            };
 
-            duration -= minTime;
-            if (duration < 0.0f) duration = 0.0f;
+        for (auto& tr : tracks)
+        {
+            shiftKeys(tr.keys);
+            if (SPLIT_TRACK_CHANNELS)
+                for (auto& ck : tr.channelKeys) shiftKeys(ck);
         }
 
-        // -----------------------------
-        // BIN 
-        // -----------------------------
-        ofstream out(binFileName, std::ios::binary);
-        if (!out.is_open())
+        duration -= minTime;
+        if (duration < 0.0f) duration = 0.0f;
+    }
+
+    if (SPLIT_TRACK_CHANNELS)
+        for (auto& tr : tracks) AlignChannelKeyStart(tr);
+
+    if (REDUCE_KEYFRAMES && !WRITE_ABIN_UNIFORM)
+        ReduceClipKeys(clipName, tracks);
+
+    const uint64_t* skeletonHash = nullptr;
+    if (BIND_TRACKS_TO_SKELETON)
+    {
+        const ExportSkeleton& skeleton = GetExportSkeleton();
+        if (!skeleton.loaded)
         {
-            cout << "BIN   : " << binFileName << "\n";
-            scene->Destroy();
-            continue;
+            BatchLog() << "̷ MBIN б : " << kSkeletonModelBinPath << " (" << skeleton.error << ")\n";
+            return false;
         }
+        if (!BindTracksToSkeleton(clipName, tracks, skeleton))
+        {
+            BatchLog() << "̷濡 ´ Ʈ ϴ.\n";
+            return false;
+        }
+        skeletonHash = &skeleton.hash;
+    }
+
+    // -----------------------------
+    // BIN 
+    // -----------------------------
+    size_t reserveBytes = 64 + clipName.size();
+    for (const auto& tr : tracks)
+        reserveBytes += 16 + tr.boneName.size() + tr.keys.size() * sizeof(KeyframeBin);
 
-        // Header
-        char magic[4] = { 'A','B','I','N' };
-        WriteRaw(out, magic, 4);
-        WriteUInt32(out, 1); // version
+    BinaryWriter out;
+    out.Reserve(reserveBytes);
 
-        // Clip
-        WriteStringUtf8(out, clipName);
-        WriteFloat(out, duration);
+    // v3  ũ   Ʈ  
+    vector<vector<KeyframeBin>> uniformSamples;
+    uint32_t frameCount = 0;
+    if (WRITE_ABIN_UNIFORM || BAKE_CROWD_PALETTE)
+    {
+        const double clipStartSec = startSec + ((minTime != FLT_MAX) ? minTime : 0.0f) / timeScale;
+        frameCount = SampleClipUniform(clipName, layers, tracks, clipStartSec, duration, timeScale, kUniformSampleRate, uniformSamples);
+    }
 
-        WriteUInt32(out, (uint32_t)tracks.size());
+    bool wroteV2 = false;
+    if (WRITE_ABIN_UNIFORM)
+    {
+        out.Reserve(reserveBytes + kAbinUniformFrameAlignment + (size_t)frameCount * tracks.size() * kAbinUniformBytesPerTrack);
+        WriteClipUniform(out, clipName, duration, kUniformSampleRate, skeletonHash, tracks, uniformSamples, frameCount);
 
-        for (auto& tr : tracks)
+        BatchLog() << "ABIN v3 [" << clipName << "]: " << frameCount << " (" << kUniformSampleRate << "Hz)"
+            << ", Ʈ " << tracks.size() << ", " << out.Size() << " bytes\n";
+    }
+    else if (WRITE_ABIN_V2)
+    {
+        const double frameRate = GetSceneFrameRate(scene);
+        ClipV2Stats stats;
+        wroteV2 = WriteClipV2(out, clipName, duration, frameRate, skeletonHash, tracks, stats);
+        if (wroteV2)
+        {
+            BinaryWriter v1;
+            v1.Reserve(reserveBytes);
+            WriteClipV1(v1, clipName, duration, tracks);
+
+            BatchLog() << "ABIN v2 [" << clipName << "]: " << v1.Size() << " -> " << out.Size() << " bytes ("
+                << (100.0 * (double)out.Size() / (double)v1.Size()) << "%)"
+                << ",  ä " << stats.constantChannels << "/" << stats.channels;
+            if (SPLIT_TRACK_CHANNELS)
+                BatchLog() << ", ð ̺ " << stats.timeTables << " (ִϸ̼ ä " << (stats.channels - stats.constantChannels) << ")";
+            BatchLog()
+                << ", ִ  T=" << stats.maxTranslationError << "m R=" << stats.maxRotationErrorDeg
+                << "deg S=" << stats.maxScaleError << " time=" << stats.maxTimeError << "s\n";
+        }
+        else
         {
-            WriteStringUtf8(out, tr.boneName);
-            WriteInt32(out, -1); // boneIndex placeholder (Ÿӿ ̸  )
+            BatchLog() << "ABIN v2 [" << clipName << "]: " << stats.fallbackReason << " (" << frameRate << "fps), v1 \n";
+        }
+    }
 
-            WriteUInt32(out, (uint32_t)tr.keys.size());
+    if (!WRITE_ABIN_UNIFORM && !wroteV2)
+        WriteClipV1(out, clipName, duration, tracks);
 
-            for (auto& k : tr.keys)
-            {
-                WriteFloat(out, k.timeSec);
+    if (!SubmitBinaryFile(binFileName, std::move(out)).get())
+    {
+        BatchLog() << "BIN   : " << binFileName << "\n";
+        return false;
+    }
+    BatchLog() << "ִϸ̼ BIN  Ϸ: " << binFileName << "\n";
+    outOutputs.push_back(binFileName);
 
-                WriteFloat(out, k.tx);
-                WriteFloat(out, k.ty);
-                WriteFloat(out, k.tz);
+    if (BAKE_CROWD_PALETTE)
+    {
+        const string bakeFileName = BuildCrowdBakeFilePath(binFileName);
+        BinaryWriter bake;
+        if (!BakeCrowdClip(bake, clipName, duration, kUniformSampleRate, tracks, uniformSamples, frameCount))
+            return false;
 
-                WriteFloat(out, k.rx);
-                WriteFloat(out, k.ry);
-                WriteFloat(out, k.rz);
-                WriteFloat(out, k.rw);
+        if (!SubmitBinaryFile(bakeFileName, std::move(bake)).get())
+        {
+            BatchLog() << "BIN   : " << bakeFileName << "\n";
+            return false;
+        }
+        BatchLog() << " ũ BIN  Ϸ: " << bakeFileName << "\n";
+        outOutputs.push_back(bakeFileName);
+    }
+    return true;
+}
 
-                WriteFloat(out, k.sx);
-                WriteFloat(out, k.sy);
-                WriteFloat(out, k.sz);
-            }
+bool ExportAnimationScene(
+    FbxScene* scene,
+    const string& name,
+    const string& exportDir,
+    bool skipIfEmpty,
+    vector<string>& outOutputs)
+{
+    vector<FbxAnimStack*> stacks;
+    if (EXPORT_ALL_ANIM_STACKS)
+    {
+        for (int i = 0; i < scene->GetSrcObjectCount<FbxAnimStack>(); ++i)
+            stacks.push_back(scene->GetSrcObject<FbxAnimStack>(i));
+    }
+    else
+    {
+        FbxAnimStack* stack = scene->GetCurrentAnimationStack();
+        if (!stack && scene->GetSrcObjectCount<FbxAnimStack>() > 0)
+            stack = scene->GetSrcObject<FbxAnimStack>(0);
+        if (stack)
+            stacks.push_back(stack);
+    }
+
+    if (stacks.empty())
+    {
+        if (skipIfEmpty)
+        {
+            BatchLog() << "ִϸ̼  : ABIN \n";
+            return true;
         }
 
-        out.close();
-        cout << "ִϸ̼ BIN  Ϸ: " << binFileName << "\n";
+        BatchLog() << "ִϸ̼  ϴ.\n";
+        return false;
+    }
+
+    if (stacks.size() == 1)
+        return ExportAnimationStack(scene, stacks[0], name, BuildAnimBinFilePath(exportDir, name), outOutputs);
 
-        scene->Destroy();
+    // ũ ϳ ص   ( )
+    bool ok = true;
+    size_t exported = 0;
+    std::set<string> usedNames;
+    for (size_t i = 0; i < stacks.size(); ++i)
+    {
+        FbxAnimStack* stack = stacks[i];
+        const char* stackNameC = stack->GetName();
+        const string stackName = (stackNameC && stackNameC[0] != '\0') ? string(stackNameC) : "take" + to_string(i);
+        const string base = name + "_" + SanitizeStackFileName(stackName);
+        string fileStem = base;
+        for (int n = 2; !usedNames.insert(fileStem).second; ++n)
+            fileStem = base + "_" + to_string(n);
+
+        BatchLog() << "\n---- ũ: " << SafeNameStack(stack) << " -> " << fileStem << ".bin\n";
+        if (ExportAnimationStack(scene, stack, name, BuildAnimBinFilePath(exportDir, fileStem), outOutputs))
+            ++exported;
+        else
+            ok = false;
     }
 
-    manager->Destroy();
-    return 0;
+    BatchLog() << "ִϸ̼  " << stacks.size() << "  " << exported << " ABIN \n";
+    return ok;
+}
+
+} // namespace AnimeBin
+
+//  (UnifiedBinExtractor)    Լ  
+#ifndef UNIFIED_BIN_EXTRACTOR
+
+// ======================================================================
+// ִϸ̼ FBX  ϳ ó (ġ ۾ )
+// ======================================================================
+
+static bool ExportAnimationFile(
+    FbxManager* manager,
+    const BatchExportJob& job,
+    const string& exportDir,
+    vector<string>& outOutputs)
+{
+    const string fbxFileName = job.fbxPath.string();
+
+    BatchLog() << "\n==========================================\n";
+    BatchLog() << "ó : " << fbxFileName << "\n";
+
+    FbxScene* scene = ImportFbxScene(manager, fbxFileName, "AnimScene_" + job.stem);
+    if (!scene) return false;
+
+    // DirectX ǥ + meter  ȯ (ִϸ̼Ǹ Ƿ Triangulate ʿ)
+    ConvertSceneToExportSpace(scene);
+
+    const bool ok = AnimeBin::ExportAnimationScene(scene, job.stem, exportDir, false, outOutputs);
+
+    scene->Destroy();
+    return ok;
+}
+
+// ======================================================================
+// main: ִϸ̼ FBX  ִϸ̼ BIN(ABIN) 
+// ======================================================================
+
+// ġ : Ŀ  0 = ھ , ޸  0 =  
+static constexpr unsigned kBatchWorkerCount = 0;
+static constexpr uint64_t kBatchMemoryBudgetBytes = 16ull << 30;
+static constexpr double kBatchPeakBytesPerFileByte = 8.0;
+
+int main()
+{
+    string importDir = "import";
+    string exportDir = "export";
+
+    namespace fs = std::filesystem;
+
+    //   
+    std::error_code ec;
+    fs::create_directories(exportDir, ec);
+
+    // ================================================
+    // import  *.fbx  ִϸ̼ BIN 
+    // (Ŀ FBX SDK Ŵ  )
+    // ================================================
+    BatchExportSettings batchSettings{};
+    batchSettings.workerCount = kBatchWorkerCount;
+    batchSettings.memoryBudgetBytes = kBatchMemoryBudgetBytes;
+    batchSettings.peakBytesPerFileByte = kBatchPeakBytesPerFileByte;
+
+    const vector<BatchExportJob> jobs = CollectBatchExportJobs(importDir, batchSettings);
+
+    ExportCache cache(exportDir + "/.exportcache_anime", AnimeBin::ComputeExportSettingsHash());
+    cache.Load();
+
+    const BatchExportSummary summary = RunBatchExport(jobs, batchSettings,
+        [&](FbxManager* manager, const BatchExportJob& job)
+        {
+            return RunCachedExportJob(cache, job,
+                [&](vector<string>& outputs)
+                {
+                    return ExportAnimationFile(manager, job, exportDir, outputs);
+                });
+        });
+
+    PrintBatchExportSummary(summary, jobs.size());
+    cache.PrintSummary();
+    if (!cache.Save())
+        cout << "ĳ   \n";
+    return (summary.failed == 0) ? 0 : 1;
 }
+
+#endif // UNIFIED_BIN_EXTRACTOR
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// ==========================================================
+// ߿ ũ Ŭ 'ABAK' (AnimeBinExtractor BAKE_CROWD_PALETTE,  δ )
+// - Ų MBIN ̷ + ABIN Ŭ  Ʈ ̸  Ű  ȷƮ
+//   -> νϽ  /   (clip, frame) ؽó б⸸ Ű
+// -   = ؽó  ̶ ȷƮ/  ״ RGBA32F (ABAK_FLAG_HALF RGBA16F) ؽó ø
+//
+// ġ (Ʋ )
+//   'ABAK', uint32 version(1), uint32 flags (AbakFlags), uint64 skeletonHash (ComputeMbinSkeletonHash)
+//   string clipName (uint16  + UTF-8), float duration, float sampleRate
+//   uint32 frameCount, uint32 boneCount, uint32 vertexCount (ABAK_FLAG_VERTICES ƴϸ 0)
+//   0 е  տ 16Ʈ 
+//   ȷƮ: Ӹ  ,  =  ؼ 3 (boneCount * 3 ؼ)
+//     ؼ c = Ű  (offsetMatrix * ִϸ̼ ۷ι,  )   c (m[0][c], m[1][c], m[2][c], m[3][c])
+//     -> p'.c = dot(float4(p, 1), texel c),  w = 0
+//   ABAK_FLAG_VERTICES ̾ (ϸ 16Ʈ )
+//     ġ: Ӹ  ,  ؼ (x, y, z, 1)
+//     : Ӹ  ,  ؼ (x, y, z, 0), ȭ
+//       = ޽ MBIN ޽  ̾   (޽  =  ޽ vertexCount )
+// -  f = Ŭ ð f / sampleRate, frameCount = ceil(duration * sampleRate) + 1 (ABIN v3  Ģ)
+//     ̴ /ġ ״ lerp ( LOD, ȸ ū  sampleRate ø )
+// ==========================================================
+
+static constexpr uint32_t kAbakVersion = 1;
+static constexpr size_t kAbakBlockAlignment = 16;
+static constexpr uint32_t kAbakTexelsPerBone = 3;
+
+enum AbakFlags : uint32_t
+{
+    ABAK_FLAG_HALF = 1u << 0,      // ؼ  fp16 (ƴϸ float32)
+    ABAK_FLAG_VERTICES = 1u << 1,  // ȷƮ ڿ  ġ/ 
+};
+
+inline size_t GetAbakTexelBytes(uint32_t flags)
+{
+    return (flags & ABAK_FLAG_HALF) ? sizeof(uint16_t) * 4 : sizeof(float) * 4;
+}
+
+// float -> IEEE half (  , ¦ ݿø).   inf,    /0
+inline uint16_t FloatToAbakHalf(float f)
+{
+    uint32_t x;
+    std::memcpy(&x, &f, sizeof(x));
+
+    const uint32_t sign = (x >> 16) & 0x8000u;
+    const uint32_t biased = (x >> 23) & 0xFFu;
+    uint32_t mantissa = x & 0x7FFFFFu;
+
+    if (biased == 0xFFu)
+        return static_cast<uint16_t>(sign | 0x7C00u | (mantissa ? 0x200u : 0u));
+
+    const int32_t exponent = static_cast<int32_t>(biased) - 127 + 15;
+    if (exponent >= 31)
+        return static_cast<uint16_t>(sign | 0x7C00u);
+
+    if (exponent <= 0)
+    {
+        if (exponent < -10)
+            return static_cast<uint16_t>(sign);
+
+        mantissa |= 0x800000u;
+        const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+        uint32_t h = mantissa >> shift;
+        const uint32_t rest = mantissa & ((1u << shift) - 1);
+        const uint32_t halfway = 1u << (shift - 1);
+        if (rest > halfway || (rest == halfway && (h & 1u))) ++h;
+        return static_cast<uint16_t>(sign | h);
+    }
+
+    // ݿø ø  Ѿ ״ ´  (ִ  inf)
+    uint32_t h = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+    const uint32_t rest = mantissa & 0x1FFFu;
+    if (rest > 0x1000u || (rest == 0x1000u && (h & 1u))) ++h;
+    return static_cast<uint16_t>(sign | h);
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// ==========================================================
+// ABIN ִϸ̼ Ŭ  (AnimeBinExtractor,  δ )
+// - v1: Ʈ Ű = float 11 (time, T xyz, R xyzw, S xyz) ״
+//   'ABIN', uint32 version(1), string clipName, float duration, uint32 trackCount
+//   Ʈ string boneName, int32 boneIndex, uint32 keyCount, Ű x keyCount
+// - v2: ȭ Ŭ (Ʒ),  Ŭ v1 1/4~1/8 
+// - v3:  Ʈ  켱 Ŭ (Ʒ), Ű Ž   ȣ  +   lerp
+//
+// v2 ġ (Ʋ ,  )
+//   'ABIN', uint32 version(2), uint32 flags (AbinClipFlags)
+//   ABIN_CLIP_SKELETON_BOUND uint64 skeletonHash
+//   string clipName (uint16  + UTF-8), float duration, float frameRate, uint32 trackCount
+//   Ʈ
+//     string boneName, int32 boneIndex, uint32 keyCount, uint32 trackFlags (AbinTrackFlags)
+//     T :  float[3] , ƴϸ float min[3] + float extent[3]
+//     R :  float[4] (x, y, z, w)
+//     S : T 
+//     keyCount > 0 ̸ ( ƴ ä ϳ  ,   keyCount = 0)
+//       uint16 frame x keyCount                  (time = frame / frameRate)
+//       ִϸ̼ T : uint16 x3 x keyCount      (value = min + q / 65535 * extent)
+//       ִϸ̼ R : AbinPackedQuat x keyCount (smallest-three 48Ʈ)
+//       ִϸ̼ S : uint16 x3 x keyCount
+//   ABIN_CLIP_SPLIT_CHANNELS Ʈ κ ä и ġ (T/R/S  ڱ Ű ð)
+//     uint32 timeTableCount, ̺ uint32 keyCount + uint16 frame x keyCount
+//       (  迭  , ä ̺ ȣ )
+//     Ʈ
+//       string boneName, int32 boneIndex, uint32 trackFlags
+//       T :  float[3] , ƴϸ uint32 timeTable + float min[3] + float extent[3] + uint16 x3 x keyCount
+//       R :  float[4], ƴϸ uint32 timeTable + AbinPackedQuat x keyCount
+//       S : T 
+//     (keyCount =  ̺ , äθ ù  )
+//
+// v3 ġ (Ʋ )
+//   'ABIN', uint32 version(3), uint32 flags (AbinClipFlags, SKELETON_BOUND ǹ )
+//   ABIN_CLIP_SKELETON_BOUND uint64 skeletonHash
+//   string clipName, float duration, float sampleRate, uint32 frameCount, uint32 trackCount
+//   Ʈ string boneName, int32 boneIndex
+//   0 е  տ 16Ʈ 
+//   Ӹ (frame f = ð f / sampleRate, frameCount = ceil(duration * sampleRate) + 1)
+//       duration    ִ -> Ÿ ð [0, duration]   
+//     R : float4 (x, y, z, w) x trackCount
+//     T : float4 (x, y, z, 0) x trackCount
+//     S : float4 (x, y, z, 1) x trackCount
+//   ->   = 48 * trackCount Ʈ,  float4     ״ SIMD lerp
+//   ȸ Ʈ  Ӱ ݱ  (nlerp ȣ ˻ ʿ)
+// - boneIndex: ̷濡  Ŭ(ABIN_CLIP_SKELETON_BOUND)̸ Ų MBIN  ȣ,
+//   Ʈ  ȣ . ƴϸ -1 (Ÿ ̸ )
+//   skeletonHash = ComputeMbinSkeletonHash (MbinSkeleton.h), Ÿ ̷  ̸   ٷ ε
+//   v1 ؽø   ʵ尡  ׻ -1 (v2 v1 ü  Ŭ )
+// - ȸ ̿ Ű  >= 0 ǵ ȣ   (ݱ ) ȣ ؼ 
+//   -> Ÿ ̿ Ű ̸ ȣ ˻  nlerp/slerp
+// ==========================================================
+
+static constexpr uint32_t kAbinVersion1 = 1;
+static constexpr uint32_t kAbinVersion2 = 2;
+static constexpr uint32_t kAbinVersion3 = 3;
+
+static constexpr size_t kAbinUniformFrameAlignment = 16;
+static constexpr size_t kAbinUniformBytesPerTrack = sizeof(float) * 12; // R, T, S float4
+
+enum AbinClipFlags : uint32_t
+{
+    ABIN_CLIP_SKELETON_BOUND = 1u << 0,
+    ABIN_CLIP_SPLIT_CHANNELS = 1u << 1,
+};
+
+enum AbinTrackFlags : uint32_t
+{
+    ABIN_TRACK_CONSTANT_T = 1u << 0,
+    ABIN_TRACK_CONSTANT_R = 1u << 1,
+    ABIN_TRACK_CONSTANT_S = 1u << 2,
+};
+
+// 48Ʈ = uint16 x3 (v[0] )
+//   bit 0~1   :  (밪 ִ) ȣ (0=x 1=y 2=z 3=w)
+//   bit 2     :   ȣ (1 = )
+//   bit 3~47  :    15Ʈ (), [-1/sqrt2, 1/sqrt2] յ
+struct AbinPackedQuat
+{
+    uint16_t v[3];
+};
+static_assert(sizeof(AbinPackedQuat) == 6, "AbinPackedQuat must be 6 bytes");
+
+static constexpr float kAbinQuatComponentRange = 0.70710678118654752f; // 1/sqrt2
+static constexpr uint32_t kAbinQuatComponentMax = (1u << 15) - 1;
+
+// q ȭ (x, y, z, w)
+inline AbinPackedQuat PackAbinQuat(const float q[4])
+{
+    int largest = 0;
+    for (int i = 1; i < 4; ++i)
+        if (std::fabs(q[i]) > std::fabs(q[largest])) largest = i;
+
+    uint64_t bits = static_cast<uint64_t>(largest) | (q[largest] < 0.0f ? 4ull : 0ull);
+
+    int shift = 3;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (i == largest) continue;
+        const float u = (q[i] / kAbinQuatComponentRange) * 0.5f + 0.5f;
+        const float c = std::min(std::max(u, 0.0f), 1.0f);
+        const uint64_t qc = static_cast<uint64_t>(c * kAbinQuatComponentMax + 0.5f);
+        bits |= qc << shift;
+        shift += 15;
+    }
+
+    AbinPackedQuat p;
+    p.v[0] = static_cast<uint16_t>(bits);
+    p.v[1] = static_cast<uint16_t>(bits >> 16);
+    p.v[2] = static_cast<uint16_t>(bits >> 32);
+    return p;
+}
+
+inline void UnpackAbinQuat(const AbinPackedQuat& p, float out[4])
+{
+    const uint64_t bits = uint64_t(p.v[0]) | (uint64_t(p.v[1]) << 16) | (uint64_t(p.v[2]) << 32);
+    const int largest = static_cast<int>(bits & 3);
+    const bool negative = (bits & 4) != 0;
+
+    float sum = 0.0f;
+    int shift = 3;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (i == largest) continue;
+        const uint32_t qc = static_cast<uint32_t>(bits >> shift) & kAbinQuatComponentMax;
+        out[i] = (static_cast<float>(qc) / kAbinQuatComponentMax * 2.0f - 1.0f) * kAbinQuatComponentRange;
+        sum += out[i] * out[i];
+        shift += 15;
+    }
+
+    const float w = std::sqrt(std::max(0.0f, 1.0f - sum));
+    out[largest] = negative ? -w : w;
+}
+
+// Ʈ   unorm16 (extent 0̸ ׻ min)
+inline uint16_t QuantizeAbinUnorm16(float value, float minValue, float extent)
+{
+    if (extent <= 0.0f) return 0;
+    const float u = std::min(std::max((value - minValue) / extent, 0.0f), 1.0f);
+    return static_cast<uint16_t>(u * 65535.0f + 0.5f);
+}
+
+inline float DequantizeAbinUnorm16(uint16_t q, float minValue, float extent)
+{
+    return minValue + static_cast<float>(q) / 65535.0f * extent;
+}
+
+// v3: ð ->   Ӱ  (O(1),   ù/  Ŭ)
+inline void GetAbinUniformFrameBlend(
+    float time,
+    float sampleRate,
+    uint32_t frameCount,
+    uint32_t& outFrame0,
+    uint32_t& outFrame1,
+    float& outBlend)
+{
+    outFrame0 = outFrame1 = 0;
+    outBlend = 0.0f;
+    if (frameCount < 2) return;
+
+    const float f = std::min(std::max(time * sampleRate, 0.0f), static_cast<float>(frameCount - 1));
+    outFrame0 = std::min(static_cast<uint32_t>(f), frameCount - 2);
+    outFrame1 = outFrame0 + 1;
+    outBlend = f - static_cast<float>(outFrame0);
+}
+
+// v3:   (48 * trackCount Ʈ)  out ( ġ)
+// ȸ nlerp,  float4   Ϸ ״ ȭ
+inline void BlendAbinUniformFrames(
+    const float* frame0,
+    const float* frame1,
+    uint32_t trackCount,
+    float blend,
+    float* out)
+{
+    const size_t floatCount = static_cast<size_t>(trackCount) * 12;
+    for (size_t i = 0; i < floatCount; ++i)
+        out[i] = frame0[i] + (frame1[i] - frame0[i]) * blend;
+
+    for (uint32_t t = 0; t < trackCount; ++t)
+    {
+        float* q = out + static_cast<size_t>(t) * 4;
+        const float len = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+        if (len > 0.0f)
+            for (int i = 0; i < 4; ++i) q[i] /= len;
+    }
+}
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <fbxsdk.h>
+
+// ==========================================================
+// ġ ͽƮ (Static / Skinned / Anime  )
+// - Ŀ 帶 FbxManager ϳ д.
+//   (FBX SDK Ŵ θ  и )
+// - ū Ϻ ó:  ū  ϳ  ھ   
+// -  ũ ޸    ʵ  Ʈ  
+// - ۾ α״ ۿ Ҵٰ ۾    
+// ==========================================================
+
+struct BatchExportJob
+{
+    std::filesystem::path fbxPath;
+    std::string stem;
+    uint64_t fileBytes = 0;
+    uint64_t estimatedPeakBytes = 0;
+};
+
+struct BatchExportSettings
+{
+    unsigned workerCount = 0;                  // 0 = hardware_concurrency
+    uint64_t memoryBudgetBytes = 0;            // 0 =  
+    double peakBytesPerFileByte = 16.0;        // FBX Ʈ/ȯ ũ  
+    uint64_t peakBytesFixed = 64ull << 20;     // ۾  
+};
+
+struct BatchExportSummary
+{
+    size_t succeeded = 0;
+    size_t failed = 0;
+};
+
+// ۾ ϳ ó:   true
+using BatchExportJobFunc = std::function<bool(FbxManager* manager, const BatchExportJob& job)>;
+
+// ==========================================================
+// ۾ α 
+// ==========================================================
+
+inline std::ostringstream*& BatchJobLogSlot()
+{
+    static thread_local std::ostringstream* slot = nullptr;
+    return slot;
+}
+
+inline std::ostream& BatchLog()
+{
+    std::ostringstream* slot = BatchJobLogSlot();
+    return slot ? static_cast<std::ostream&>(*slot) : std::cout;
+}
+
+inline std::mutex& BatchConsoleMutex()
+{
+    static std::mutex m;
+    return m;
+}
+
+//  ó  ġ ۾  (  ȭ ھ    )
+inline std::atomic<unsigned>& BatchActiveJobCount()
+{
+    static std::atomic<unsigned> count{ 0 };
+    return count;
+}
+
+// ==========================================================
+// ޸ :  ũ Ʈ  
+// - 꺸 ū ۾  ü ´ (= ܵ )
+// ==========================================================
+
+class BatchMemoryBudget
+{
+public:
+    explicit BatchMemoryBudget(uint64_t budgetBytes) : m_budget(budgetBytes) {}
+
+    uint64_t Acquire(uint64_t bytes)
+    {
+        if (m_budget == 0) return 0;
+
+        const uint64_t want = std::min(bytes, m_budget);
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [&] { return m_inUse + want <= m_budget; });
+        m_inUse += want;
+        return want;
+    }
+
+    void Release(uint64_t granted)
+    {
+        if (granted == 0) return;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_inUse -= granted;
+        }
+        m_cv.notify_all();
+    }
+
+private:
+    uint64_t m_budget = 0;
+    uint64_t m_inUse = 0;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+};
+
+// ==========================================================
+// import  *.fbx  -> ū   
+// ==========================================================
+
+inline std::vector<BatchExportJob> CollectBatchExportJobs(
+    const std::string& importDir,
+    const BatchExportSettings& settings)
+{
+    namespace fs = std::filesystem;
+
+    std::vector<BatchExportJob> jobs;
+
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(importDir, ec))
+    {
+        if (!entry.is_regular_file()) continue;
+
+        const fs::path& path = entry.path();
+        if (path.extension() != ".fbx") continue;
+
+        BatchExportJob job{};
+        job.fbxPath = path;
+        job.stem = path.stem().string();
+
+        std::error_code sizeEc;
+        const uintmax_t size = fs::file_size(path, sizeEc);
+        job.fileBytes = sizeEc ? 0 : static_cast<uint64_t>(size);
+        job.estimatedPeakBytes =
+            settings.peakBytesFixed +
+            static_cast<uint64_t>(static_cast<double>(job.fileBytes) * settings.peakBytesPerFileByte);
+
+        jobs.push_back(std::move(job));
+    }
+
+    if (ec)
+    {
+        std::cout << "import    ϴ: " << importDir << " (" << ec.message() << ")\n";
+    }
+
+    std::sort(jobs.begin(), jobs.end(),
+        [](const BatchExportJob& a, const BatchExportJob& b)
+        {
+            if (a.fileBytes != b.fileBytes) return a.fileBytes > b.fileBytes;
+            return a.fbxPath < b.fbxPath;
+        });
+
+    return jobs;
+}
+
+// ==========================================================
+// Ŀ Ǯ 
+// ==========================================================
+
+inline BatchExportSummary RunBatchExport(
+    const std::vector<BatchExportJob>& jobs,
+    const BatchExportSettings& settings,
+    const BatchExportJobFunc& runJob)
+{
+    BatchExportSummary summary{};
+    if (jobs.empty()) return summary;
+
+    unsigned workerCount = settings.workerCount;
+    if (workerCount == 0)
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    if (workerCount > jobs.size())
+        workerCount = static_cast<unsigned>(jobs.size());
+
+    BatchMemoryBudget budget(settings.memoryBudgetBytes);
+
+    std::atomic<size_t> nextJob{ 0 };
+    std::atomic<size_t> succeeded{ 0 };
+    std::atomic<size_t> failed{ 0 };
+
+    auto Worker = [&]()
+        {
+            FbxManager* manager = FbxManager::Create();
+            if (!manager)
+            {
+                std::lock_guard<std::mutex> lock(BatchConsoleMutex());
+                std::cout << "FBX Manager  .\n";
+                return;
+            }
+
+            FbxIOSettings* ios = FbxIOSettings::Create(manager, IOSROOT);
+            manager->SetIOSettings(ios);
+
+            for (;;)
+            {
+                const size_t jobIndex = nextJob.fetch_add(1);
+                if (jobIndex >= jobs.size()) break;
+
+                const BatchExportJob& job = jobs[jobIndex];
+                const uint64_t granted = budget.Acquire(job.estimatedPeakBytes);
+
+                std::ostringstream jobLog;
+                BatchJobLogSlot() = &jobLog;
+                ++BatchActiveJobCount();
+
+                bool ok = false;
+                try
+                {
+                    ok = runJob(manager, job);
+                }
+                catch (const std::exception& e)
+                {
+                    jobLog << " ߻: " << job.fbxPath.string() << " : " << e.what() << "\n";
+                    ok = false;
+                }
+
+                --BatchActiveJobCount();
+                BatchJobLogSlot() = nullptr;
+                budget.Release(granted);
+
+                if (ok) ++succeeded;
+                else    ++failed;
+
+                std::lock_guard<std::mutex> lock(BatchConsoleMutex());
+                std::cout << jobLog.str();
+                std::cout.flush();
+            }
+
+            manager->Destroy();
+        };
+
+    if (workerCount <= 1)
+    {
+        Worker();
+    }
+    else
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(workerCount);
+        for (unsigned i = 0; i < workerCount; ++i)
+            workers.emplace_back(Worker);
+        for (std::thread& t : workers)
+            t.join();
+    }
+
+    summary.succeeded = succeeded.load();
+    summary.failed = failed.load();
+
+    // Ŵ    ƹ   ۾ з 
+    const size_t handled = summary.succeeded + summary.failed;
+    if (handled < jobs.size())
+        summary.failed += jobs.size() - handled;
+
+    return summary;
+}
+
+inline void PrintBatchExportSummary(const BatchExportSummary& summary, size_t jobCount)
+{
+    std::cout << "\n==========================================\n";
+    std::cout << "ġ Ϸ: ü " << jobCount
+        << " /  " << summary.succeeded
+        << " /  " << summary.failed << "\n";
+}
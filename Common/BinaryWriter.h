@@ -0,0 +1,216 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+// ==========================================================
+//   ̳ʸ  (Static / Skinned / Anime  )
+// -  ϳ з ̸ ũ⸦   ۿ ״´
+//   (ʵ帶 ofstream::write ϴ  )
+// -   ׶ I/O 尡 ū    ó
+// - <path>.tmp     rename:     
+// ==========================================================
+
+class BinaryWriter
+{
+public:
+    void Reserve(size_t bytes) { m_bytes.reserve(bytes); }
+
+    void WriteRaw(const void* data, size_t size)
+    {
+        if (size == 0) return;
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        m_bytes.insert(m_bytes.end(), p, p + size);
+    }
+
+    //   ġ alignment  (0 ä)
+    void PadTo(size_t alignment)
+    {
+        const size_t rem = m_bytes.size() % alignment;
+        if (rem != 0)
+            m_bytes.resize(m_bytes.size() + (alignment - rem), 0);
+    }
+
+    size_t Size() const { return m_bytes.size(); }
+    const uint8_t* Data() const { return m_bytes.data(); }
+
+    std::vector<uint8_t> TakeBytes() { return std::move(m_bytes); }
+
+private:
+    std::vector<uint8_t> m_bytes;
+};
+
+// ----------------------------------------------------------
+// ӽ Ͽ  rename ()
+// ----------------------------------------------------------
+inline bool WriteFileAtomic(const std::string& path, const void* data, size_t size)
+{
+    namespace fs = std::filesystem;
+
+    //   ʹ ū write Ѵ (Ϻ CRT 2GB ̻ write  )
+    static constexpr size_t kMaxChunkBytes = 64ull << 20;
+
+    const std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) return false;
+
+        const char* p = static_cast<const char*>(data);
+        size_t remaining = size;
+        while (remaining > 0 && out)
+        {
+            const size_t chunk = std::min(remaining, kMaxChunkBytes);
+            out.write(p, static_cast<std::streamsize>(chunk));
+            p += chunk;
+            remaining -= chunk;
+        }
+
+        out.close();
+        if (!out)
+        {
+            std::error_code ec;
+            fs::remove(tmpPath, ec);
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    fs::rename(tmpPath, path, ec);
+    if (ec)
+    {
+        //  rename  Ǵ ȯ:  õ
+        fs::remove(path, ec);
+        fs::rename(tmpPath, path, ec);
+    }
+    if (ec)
+    {
+        std::error_code ignore;
+        fs::remove(tmpPath, ignore);
+        return false;
+    }
+    return true;
+}
+
+// ----------------------------------------------------------
+// ׶ I/O  (μ ϳ,  ġ Ŀ )
+// -   Ʈ ѵ  Submit ٸ (޸  )
+// ----------------------------------------------------------
+class BackgroundFileWriter
+{
+public:
+    static constexpr uint64_t kMaxQueuedBytes = 1ull << 30;
+
+    BackgroundFileWriter()
+        : m_thread([this] { Run(); })
+    {
+    }
+
+    ~BackgroundFileWriter()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+    }
+
+    BackgroundFileWriter(const BackgroundFileWriter&) = delete;
+    BackgroundFileWriter& operator=(const BackgroundFileWriter&) = delete;
+
+    std::future<bool> Submit(std::string path, std::vector<uint8_t> bytes)
+    {
+        Request req{};
+        req.path = std::move(path);
+        req.bytes = std::move(bytes);
+        std::future<bool> done = req.done.get_future();
+
+        const uint64_t size = req.bytes.size();
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            // ť   ѵ ϰ ޴´ (ѵ ū  ϳ)
+            m_spaceCv.wait(lock, [&] { return m_queue.empty() || m_queuedBytes + size <= kMaxQueuedBytes; });
+            m_queuedBytes += size;
+            m_queue.push_back(std::move(req));
+        }
+        m_cv.notify_one();
+        return done;
+    }
+
+private:
+    struct Request
+    {
+        std::string path;
+        std::vector<uint8_t> bytes;
+        std::promise<bool> done;
+    };
+
+    void Run()
+    {
+        for (;;)
+        {
+            Request req{};
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [&] { return m_stop || !m_queue.empty(); });
+                if (m_queue.empty()) return; // m_stop &&  
+
+                req = std::move(m_queue.front());
+                m_queue.pop_front();
+            }
+
+            bool ok = false;
+            try
+            {
+                ok = WriteFileAtomic(req.path, req.bytes.data(), req.bytes.size());
+            }
+            catch (...)
+            {
+                ok = false;
+            }
+
+            const uint64_t size = req.bytes.size();
+            req.bytes = std::vector<uint8_t>();
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_queuedBytes -= size;
+            }
+            m_spaceCv.notify_all();
+
+            req.done.set_value(ok);
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::condition_variable m_spaceCv;
+    std::deque<Request> m_queue;
+    uint64_t m_queuedBytes = 0;
+    bool m_stop = false;
+
+    std::thread m_thread; //  ʱȭ (ٸ  غ  )
+};
+
+inline BackgroundFileWriter& SharedFileWriter()
+{
+    static BackgroundFileWriter writer;
+    return writer;
+}
+
+// ۸ ѱ ٷ ȯ: ( ) future
+inline std::future<bool> SubmitBinaryFile(const std::string& path, BinaryWriter&& writer)
+{
+    return SharedFileWriter().Submit(path, writer.TakeBytes());
+}
@@ -0,0 +1,387 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#include "BatchExport.h"
+
+// ==========================================================
+//  ͽƮ ĳ (Static / Skinned / Anime  )
+// - Ű = Է FBX  ؽ +  ؽ( , ͽƮ , LOD  )
+// - ũ/ð  ؽ  ٷ  ( ms)
+//   ٸ  ؽؼ  (touch    ó  ð )
+// -   ϳ  ̽
+//     Է(޽/ִϸ̼  ǳʶ FBX) /븸  
+// - ĳ  export  ؽƮ  (ӽ  -> rename)
+// ==========================================================
+
+// ----------------------------------------------------------
+// 64bit Ʈ ؽ (ȣ 뵵 ƴ:  )
+// ----------------------------------------------------------
+class ExportHasher
+{
+public:
+    void Update(const void* data, size_t size)
+    {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+
+        //  tail  ä
+        while (size > 0 && m_tailSize > 0)
+        {
+            m_tail[m_tailSize++] = *p++;
+            --size;
+            if (m_tailSize == 8)
+            {
+                uint64_t w;
+                std::memcpy(&w, m_tail, 8);
+                MixWord(w);
+                m_tailSize = 0;
+            }
+        }
+
+        while (size >= 8)
+        {
+            uint64_t w;
+            std::memcpy(&w, p, 8);
+            MixWord(w);
+            p += 8;
+            size -= 8;
+        }
+
+        while (size > 0)
+        {
+            m_tail[m_tailSize++] = *p++;
+            --size;
+        }
+    }
+
+    void AddU32(uint32_t v) { Update(&v, sizeof(v)); }
+    void AddU64(uint64_t v) { Update(&v, sizeof(v)); }
+    void AddBool(bool v) { AddU32(v ? 1u : 0u); }
+    void AddFloat(float v) { Update(&v, sizeof(v)); }
+    void AddDouble(double v) { Update(&v, sizeof(v)); }
+
+    void AddString(const std::string& s)
+    {
+        AddU64(static_cast<uint64_t>(s.size()));
+        Update(s.data(), s.size());
+    }
+
+    uint64_t Finish() const
+    {
+        uint64_t h = m_state;
+        uint64_t tail = 0;
+        std::memcpy(&tail, m_tail, m_tailSize);
+        h ^= Mix64(tail ^ (static_cast<uint64_t>(m_tailSize) << 56));
+        h ^= Mix64(m_length);
+        return Mix64(h);
+    }
+
+private:
+    static uint64_t Mix64(uint64_t x)
+    {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdull;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ull;
+        x ^= x >> 33;
+        return x;
+    }
+
+    void MixWord(uint64_t w)
+    {
+        m_state = (m_state ^ Mix64(w)) * 0x9e3779b97f4a7c15ull;
+        m_state = (m_state << 27) | (m_state >> 37);
+        m_length += 8;
+    }
+
+    uint64_t m_state = 0xcbf29ce484222325ull;
+    uint64_t m_length = 0;
+    uint8_t m_tail[8] = {};
+    size_t m_tailSize = 0;
+};
+
+inline bool HashFileContents(const std::filesystem::path& path, uint64_t& outHash)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) return false;
+
+    ExportHasher hasher;
+    std::vector<char> buffer(1u << 20);
+
+    while (in)
+    {
+        in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        const std::streamsize got = in.gcount();
+        if (got > 0) hasher.Update(buffer.data(), static_cast<size_t>(got));
+    }
+
+    if (in.bad()) return false;
+
+    outHash = hasher.Finish();
+    return true;
+}
+
+// ----------------------------------------------------------
+// ĳ ü
+// ----------------------------------------------------------
+
+struct ExportCacheEntry
+{
+    uint64_t contentHash = 0;
+    uint64_t settingsHash = 0;
+    uint64_t fileSize = 0;
+    int64_t writeTime = 0;
+    std::vector<std::string> outputs;
+};
+
+// Probe : ̽  Store ״ ѱ
+struct ExportCacheProbe
+{
+    std::string inputKey;
+    uint64_t contentHash = 0;
+    uint64_t fileSize = 0;
+    int64_t writeTime = 0;
+    bool contentHashValid = false;
+    bool upToDate = false;
+};
+
+class ExportCache
+{
+public:
+    static constexpr uint32_t kFormatVersion = 1;
+
+    ExportCache(std::string cacheFilePath, uint64_t settingsHash)
+        : m_cacheFilePath(std::move(cacheFilePath))
+        , m_settingsHash(settingsHash)
+    {
+    }
+
+    void Load()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.clear();
+
+        std::ifstream in(m_cacheFilePath, std::ios::binary);
+        if (!in.is_open()) return;
+
+        std::string line;
+        if (!std::getline(in, line)) return;
+        if (line != HeaderLine()) return; //  ٲ  ̽
+
+        while (std::getline(in, line))
+        {
+            std::vector<std::string> fields;
+            SplitTabs(line, fields);
+            if (fields.size() < 5) continue;
+
+            ExportCacheEntry e{};
+            try
+            {
+                e.contentHash = std::stoull(fields[0], nullptr, 16);
+                e.settingsHash = std::stoull(fields[1], nullptr, 16);
+                e.fileSize = std::stoull(fields[2]);
+                e.writeTime = std::stoll(fields[3]);
+            }
+            catch (const std::exception&)
+            {
+                continue; //    (= ̽)
+            }
+            for (size_t i = 5; i < fields.size(); ++i)
+                e.outputs.push_back(fields[i]);
+
+            m_entries[fields[4]] = std::move(e);
+        }
+    }
+
+    bool Save() const
+    {
+        namespace fs = std::filesystem;
+
+        const std::string tmpPath = m_cacheFilePath + ".tmp";
+        {
+            std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) return false;
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            out << HeaderLine() << "\n";
+            for (const auto& kv : m_entries)
+            {
+                const ExportCacheEntry& e = kv.second;
+                out << std::hex << e.contentHash << "\t" << e.settingsHash << std::dec
+                    << "\t" << e.fileSize << "\t" << e.writeTime << "\t" << kv.first;
+                for (const std::string& o : e.outputs)
+                    out << "\t" << o;
+                out << "\n";
+            }
+            if (!out) return false;
+        }
+
+        std::error_code ec;
+        fs::rename(tmpPath, m_cacheFilePath, ec);
+        if (ec)
+        {
+            // Ϻ ÷  rename  ->  õ
+            fs::remove(m_cacheFilePath, ec);
+            fs::rename(tmpPath, m_cacheFilePath, ec);
+        }
+        return !ec;
+    }
+
+    // Է  ¸ Ȯؼ ̹  ̹ ͽƮƴ 
+    ExportCacheProbe Probe(const BatchExportJob& job)
+    {
+        namespace fs = std::filesystem;
+
+        ExportCacheProbe probe{};
+        probe.inputKey = job.fbxPath.generic_string();
+        probe.fileSize = job.fileBytes;
+
+        std::error_code ec;
+        const auto writeTime = fs::last_write_time(job.fbxPath, ec);
+        probe.writeTime = ec ? 0 : static_cast<int64_t>(writeTime.time_since_epoch().count());
+
+        ExportCacheEntry entry{};
+        bool hasEntry = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_entries.find(probe.inputKey);
+            if (it != m_entries.end())
+            {
+                entry = it->second;
+                hasEntry = true;
+            }
+        }
+
+        const bool sameSettings = hasEntry && entry.settingsHash == m_settingsHash;
+        const bool outputsExist = hasEntry && OutputsExist(entry.outputs);
+
+        if (sameSettings && outputsExist &&
+            entry.fileSize == probe.fileSize && entry.writeTime == probe.writeTime)
+        {
+            probe.contentHash = entry.contentHash;
+            probe.contentHashValid = true;
+            probe.upToDate = true;
+        }
+        else
+        {
+            probe.contentHashValid = HashFileContents(job.fbxPath, probe.contentHash);
+
+            if (sameSettings && outputsExist && probe.contentHashValid &&
+                entry.contentHash == probe.contentHash)
+            {
+                //  ״ΰ ð ٲ -> , ð 
+                probe.upToDate = true;
+                Store(probe, entry.outputs);
+            }
+        }
+
+        if (probe.upToDate) ++m_hits;
+        else                ++m_misses;
+
+        return probe;
+    }
+
+    void Store(const ExportCacheProbe& probe, const std::vector<std::string>& outputs)
+    {
+        if (!probe.contentHashValid) return;
+
+        ExportCacheEntry e{};
+        e.contentHash = probe.contentHash;
+        e.settingsHash = m_settingsHash;
+        e.fileSize = probe.fileSize;
+        e.writeTime = probe.writeTime;
+        e.outputs = outputs;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries[probe.inputKey] = std::move(e);
+    }
+
+    //  ۾    ࿡ ٽ õϰ Ѵ
+    void Invalidate(const ExportCacheProbe& probe)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.erase(probe.inputKey);
+    }
+
+    void PrintSummary() const
+    {
+        std::cout << "ĳ:  " << m_hits.load() << " / ̽ " << m_misses.load() << "\n";
+    }
+
+private:
+    static std::string HeaderLine()
+    {
+        return "EXPORTCACHE " + std::to_string(kFormatVersion);
+    }
+
+    static void SplitTabs(const std::string& line, std::vector<std::string>& out)
+    {
+        size_t start = 0;
+        for (;;)
+        {
+            const size_t tab = line.find('\t', start);
+            if (tab == std::string::npos)
+            {
+                out.push_back(line.substr(start));
+                return;
+            }
+            out.push_back(line.substr(start, tab - start));
+            start = tab + 1;
+        }
+    }
+
+    //   =     Է -> Ȯ  Ƿ true
+    static bool OutputsExist(const std::vector<std::string>& outputs)
+    {
+        std::error_code ec;
+        for (const std::string& o : outputs)
+        {
+            if (!std::filesystem::exists(o, ec)) return false;
+        }
+        return true;
+    }
+
+    std::string m_cacheFilePath;
+    uint64_t m_settingsHash = 0;
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, ExportCacheEntry> m_entries;
+
+    std::atomic<size_t> m_hits{ 0 };
+    std::atomic<size_t> m_misses{ 0 };
+};
+
+// ----------------------------------------------------------
+// ġ ۾ : ĳ ̸ ǳʶٰ, ̽ ͽƮ  
+// - exportJob    θ outputs ä
+// ----------------------------------------------------------
+inline bool RunCachedExportJob(
+    ExportCache& cache,
+    const BatchExportJob& job,
+    const std::function<bool(std::vector<std::string>& outputs)>& exportJob)
+{
+    const ExportCacheProbe probe = cache.Probe(job);
+    if (probe.upToDate)
+    {
+        BatchLog() << " (ĳ ), ǳʶ: " << job.fbxPath.string() << "\n";
+        return true;
+    }
+
+    std::vector<std::string> outputs;
+    const bool ok = exportJob(outputs);
+    if (ok) cache.Store(probe, outputs);
+    else    cache.Invalidate(probe);
+    return ok;
+}
@@ -0,0 +1,337 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <fbxsdk.h>
+
+// ==========================================================
+// FbxAnimCurve   (ִϸ̼ , EvaluateLocalTransform )
+// - CaptureFbxNodeCurves:  T/R/S Ŀ Ű(/źƮ) ǹ//PrePost ȸ/ȸ 
+//    迭   . FBX SDK ȣ ⼭ -> ȣ 忡 ķ
+// - EvaluateFbxNodeCurves: SDK   TRS ( /, double)
+//    ϴ °  帶 ٸ Ŀ 忡  ȴ
+//    ϳ  äκ 迭  Į  (Ʈ    SIMD  ʴ´)
+//    = T * Roff * Rp * Rpre * R * Rpost^-1 * Rp^-1 * Soff * Sp * S * Sp^-1
+// - : //3(ġ źƮ ) Ű, ù Ű / Ű ڴ   , ̾ ϳ
+//   ̾ , ݺ ܻ,   ش SDK ٸ  ִ (ȣڰ /ü)
+// ==========================================================
+
+enum FbxCurveSegment : uint8_t
+{
+    FBX_CURVE_SEGMENT_CONSTANT = 0,       //    Ű 
+    FBX_CURVE_SEGMENT_CONSTANT_NEXT,      //    Ű 
+    FBX_CURVE_SEGMENT_LINEAR,
+    FBX_CURVE_SEGMENT_CUBIC,
+};
+
+static constexpr float kFbxDefaultTangentWeight = 1.0f / 3.0f;
+
+// Ŀ ϳ (Ű i segment/rightSlope/rightWeight i ~ i+1 , left* i-1 ~ i )
+struct FbxCurveSnapshot
+{
+    double defaultValue = 0.0;        // Ŀ갡   (Ƽ )
+    std::vector<double> times;        // 
+    std::vector<float> values;
+    std::vector<uint8_t> segments;    // FbxCurveSegment
+    std::vector<float> rightSlopes;   //  / 
+    std::vector<float> leftSlopes;
+    std::vector<float> rightWeights;  //    (ġ  1/3)
+    std::vector<float> leftWeights;
+};
+
+enum FbxNodeCurveChannel
+{
+    FBX_NODE_CURVE_TX = 0, FBX_NODE_CURVE_TY, FBX_NODE_CURVE_TZ,
+    FBX_NODE_CURVE_RX, FBX_NODE_CURVE_RY, FBX_NODE_CURVE_RZ,   // 
+    FBX_NODE_CURVE_SX, FBX_NODE_CURVE_SY, FBX_NODE_CURVE_SZ,
+    FBX_NODE_CURVE_COUNT,
+};
+
+struct FbxNodeCurveSnapshot
+{
+    FbxCurveSnapshot curves[FBX_NODE_CURVE_COUNT];
+    EFbxRotationOrder rotationOrder = eEulerXYZ;
+    double preRotation[4] = { 0.0, 0.0, 0.0, 1.0 };    // ʹϾ (x, y, z, w)
+    double postRotation[4] = { 0.0, 0.0, 0.0, 1.0 };
+    double rotationOffset[3] = {};
+    double rotationPivot[3] = {};
+    double scalingOffset[3] = {};
+    double scalingPivot[3] = {};
+};
+
+//  ϳ ú  TRS (äκ 迭,  )
+struct FbxLocalTrsSamples
+{
+    std::vector<double> t[3];
+    std::vector<double> q[4];   // ȭ (x, y, z, w)
+    std::vector<double> s[3];
+
+    void Resize(size_t count)
+    {
+        for (std::vector<double>& v : t) v.resize(count);
+        for (std::vector<double>& v : q) v.resize(count);
+        for (std::vector<double>& v : s) v.resize(count);
+    }
+};
+
+// ----------------------------------------------------------
+// ʹϾ (x, y, z, w)
+// ----------------------------------------------------------
+
+inline void MulFbxQuat(const double a[4], const double b[4], double out[4])
+{
+    const double x = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+    const double y = a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0];
+    const double z = a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3];
+    const double w = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+    out[0] = x; out[1] = y; out[2] = z; out[3] = w;
+}
+
+inline void RotateByFbxQuat(const double q[4], const double v[3], double out[3])
+{
+    // v + 2w (q x v) + 2 q x (q x v)
+    const double cx = q[1] * v[2] - q[2] * v[1];
+    const double cy = q[2] * v[0] - q[0] * v[2];
+    const double cz = q[0] * v[1] - q[1] * v[0];
+    const double tx = 2.0 * cx, ty = 2.0 * cy, tz = 2.0 * cz;
+    out[0] = v[0] + q[3] * tx + (q[1] * tz - q[2] * ty);
+    out[1] = v[1] + q[3] * ty + (q[2] * tx - q[0] * tz);
+    out[2] = v[2] + q[3] * tz + (q[0] * ty - q[1] * tx);
+}
+
+// Ϸ() -> ʹϾ. eEulerXYZ = X  (R = Rz * Ry * Rx),  ̸   
+inline void FbxEulerToQuat(const double deg[3], EFbxRotationOrder order, double out[4])
+{
+    const double k = 0.5 * 3.14159265358979323846 / 180.0;
+    const double qx[4] = { std::sin(deg[0] * k), 0.0, 0.0, std::cos(deg[0] * k) };
+    const double qy[4] = { 0.0, std::sin(deg[1] * k), 0.0, std::cos(deg[1] * k) };
+    const double qz[4] = { 0.0, 0.0, std::sin(deg[2] * k), std::cos(deg[2] * k) };
+
+    const double* first = qx; const double* second = qy; const double* third = qz;
+    switch (order)
+    {
+    case eEulerXZY: first = qx; second = qz; third = qy; break;
+    case eEulerYZX: first = qy; second = qz; third = qx; break;
+    case eEulerYXZ: first = qy; second = qx; third = qz; break;
+    case eEulerZXY: first = qz; second = qx; third = qy; break;
+    case eEulerZYX: first = qz; second = qy; third = qx; break;
+    default: break;   // eEulerXYZ, eSphericXYZ
+    }
+
+    double tmp[4];
+    MulFbxQuat(third, second, tmp);
+    MulFbxQuat(tmp, first, out);
+}
+
+// ----------------------------------------------------------
+//  (SDK ȣ, )
+// ----------------------------------------------------------
+
+inline void CaptureFbxCurve(FbxAnimCurve* curve, double defaultValue, FbxCurveSnapshot& out)
+{
+    out = FbxCurveSnapshot{};
+    out.defaultValue = defaultValue;
+    if (!curve) return;
+
+    const int keyCount = curve->KeyGetCount();
+    out.times.reserve(keyCount);
+    out.values.reserve(keyCount);
+    out.segments.reserve(keyCount);
+    out.rightSlopes.reserve(keyCount);
+    out.leftSlopes.reserve(keyCount);
+    out.rightWeights.reserve(keyCount);
+    out.leftWeights.reserve(keyCount);
+
+    for (int i = 0; i < keyCount; ++i)
+    {
+        out.times.push_back(curve->KeyGetTime(i).GetSecondDouble());
+        out.values.push_back(curve->KeyGetValue(i));
+
+        const FbxAnimCurveDef::EInterpolationType interpolation = curve->KeyGetInterpolation(i);
+        FbxCurveSegment segment = FBX_CURVE_SEGMENT_CUBIC;
+        if (interpolation == FbxAnimCurveDef::eInterpolationConstant)
+        {
+            segment = (curve->KeyGetConstantMode(i) == FbxAnimCurveDef::eConstantNext)
+                ? FBX_CURVE_SEGMENT_CONSTANT_NEXT
+                : FBX_CURVE_SEGMENT_CONSTANT;
+        }
+        else if (interpolation == FbxAnimCurveDef::eInterpolationLinear)
+        {
+            segment = FBX_CURVE_SEGMENT_LINEAR;
+        }
+        out.segments.push_back(segment);
+
+        out.rightSlopes.push_back(curve->KeyGetRightDerivative(i));
+        out.leftSlopes.push_back(curve->KeyGetLeftDerivative(i));
+        out.rightWeights.push_back(curve->KeyIsRightTangentWeighted(i) ? curve->KeyGetRightTangentWeight(i) : kFbxDefaultTangentWeight);
+        out.leftWeights.push_back(curve->KeyIsLeftTangentWeighted(i) ? curve->KeyGetLeftTangentWeight(i) : kFbxDefaultTangentWeight);
+    }
+}
+
+inline void CaptureFbxNodeCurves(FbxNode* node, FbxAnimLayer* layer, FbxNodeCurveSnapshot& out)
+{
+    out = FbxNodeCurveSnapshot{};
+
+    const FbxDouble3 t = node->LclTranslation.Get();
+    const FbxDouble3 r = node->LclRotation.Get();
+    const FbxDouble3 s = node->LclScaling.Get();
+
+    const char* components[3] = { FBXSDK_CURVENODE_COMPONENT_X, FBXSDK_CURVENODE_COMPONENT_Y, FBXSDK_CURVENODE_COMPONENT_Z };
+    for (int i = 0; i < 3; ++i)
+    {
+        CaptureFbxCurve(node->LclTranslation.GetCurve(layer, components[i]), t[i], out.curves[FBX_NODE_CURVE_TX + i]);
+        CaptureFbxCurve(node->LclRotation.GetCurve(layer, components[i]), r[i], out.curves[FBX_NODE_CURVE_RX + i]);
+        CaptureFbxCurve(node->LclScaling.GetCurve(layer, components[i]), s[i], out.curves[FBX_NODE_CURVE_SX + i]);
+    }
+
+    // RotationActive   ȸ /PrePost ȸ  (SDK )
+    if (node->GetRotationActive())
+    {
+        node->GetRotationOrder(FbxNode::eSourcePivot, out.rotationOrder);
+
+        const FbxVector4& pre = node->GetPreRotation(FbxNode::eSourcePivot);
+        const FbxVector4& post = node->GetPostRotation(FbxNode::eSourcePivot);
+        const double preDeg[3] = { pre[0], pre[1], pre[2] };
+        const double postDeg[3] = { post[0], post[1], post[2] };
+        FbxEulerToQuat(preDeg, eEulerXYZ, out.preRotation);
+        FbxEulerToQuat(postDeg, eEulerXYZ, out.postRotation);
+    }
+
+    const FbxVector4& ro = node->GetRotationOffset(FbxNode::eSourcePivot);
+    const FbxVector4& rp = node->GetRotationPivot(FbxNode::eSourcePivot);
+    const FbxVector4& so = node->GetScalingOffset(FbxNode::eSourcePivot);
+    const FbxVector4& sp = node->GetScalingPivot(FbxNode::eSourcePivot);
+    for (int i = 0; i < 3; ++i)
+    {
+        out.rotationOffset[i] = ro[i];
+        out.rotationPivot[i] = rp[i];
+        out.scalingOffset[i] = so[i];
+        out.scalingPivot[i] = sp[i];
+    }
+}
+
+// ----------------------------------------------------------
+//  (SDK )
+// ----------------------------------------------------------
+
+// 3 : ð൵  (P1x = wR, P2x = 1 - wL), ġ ⺻̸ u = x
+inline double EvaluateFbxCubicSegment(const FbxCurveSnapshot& c, size_t i, double x)
+{
+    const double dt = c.times[i + 1] - c.times[i];
+    const double v0 = c.values[i];
+    const double v1 = c.values[i + 1];
+    const double wr = std::min(std::max<double>(c.rightWeights[i], 0.0), 1.0);
+    const double wl = std::min(std::max<double>(c.leftWeights[i + 1], 0.0), 1.0);
+    const double p1 = v0 + c.rightSlopes[i] * wr * dt;
+    const double p2 = v1 - c.leftSlopes[i + 1] * wl * dt;
+
+    double u = x;
+    if (std::fabs(wr - kFbxDefaultTangentWeight) > 1e-6 || std::fabs(wl - kFbxDefaultTangentWeight) > 1e-6)
+    {
+        // x(u) ġ [0, 1]̸   -> ̺й
+        double lo = 0.0, hi = 1.0;
+        for (int it = 0; it < 48; ++it)
+        {
+            u = 0.5 * (lo + hi);
+            const double a = 1.0 - u;
+            const double xu = 3.0 * a * a * u * wr + 3.0 * a * u * u * (1.0 - wl) + u * u * u;
+            if (xu < x) lo = u; else hi = u;
+        }
+        u = 0.5 * (lo + hi);
+    }
+
+    const double a = 1.0 - u;
+    return a * a * a * v0 + 3.0 * a * a * u * p1 + 3.0 * a * u * u * p2 + u * u * u * v1;
+}
+
+// times ̸  տ 󰡰, ƴϸ ׶ ̺ Ž
+inline void EvaluateFbxCurve(const FbxCurveSnapshot& c, const double* times, size_t count, double* out)
+{
+    const size_t keyCount = c.times.size();
+    if (keyCount == 0)
+    {
+        std::fill(out, out + count, c.defaultValue);
+        return;
+    }
+
+    size_t seg = 0;
+    for (size_t j = 0; j < count; ++j)
+    {
+        const double t = times[j];
+        if (keyCount == 1 || t <= c.times.front()) { out[j] = c.values.front(); continue; }
+        if (t >= c.times.back()) { out[j] = c.values.back(); continue; }
+
+        if (t < c.times[seg] || t >= c.times[seg + 1])
+        {
+            if (t >= c.times[seg] && seg + 2 < keyCount && t < c.times[seg + 2])
+                ++seg;
+            else
+                seg = static_cast<size_t>(std::upper_bound(c.times.begin(), c.times.end(), t) - c.times.begin()) - 1;
+        }
+
+        const double x = (t - c.times[seg]) / (c.times[seg + 1] - c.times[seg]);
+        switch (c.segments[seg])
+        {
+        case FBX_CURVE_SEGMENT_CONSTANT:      out[j] = c.values[seg]; break;
+        case FBX_CURVE_SEGMENT_CONSTANT_NEXT: out[j] = c.values[seg + 1]; break;
+        case FBX_CURVE_SEGMENT_LINEAR:        out[j] = c.values[seg] + (c.values[seg + 1] - c.values[seg]) * x; break;
+        default:                              out[j] = EvaluateFbxCubicSegment(c, seg, x); break;
+        }
+    }
+}
+
+// Ŀ 9 äκ       ģ
+inline void EvaluateFbxNodeCurves(
+    const FbxNodeCurveSnapshot& node,
+    const double* timesSec,
+    size_t count,
+    FbxLocalTrsSamples& out)
+{
+    out.Resize(count);
+
+    std::vector<double> values(count * FBX_NODE_CURVE_COUNT);
+    for (int c = 0; c < FBX_NODE_CURVE_COUNT; ++c)
+        EvaluateFbxCurve(node.curves[c], timesSec, count, &values[size_t(c) * count]);
+
+    const double* v[FBX_NODE_CURVE_COUNT];
+    for (int c = 0; c < FBX_NODE_CURVE_COUNT; ++c)
+        v[c] = &values[size_t(c) * count];
+
+    const double postInv[4] = { -node.postRotation[0], -node.postRotation[1], -node.postRotation[2], node.postRotation[3] };
+
+    for (size_t j = 0; j < count; ++j)
+    {
+        // ȸ = Rpre * R * Rpost^-1
+        const double deg[3] = { v[FBX_NODE_CURVE_RX][j], v[FBX_NODE_CURVE_RY][j], v[FBX_NODE_CURVE_RZ][j] };
+        double r[4], tmp[4], q[4];
+        FbxEulerToQuat(deg, node.rotationOrder, r);
+        MulFbxQuat(node.preRotation, r, tmp);
+        MulFbxQuat(tmp, postInv, q);
+
+        const double len = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+        for (int i = 0; i < 4; ++i) out.q[i][j] = q[i] / len;
+
+        const double s[3] = { v[FBX_NODE_CURVE_SX][j], v[FBX_NODE_CURVE_SY][j], v[FBX_NODE_CURVE_SZ][j] };
+
+        // ̵ = T + Roff + Rp + R * (Soff + Sp - S * Sp - Rp)
+        const double local[3] =
+        {
+            node.scalingOffset[0] + node.scalingPivot[0] - s[0] * node.scalingPivot[0] - node.rotationPivot[0],
+            node.scalingOffset[1] + node.scalingPivot[1] - s[1] * node.scalingPivot[1] - node.rotationPivot[1],
+            node.scalingOffset[2] + node.scalingPivot[2] - s[2] * node.scalingPivot[2] - node.rotationPivot[2],
+        };
+        double rotated[3];
+        RotateByFbxQuat(q, local, rotated);
+
+        out.t[0][j] = v[FBX_NODE_CURVE_TX][j] + node.rotationOffset[0] + node.rotationPivot[0] + rotated[0];
+        out.t[1][j] = v[FBX_NODE_CURVE_TY][j] + node.rotationOffset[1] + node.rotationPivot[1] + rotated[1];
+        out.t[2][j] = v[FBX_NODE_CURVE_TZ][j] + node.rotationOffset[2] + node.rotationPivot[2] + rotated[2];
+
+        out.s[0][j] = s[0];
+        out.s[1][j] = s[1];
+        out.s[2][j] = s[2];
+    }
+}
@@ -0,0 +1,448 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fbxsdk.h>
+
+#include "BatchExport.h"
+
+// ==========================================================
+// Ƽ  (Static / Skinned /   )
+// - MBIN Ƽ ǿ   ̴´
+// - Dump* Լ ȣ  DEBUGLOG  θ
+// ==========================================================
+
+struct MaterialTexTransform
+{
+    float scale[2] = { 1.0f, 1.0f };
+    float offset[2] = { 0.0f, 0.0f };
+    uint32_t wrapMode[2] = { 0u, 0u }; // 0=Repeat, 1=Clamp
+};
+
+struct Material
+{
+    std::string name;
+    std::string diffuseTextureName;
+    std::string normalTextureName;
+    std::string emissiveTextureName;
+    std::string specularTextureName;
+
+    float diffuseColor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    float emissiveColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    float specularColor[4] = { 0.0f, 0.0f, 0.0f, 0.0f }; // rgb=specular, a=shininess
+
+    MaterialTexTransform diffuseTransform;
+    MaterialTexTransform normalTransform;
+    MaterialTexTransform emissiveTransform;
+    MaterialTexTransform specularTransform;
+};
+
+// ==========================================================
+// [C++20] u8path ü: ϸ stem ̱
+// ==========================================================
+
+inline std::string SafeStemFromFbxFileName(const char* fn)
+{
+    if (!fn || !fn[0]) return "";
+
+    try
+    {
+        std::string s(fn);
+        std::u8string u8(reinterpret_cast<const char8_t*>(s.data()), s.size());
+        std::filesystem::path p(u8);
+
+        std::u8string stem_u8 = p.stem().u8string();
+        return std::string(reinterpret_cast<const char*>(stem_u8.data()), stem_u8.size());
+    }
+    catch (...)
+    {
+        std::string s(fn);
+        size_t pos = s.find_last_of("/\\");
+        std::string base = (pos == std::string::npos) ? s : s.substr(pos + 1);
+        size_t dot = base.find_last_of('.');
+        if (dot != std::string::npos) base = base.substr(0, dot);
+        return base;
+    }
+}
+
+inline std::string ExtractFirstTextureStem(FbxProperty prop)
+{
+    if (!prop.IsValid()) return "";
+
+    // LayeredTexture ( 0)
+    if (prop.GetSrcObjectCount<FbxLayeredTexture>() > 0)
+    {
+        auto* layered = prop.GetSrcObject<FbxLayeredTexture>(0);
+        if (layered && layered->GetSrcObjectCount<FbxTexture>() > 0)
+        {
+            auto* tex = FbxCast<FbxFileTexture>(layered->GetSrcObject<FbxTexture>(0));
+            if (tex) return SafeStemFromFbxFileName(tex->GetFileName());
+        }
+        return "";
+    }
+
+    // Ϲ ؽó
+    if (prop.GetSrcObjectCount<FbxTexture>() > 0)
+    {
+        auto* tex = FbxCast<FbxFileTexture>(prop.GetSrcObject<FbxTexture>(0));
+        if (tex) return SafeStemFromFbxFileName(tex->GetFileName());
+    }
+    return "";
+}
+
+inline FbxTexture* ExtractFirstTextureObject(FbxProperty prop)
+{
+    if (!prop.IsValid()) return nullptr;
+
+    if (prop.GetSrcObjectCount<FbxLayeredTexture>() > 0)
+    {
+        auto* layered = prop.GetSrcObject<FbxLayeredTexture>(0);
+        if (layered && layered->GetSrcObjectCount<FbxTexture>() > 0)
+            return layered->GetSrcObject<FbxTexture>(0);
+        return nullptr;
+    }
+
+    if (prop.GetSrcObjectCount<FbxTexture>() > 0)
+        return prop.GetSrcObject<FbxTexture>(0);
+
+    return nullptr;
+}
+
+inline const char* WrapModeToString(FbxTexture::EWrapMode mode)
+{
+    switch (mode)
+    {
+    case FbxTexture::eRepeat: return "Repeat";
+    case FbxTexture::eClamp:  return "Clamp";
+    default:                  return "Unknown";
+    }
+}
+
+inline const char* MaterialClassToString(FbxSurfaceMaterial* mat)
+{
+    if (!mat) return "null";
+    if (FbxCast<FbxSurfacePhong>(mat))   return "Phong";
+    if (FbxCast<FbxSurfaceLambert>(mat)) return "Lambert";
+    return "Other";
+}
+
+inline void DumpDouble3Value(const char* label, const FbxDouble3& v)
+{
+    BatchLog() << "  " << label << " = (" << v[0] << ", " << v[1] << ", " << v[2] << ")\n";
+}
+
+inline void DumpDoubleValue(const char* label, double v)
+{
+    BatchLog() << "  " << label << " = " << v << "\n";
+}
+
+inline void DumpTextureSlotDebug(const char* slotName, FbxProperty prop)
+{
+    std::ostream& log = BatchLog();
+    log << "  [TextureSlot] " << slotName;
+
+    if (!prop.IsValid())
+    {
+        log << " : property invalid\n";
+        return;
+    }
+
+    const bool hasLayered = (prop.GetSrcObjectCount<FbxLayeredTexture>() > 0);
+    FbxTexture* tex = ExtractFirstTextureObject(prop);
+
+    if (!tex)
+    {
+        log << " : connected=0 layered=" << (hasLayered ? 1 : 0) << "\n";
+        return;
+    }
+
+    auto* fileTex = FbxCast<FbxFileTexture>(tex);
+
+    log << " : connected=1 layered=" << (hasLayered ? 1 : 0);
+    log << " type=\"" << (fileTex ? "FileTexture" : "Texture") << "\"";
+    log << " scale=(" << tex->GetScaleU() << ", " << tex->GetScaleV() << ")";
+    log << " trans=(" << tex->GetTranslationU() << ", " << tex->GetTranslationV() << ")";
+    log << " wrap=(" << WrapModeToString(tex->GetWrapModeU()) << ", "
+        << WrapModeToString(tex->GetWrapModeV()) << ")";
+
+    if (fileTex)
+    {
+        const char* fileName = fileTex->GetFileName();
+        log << " file=\"" << (fileName ? fileName : "") << "\"";
+        log << " stem=\"" << SafeStemFromFbxFileName(fileName) << "\"";
+    }
+
+    log << "\n";
+}
+
+inline void DumpMaterialDebug(FbxSurfaceMaterial* mat)
+{
+    if (!mat)
+    {
+        BatchLog() << "[MaterialDump] null\n";
+        return;
+    }
+
+    BatchLog() << "\n--------------------------------------------------\n";
+    BatchLog() << "[MaterialDump] name=\"" << mat->GetName() << "\" "
+        << "class=\"" << MaterialClassToString(mat) << "\"\n";
+
+    if (auto* lambert = FbxCast<FbxSurfaceLambert>(mat))
+    {
+        DumpDouble3Value("Lambert.Ambient", lambert->Ambient.Get());
+        DumpDoubleValue("Lambert.AmbientFactor", lambert->AmbientFactor.Get());
+
+        DumpDouble3Value("Lambert.Diffuse", lambert->Diffuse.Get());
+        DumpDoubleValue("Lambert.DiffuseFactor", lambert->DiffuseFactor.Get());
+
+        DumpDouble3Value("Lambert.Emissive", lambert->Emissive.Get());
+        DumpDoubleValue("Lambert.EmissiveFactor", lambert->EmissiveFactor.Get());
+
+        DumpDouble3Value("Lambert.TransparentColor", lambert->TransparentColor.Get());
+        DumpDoubleValue("Lambert.TransparencyFactor", lambert->TransparencyFactor.Get());
+    }
+
+    if (auto* phong = FbxCast<FbxSurfacePhong>(mat))
+    {
+        DumpDouble3Value("Phong.Specular", phong->Specular.Get());
+        DumpDoubleValue("Phong.SpecularFactor", phong->SpecularFactor.Get());
+        DumpDoubleValue("Phong.Shininess", phong->Shininess.Get());
+        DumpDouble3Value("Phong.Reflection", phong->Reflection.Get());
+        DumpDoubleValue("Phong.ReflectionFactor", phong->ReflectionFactor.Get());
+    }
+
+    DumpTextureSlotDebug("Diffuse", mat->FindProperty(FbxSurfaceMaterial::sDiffuse));
+    DumpTextureSlotDebug("NormalMap", mat->FindProperty(FbxSurfaceMaterial::sNormalMap));
+    DumpTextureSlotDebug("Bump", mat->FindProperty(FbxSurfaceMaterial::sBump));
+    DumpTextureSlotDebug("Emissive", mat->FindProperty(FbxSurfaceMaterial::sEmissive));
+    DumpTextureSlotDebug("Specular", mat->FindProperty(FbxSurfaceMaterial::sSpecular));
+}
+
+inline uint32_t EncodeWrapMode(FbxTexture::EWrapMode mode)
+{
+    return (mode == FbxTexture::eClamp) ? 1u : 0u;
+}
+
+inline void FillColor4(float out[4], double x, double y, double z, double w)
+{
+    out[0] = (float)x;
+    out[1] = (float)y;
+    out[2] = (float)z;
+    out[3] = (float)w;
+}
+
+inline void FillTexTransformFromProperty(FbxProperty prop, MaterialTexTransform& outTransform)
+{
+    outTransform = MaterialTexTransform{};
+
+    FbxTexture* tex = ExtractFirstTextureObject(prop);
+    if (!tex) return;
+
+    outTransform.scale[0] = (float)tex->GetScaleU();
+    outTransform.scale[1] = (float)tex->GetScaleV();
+    outTransform.offset[0] = (float)tex->GetTranslationU();
+    outTransform.offset[1] = (float)tex->GetTranslationV();
+    outTransform.wrapMode[0] = EncodeWrapMode(tex->GetWrapModeU());
+    outTransform.wrapMode[1] = EncodeWrapMode(tex->GetWrapModeV());
+}
+
+inline bool IsNearlyBlack3(const float c[4], float eps = 1e-6f)
+{
+    return
+        (std::fabs(c[0]) <= eps) &&
+        (std::fabs(c[1]) <= eps) &&
+        (std::fabs(c[2]) <= eps);
+}
+
+inline bool IsIdentityTexTransform(const MaterialTexTransform& t, float eps = 1e-6f)
+{
+    return
+        (std::fabs(t.scale[0] - 1.0f) <= eps) &&
+        (std::fabs(t.scale[1] - 1.0f) <= eps) &&
+        (std::fabs(t.offset[0]) <= eps) &&
+        (std::fabs(t.offset[1]) <= eps) &&
+        (t.wrapMode[0] == 0u) &&
+        (t.wrapMode[1] == 0u);
+}
+
+inline void ExtractMaterialAttributes(FbxSurfaceMaterial* mat, Material& outMat)
+{
+    if (!mat) return;
+
+    FbxProperty diffuseProp = mat->FindProperty(FbxSurfaceMaterial::sDiffuse);
+    FbxProperty normalProp = mat->FindProperty(FbxSurfaceMaterial::sNormalMap);
+    FbxProperty bumpProp = mat->FindProperty(FbxSurfaceMaterial::sBump);
+    FbxProperty emissiveProp = mat->FindProperty(FbxSurfaceMaterial::sEmissive);
+    FbxProperty specularProp = mat->FindProperty(FbxSurfaceMaterial::sSpecular);
+
+    outMat.diffuseTextureName = ExtractFirstTextureStem(diffuseProp);
+    outMat.normalTextureName = ExtractFirstTextureStem(normalProp);
+    outMat.emissiveTextureName = ExtractFirstTextureStem(emissiveProp);
+    outMat.specularTextureName = ExtractFirstTextureStem(specularProp);
+
+    FillTexTransformFromProperty(diffuseProp, outMat.diffuseTransform);
+
+    if (outMat.normalTextureName.empty())
+    {
+        outMat.normalTextureName = ExtractFirstTextureStem(bumpProp);
+        FillTexTransformFromProperty(bumpProp, outMat.normalTransform);
+    }
+    else
+    {
+        FillTexTransformFromProperty(normalProp, outMat.normalTransform);
+    }
+
+    FillTexTransformFromProperty(emissiveProp, outMat.emissiveTransform);
+    FillTexTransformFromProperty(specularProp, outMat.specularTransform);
+
+    if (auto* lambert = FbxCast<FbxSurfaceLambert>(mat))
+    {
+        const FbxDouble3 d = lambert->Diffuse.Get();
+        const double df = lambert->DiffuseFactor.Get();
+        FillColor4(outMat.diffuseColor, d[0] * df, d[1] * df, d[2] * df, 1.0);
+
+        const FbxDouble3 e = lambert->Emissive.Get();
+        const double ef = lambert->EmissiveFactor.Get();
+        FillColor4(outMat.emissiveColor, e[0] * ef, e[1] * ef, e[2] * ef, 1.0);
+    }
+
+    if (auto* phong = FbxCast<FbxSurfacePhong>(mat))
+    {
+        const FbxDouble3 s = phong->Specular.Get();
+        const double sf = phong->SpecularFactor.Get();
+        const double shininess = phong->Shininess.Get();
+        FillColor4(outMat.specularColor, s[0] * sf, s[1] * sf, s[2] * sf, shininess);
+    }
+
+    if (!outMat.normalTextureName.empty() &&
+        IsIdentityTexTransform(outMat.normalTransform) &&
+        !IsIdentityTexTransform(outMat.diffuseTransform))
+    {
+        outMat.normalTransform = outMat.diffuseTransform;
+    }
+
+    if (!outMat.emissiveTextureName.empty() &&
+        IsIdentityTexTransform(outMat.emissiveTransform) &&
+        !IsIdentityTexTransform(outMat.diffuseTransform))
+    {
+        outMat.emissiveTransform = outMat.diffuseTransform;
+    }
+
+    if (!outMat.specularTextureName.empty() &&
+        IsIdentityTexTransform(outMat.specularTransform) &&
+        !IsIdentityTexTransform(outMat.diffuseTransform))
+    {
+        outMat.specularTransform = outMat.diffuseTransform;
+    }
+
+    if (!outMat.emissiveTextureName.empty() && IsNearlyBlack3(outMat.emissiveColor))
+    {
+        FillColor4(outMat.emissiveColor, 1.0, 1.0, 1.0, 1.0);
+    }
+
+    if (!outMat.specularTextureName.empty())
+    {
+        if (IsNearlyBlack3(outMat.specularColor))
+        {
+            outMat.specularColor[0] = 1.0f;
+            outMat.specularColor[1] = 1.0f;
+            outMat.specularColor[2] = 1.0f;
+        }
+
+        if (outMat.specularColor[3] <= 0.0f)
+        {
+            outMat.specularColor[3] = 32.0f;
+        }
+    }
+}
+
+// ==========================================================
+// FBX Node Geometric Transform ( )
+// ==========================================================
+
+inline int GetPolygonMaterialSlot(FbxNode* node, FbxMesh* mesh, int polygonIndex)
+{
+    if (!node || !mesh) return 0;
+
+    const int nodeMaterialCount = node->GetMaterialCount();
+    if (nodeMaterialCount <= 1) return 0;
+
+    FbxGeometryElementMaterial* matElem = mesh->GetElementMaterial();
+    if (!matElem) return 0;
+
+    int localMaterialSlot = 0;
+
+    if (matElem->GetMappingMode() == FbxGeometryElement::eByPolygon)
+    {
+        if (polygonIndex >= 0 && polygonIndex < matElem->GetIndexArray().GetCount())
+            localMaterialSlot = matElem->GetIndexArray().GetAt(polygonIndex);
+    }
+    else if (matElem->GetMappingMode() == FbxGeometryElement::eAllSame)
+    {
+        if (matElem->GetIndexArray().GetCount() > 0)
+            localMaterialSlot = matElem->GetIndexArray().GetAt(0);
+    }
+    else
+    {
+        localMaterialSlot = 0;
+    }
+
+    if (localMaterialSlot < 0 || localMaterialSlot >= nodeMaterialCount)
+        localMaterialSlot = 0;
+
+    return localMaterialSlot;
+}
+
+// ==========================================================
+//  ü Ƽ  (̸  ߺ , ߰  ε)
+// - skipNode true  Ƽ ǳʶٰ ڽ  ȸ
+// ==========================================================
+
+inline void CollectSceneMaterials(
+    FbxNode* root,
+    std::vector<Material>& materials,
+    std::unordered_map<std::string, uint32_t>& materialNameToIndex,
+    bool dumpDebug,
+    const std::function<bool(FbxNode*)>& skipNode = {})
+{
+    std::function<void(FbxNode*)> visit = [&](FbxNode* node)
+        {
+            if (!node) return;
+
+            if (!skipNode || !skipNode(node))
+            {
+                const int matCount = node->GetMaterialCount();
+                for (int i = 0; i < matCount; ++i)
+                {
+                    FbxSurfaceMaterial* mat = node->GetMaterial(i);
+                    if (!mat) continue;
+
+                    std::string matName = mat->GetName();
+                    if (materialNameToIndex.count(matName)) continue;
+
+                    Material m{};
+                    m.name = matName;
+                    ExtractMaterialAttributes(mat, m);
+
+                    if (dumpDebug)
+                        DumpMaterialDebug(mat);
+
+                    const uint32_t idx = (uint32_t)materials.size();
+                    materials.push_back(std::move(m));
+                    materialNameToIndex[matName] = idx;
+                }
+            }
+
+            for (int i = 0; i < node->GetChildCount(); ++i)
+                visit(node->GetChild(i));
+        };
+
+    visit(root);
+}
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <fbxsdk.h>
+
+#include "FbxMaterialExtract.h"
+
+// ==========================================================
+//   ߺ  (Static / Skinned  )
+// - ﰢ  3   ʰ,  鼭 ٷ εȭ
+// - Ű = control point + /UV   ( ε ã  )
+//   IndexToDirect ε   Ű,
+//   Direct(   ϳ)   
+// - control point  Ʈ ã´ (ؽ ,  ĺ 1~4)
+// - 1 н slot ﰢ   迭 Ȯ ´
+// -  Ӽ (ȯ/źƮ) ȣ :     ϸ 
+// ==========================================================
+
+//   ϳ ó  ġ
+struct FbxPolygonVertexRef
+{
+    int polygon = -1;
+    int vertexInPolygon = 0;
+    int controlPoint = -1;
+};
+
+// material slot ϳ з
+struct FbxDedupedSlot
+{
+    std::vector<int> triangles;                 //  slot   ȣ ( )
+    std::vector<uint32_t> indices;              // ﰢ 3, FBX    (winding  ȣ)
+    std::vector<FbxPolygonVertexRef> vertices;  //   (ó   = ε)
+};
+
+//  / 带 Ǯ DirectArray ε (-1 = )
+template <class T>
+inline int GetLayerElementDirectIndex(
+    const FbxLayerElementTemplate<T>* element,
+    int controlPoint,
+    int polygonVertex,
+    int polygon)
+{
+    if (!element) return -1;
+
+    int index = -1;
+    switch (element->GetMappingMode())
+    {
+    case FbxGeometryElement::eByControlPoint:  index = controlPoint;  break;
+    case FbxGeometryElement::eByPolygonVertex: index = polygonVertex; break;
+    case FbxGeometryElement::eByPolygon:       index = polygon;       break;
+    case FbxGeometryElement::eAllSame:         index = 0;             break;
+    default: return -1;
+    }
+
+    if (element->GetReferenceMode() != FbxGeometryElement::eDirect)
+    {
+        const auto& indexArray = element->GetIndexArray();
+        if (index < 0 || index >= indexArray.GetCount()) return -1;
+        index = indexArray.GetAt(index);
+    }
+
+    if (index < 0 || index >= element->GetDirectArray().GetCount()) return -1;
+    return index;
+}
+
+inline uint32_t FbxDedupFloatBits(double v)
+{
+    const float f = static_cast<float>(v);
+    uint32_t bits = 0;
+    std::memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+// ----------------------------------------------------------
+// ﰢ ޽(Triangulate ) material slot   ߺ 
+// - outSlots[slot].vertices    slot   
+// ----------------------------------------------------------
+inline void DedupPolygonVertices(
+    FbxNode* node,
+    FbxMesh* mesh,
+    int slotCount,
+    const char* uvSetName,
+    std::vector<FbxDedupedSlot>& outSlots)
+{
+    outSlots.clear();
+    outSlots.resize(std::max(1, slotCount));
+    if (!node || !mesh) return;
+
+    const int polyCount = mesh->GetPolygonCount();
+    const int cpCount = mesh->GetControlPointsCount();
+
+    // 1) slot ﰢ   -> Ȯ ũ Ҵ
+    std::vector<int> polygonSlot(polyCount, 0);
+    std::vector<uint32_t> slotTriangleCount(outSlots.size(), 0);
+
+    for (int p = 0; p < polyCount; ++p)
+    {
+        int slot = GetPolygonMaterialSlot(node, mesh, p);
+        if (slot < 0 || slot >= static_cast<int>(outSlots.size()))
+            slot = 0;
+
+        polygonSlot[p] = slot;
+        ++slotTriangleCount[slot];
+    }
+
+    for (size_t s = 0; s < outSlots.size(); ++s)
+    {
+        outSlots[s].triangles.reserve(slotTriangleCount[s]);
+        outSlots[s].indices.reserve(static_cast<size_t>(slotTriangleCount[s]) * 3);
+    }
+
+    // 2) control point ĺ Ʈ ߺ 
+    struct Candidate
+    {
+        uint32_t next;
+        uint32_t slot;
+        uint32_t normal[3];
+        uint32_t uv[2];
+        uint32_t index;
+    };
+
+    static constexpr uint32_t kNoCandidate = UINT32_MAX;
+
+    //  ĭ   control point
+    std::vector<uint32_t> headByControlPoint(static_cast<size_t>(cpCount) + 1, kNoCandidate);
+    std::vector<Candidate> candidates;
+    candidates.reserve(static_cast<size_t>(cpCount) + cpCount / 2);
+
+    const FbxGeometryElementNormal* normalElement =
+        (mesh->GetElementNormalCount() > 0) ? mesh->GetElementNormal(0) : nullptr;
+    const FbxGeometryElementUV* uvElement =
+        uvSetName ? mesh->GetElementUV(uvSetName) : nullptr;
+
+    for (int p = 0; p < polyCount; ++p)
+    {
+        FbxDedupedSlot& ds = outSlots[polygonSlot[p]];
+        ds.triangles.push_back(p);
+
+        const int polygonStart = mesh->GetPolygonVertexIndex(p);
+
+        for (int k = 0; k < 3; ++k)
+        {
+            int cpIdx = mesh->GetPolygonVertex(p, k);
+            if (cpIdx < 0 || cpIdx >= cpCount) cpIdx = -1;
+
+            Candidate key{};
+            key.slot = static_cast<uint32_t>(polygonSlot[p]);
+
+            const int normalIndex =
+                GetLayerElementDirectIndex(normalElement, cpIdx, polygonStart + k, p);
+            if (normalIndex >= 0)
+            {
+                const FbxVector4 n = normalElement->GetDirectArray().GetAt(normalIndex);
+                key.normal[0] = FbxDedupFloatBits(n[0]);
+                key.normal[1] = FbxDedupFloatBits(n[1]);
+                key.normal[2] = FbxDedupFloatBits(n[2]);
+            }
+
+            const int uvIndex =
+                GetLayerElementDirectIndex(uvElement, cpIdx, polygonStart + k, p);
+            if (uvIndex >= 0)
+            {
+                const FbxVector2 uv = uvElement->GetDirectArray().GetAt(uvIndex);
+                key.uv[0] = FbxDedupFloatBits(uv[0]);
+                key.uv[1] = FbxDedupFloatBits(uv[1]);
+            }
+
+            uint32_t& head = headByControlPoint[cpIdx >= 0 ? cpIdx : cpCount];
+
+            uint32_t found = kNoCandidate;
+            for (uint32_t c = head; c != kNoCandidate; c = candidates[c].next)
+            {
+                const Candidate& cand = candidates[c];
+                if (cand.slot == key.slot &&
+                    std::memcmp(cand.normal, key.normal, sizeof(key.normal)) == 0 &&
+                    std::memcmp(cand.uv, key.uv, sizeof(key.uv)) == 0)
+                {
+                    found = cand.index;
+                    break;
+                }
+            }
+
+            if (found == kNoCandidate)
+            {
+                found = static_cast<uint32_t>(ds.vertices.size());
+
+                FbxPolygonVertexRef ref{};
+                ref.polygon = p;
+                ref.vertexInPolygon = k;
+                ref.controlPoint = cpIdx;
+                ds.vertices.push_back(ref);
+
+                key.index = found;
+                key.next = head;
+                head = static_cast<uint32_t>(candidates.size());
+                candidates.push_back(key);
+            }
+
+            ds.indices.push_back(found);
+        }
+    }
+}
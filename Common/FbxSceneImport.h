@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string>
+
+#include <fbxsdk.h>
+
+#include "BatchExport.h"
+
+// ==========================================================
+// FBX Ʈ +  ó (Static / Skinned / Anime /   )
+// - ǥ/ ȯ Triangulate Ʈ   
+//   ( Լ ̹ ȯ  ޴´)
+// ==========================================================
+
+inline FbxScene* ImportFbxScene(
+    FbxManager* manager,
+    const std::string& fbxFileName,
+    const std::string& sceneName)
+{
+    FbxImporter* importer = FbxImporter::Create(manager, "");
+    if (!importer->Initialize(fbxFileName.c_str(), -1, manager->GetIOSettings()))
+    {
+        BatchLog() << "FBX   : " << fbxFileName << "\n";
+        importer->Destroy();
+        return nullptr;
+    }
+
+    FbxScene* scene = FbxScene::Create(manager, sceneName.c_str());
+    importer->Import(scene);
+    importer->Destroy();
+    return scene;
+}
+
+// DirectX ǥ + meter 
+inline void ConvertSceneToExportSpace(FbxScene* scene)
+{
+    FbxAxisSystem::DirectX.ConvertScene(scene);
+    FbxSystemUnit::m.ConvertScene(scene);
+}
+
+inline void TriangulateScene(FbxScene* scene)
+{
+    FbxGeometryConverter conv(scene->GetFbxManager());
+    conv.Triangulate(scene, true);
+}
@@ -0,0 +1,335 @@
+#pragma once
+
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+#include <vector>
+
+#include "../StaticModelBinExtractor/ModelBinExtractor/meshoptimizer.h"
+#include "BinaryWriter.h"
+#include "MbinFormat.h"
+
+// ==========================================================
+// ޽ Ŭ LOD DAG ( LOD,  )
+// - ̻ LOD    ϳ  ܰ Ŭ͸ 
+//   Ÿ Ŭ͸    (MbinClusterLodRecord )
+// -  
+//     1) LOD0 ε ۷ Ŭ(meshlet) ,  0
+//     2)  Ŭ͸ meshopt_partitionClusters ׷ 
+//     3) ׷츶 ﰢ   (meshopt_SimplifyLockBorder) ܼȭ
+//        -> ̿ ׷ ´   ̹Ƿ ܰ谡  տ 
+//     4) ܼȭ  ٽ Ŭͷ  (self = ׷ /),
+//         Ŭ parent =  ׷ /
+//     5) ŬͰ ϳ ų     2) ݺ,   Ʈ
+// -  ޽ LOD0  迭 ״  (ܼȭ ε ٲ۴)
+// -  ġ(v5/v6) Ͽ ޽( meshlet)  ڿ ٴ´ (MBIN_FLAG_CLUSTER_LOD)
+//     ޽ø
+//       uint32 clusterCount, uint32 vertexRefCount, uint32 triangleBytes, uint32 depthCount
+//       MbinClusterLodRecord x clusterCount
+//       uint32 x vertexRefCount
+//       uint8 x triangleBytes     (Ŭ͸ 4Ʈ )
+// - v7 MbinSectionedFormat.h Ŭ LOD ǵ
+// ==========================================================
+
+struct MbinClusterLodSettings
+{
+    uint32_t maxVertices = 64;       // <= 256
+    uint32_t maxTriangles = 124;     // <= 256
+    uint32_t groupSize = 8;          // ׷ ǥ Ŭ  ( +1/3 Ŀ  )
+    float simplifyRatio = 0.5f;      // ׷ ܼȭ ﰢ ǥ 
+    float minReduction = 0.85f;      // ܼȭ    ũ з   ܰ ̷
+    float normalWeight = 0.5f;
+    float uvWeight = 1.0f;
+    uint32_t maxDepth = 16;
+};
+
+struct MbinSubMeshClusterLod
+{
+    std::vector<MbinClusterLodRecord> clusters;
+    std::vector<uint32_t> vertices;
+    std::vector<uint8_t> triangles;
+    uint32_t depthCount = 0;
+};
+
+namespace MbinClusterLodDetail
+{
+    struct WorkCluster
+    {
+        std::vector<uint32_t> vertices;   // ޽  ε
+        std::vector<uint8_t> triangles;   // vertices   ε
+        float selfCenter[3];
+        float selfRadius;
+        float selfError;
+        float parentCenter[3];
+        float parentRadius;
+        float parentError;
+        uint32_t depth;
+    };
+
+    inline void AppendGlobalIndices(const WorkCluster& c, std::vector<uint32_t>& out)
+    {
+        for (uint8_t t : c.triangles)
+            out.push_back(c.vertices[t]);
+    }
+
+    // indices Ŭͷ  out ڿ δ
+    // group:  ﰢ  ׷ / (nullptr = , Ŭ ڱ  +  0)
+    inline void AppendClusters(
+        const std::vector<uint32_t>& indices,
+        const float* positions,
+        size_t vertexCount,
+        size_t vertexStride,
+        const MbinClusterLodSettings& settings,
+        const meshopt_Bounds* group,
+        float groupError,
+        uint32_t depth,
+        std::vector<WorkCluster>& out)
+    {
+        const size_t maxMeshlets = meshopt_buildMeshletsBound(indices.size(), settings.maxVertices, settings.maxTriangles);
+        std::vector<meshopt_Meshlet> meshlets(maxMeshlets);
+        std::vector<uint32_t> meshletVertices(indices.size());
+        std::vector<uint8_t> meshletTriangles(indices.size());
+
+        // ׷    ϹǷ   ġ 0
+        const size_t meshletCount = meshopt_buildMeshlets(
+            meshlets.data(),
+            meshletVertices.data(),
+            meshletTriangles.data(),
+            indices.data(),
+            indices.size(),
+            positions,
+            vertexCount,
+            vertexStride,
+            settings.maxVertices,
+            settings.maxTriangles,
+            0.0f);
+
+        for (size_t i = 0; i < meshletCount; ++i)
+        {
+            const meshopt_Meshlet& m = meshlets[i];
+            uint32_t* mv = &meshletVertices[m.vertex_offset];
+            uint8_t* mt = &meshletTriangles[m.triangle_offset];
+            meshopt_optimizeMeshlet(mv, mt, m.triangle_count, m.vertex_count);
+
+            WorkCluster c{};
+            c.vertices.assign(mv, mv + m.vertex_count);
+            c.triangles.assign(mt, mt + m.triangle_count * 3);
+            c.depth = depth;
+
+            const meshopt_Bounds bounds = group ? *group :
+                meshopt_computeMeshletBounds(mv, mt, m.triangle_count, positions, vertexCount, vertexStride);
+            for (int k = 0; k < 3; ++k) c.selfCenter[k] = bounds.center[k];
+            c.selfRadius = bounds.radius;
+            c.selfError = group ? groupError : 0.0f;
+
+            // Ʈ ⺻ (׷ ܼȭ ϸ )
+            for (int k = 0; k < 3; ++k) c.parentCenter[k] = c.selfCenter[k];
+            c.parentRadius = c.selfRadius;
+            c.parentError = FLT_MAX;
+
+            out.push_back(std::move(c));
+        }
+    }
+}
+
+// VertexT: position[3], normal[3], uv[2]  տ 
+// indices:  ĳ/ġ ȭ  LOD0 ε 
+template <class VertexT>
+inline void BuildMbinSubMeshClusterLod(
+    const std::vector<VertexT>& vertices,
+    const std::vector<uint32_t>& indices,
+    const MbinClusterLodSettings& settings,
+    MbinSubMeshClusterLod& out)
+{
+    using MbinClusterLodDetail::WorkCluster;
+
+    out = MbinSubMeshClusterLod{};
+    if (vertices.empty() || indices.size() < 3) return;
+
+    const float* positions = &vertices[0].position[0];
+    const float* attributes = &vertices[0].normal[0];
+    const size_t vertexCount = vertices.size();
+    const size_t stride = sizeof(VertexT);
+
+    const float attrWeights[5] =
+    {
+        settings.normalWeight, settings.normalWeight, settings.normalWeight,
+        settings.uvWeight, settings.uvWeight
+    };
+
+    std::vector<WorkCluster> clusters;
+    MbinClusterLodDetail::AppendClusters(indices, positions, vertexCount, stride, settings, nullptr, 0.0f, 0, clusters);
+
+    std::vector<uint32_t> pending(clusters.size());
+    for (size_t i = 0; i < pending.size(); ++i)
+        pending[i] = static_cast<uint32_t>(i);
+
+    std::vector<uint32_t> clusterIndices;
+    std::vector<uint32_t> clusterIndexCounts;
+    std::vector<uint32_t> partition;
+    std::vector<uint32_t> merged;
+    std::vector<uint32_t> simplified;
+    std::vector<float> childCenters;
+    std::vector<float> childRadii;
+
+    for (uint32_t depth = 0; pending.size() > 1 && depth < settings.maxDepth; ++depth)
+    {
+        // 1) ׷ 
+        clusterIndices.clear();
+        clusterIndexCounts.clear();
+        for (uint32_t id : pending)
+        {
+            MbinClusterLodDetail::AppendGlobalIndices(clusters[id], clusterIndices);
+            clusterIndexCounts.push_back(static_cast<uint32_t>(clusters[id].triangles.size()));
+        }
+
+        partition.assign(pending.size(), 0);
+        const size_t groupCount = meshopt_partitionClusters(
+            partition.data(),
+            clusterIndices.data(),
+            clusterIndices.size(),
+            clusterIndexCounts.data(),
+            pending.size(),
+            positions,
+            vertexCount,
+            stride,
+            settings.groupSize);
+
+        std::vector<std::vector<uint32_t>> groups(groupCount);
+        for (size_t i = 0; i < pending.size(); ++i)
+            groups[partition[i]].push_back(pending[i]);
+
+        // 2) ׷츶 ܼȭ -> ٽ Ŭ
+        std::vector<uint32_t> nextPending;
+        bool progressed = false;
+
+        for (const std::vector<uint32_t>& group : groups)
+        {
+            merged.clear();
+            float maxChildError = 0.0f;
+            for (uint32_t id : group)
+            {
+                MbinClusterLodDetail::AppendGlobalIndices(clusters[id], merged);
+                maxChildError = std::max(maxChildError, clusters[id].selfError);
+            }
+
+            const size_t targetIndexCount =
+                static_cast<size_t>(merged.size() / 3 * settings.simplifyRatio) * 3;
+
+            // Sparse: ׷ ޽ Ϻζ  ε  ϰ
+            // ErrorAbsolute: ܰ谡 ޶  (޽ ǥ) 
+            simplified.resize(merged.size());
+            float simplifyError = 0.0f;
+            const size_t simplifiedCount = meshopt_simplifyWithAttributes(
+                simplified.data(),
+                merged.data(),
+                merged.size(),
+                positions,
+                vertexCount,
+                stride,
+                attributes,
+                stride,
+                attrWeights,
+                5,
+                nullptr,
+                targetIndexCount,
+                FLT_MAX,
+                meshopt_SimplifyLockBorder | meshopt_SimplifySparse | meshopt_SimplifyErrorAbsolute,
+                &simplifyError);
+
+            if (simplifiedCount == 0 || simplifiedCount > merged.size() * settings.minReduction)
+            {
+                // 谡 κ̶  پ ׷:  ܰ迡 ٸ ŬͿ ٽ ´
+                nextPending.insert(nextPending.end(), group.begin(), group.end());
+                continue;
+            }
+            progressed = true;
+            simplified.resize(simplifiedCount);
+
+            // ׷  ڽ  ü ΰ   -> ڽ -> θ  
+            childCenters.clear();
+            childRadii.clear();
+            for (uint32_t id : group)
+            {
+                childCenters.insert(childCenters.end(), clusters[id].selfCenter, clusters[id].selfCenter + 3);
+                childRadii.push_back(clusters[id].selfRadius);
+            }
+            const meshopt_Bounds groupBounds = meshopt_computeSphereBounds(
+                childCenters.data(), group.size(), sizeof(float) * 3, childRadii.data(), sizeof(float));
+            const float groupError = maxChildError + simplifyError;
+
+            for (uint32_t id : group)
+            {
+                WorkCluster& child = clusters[id];
+                for (int k = 0; k < 3; ++k) child.parentCenter[k] = groupBounds.center[k];
+                child.parentRadius = groupBounds.radius;
+                child.parentError = groupError;
+            }
+
+            const size_t firstNew = clusters.size();
+            MbinClusterLodDetail::AppendClusters(
+                simplified, positions, vertexCount, stride, settings, &groupBounds, groupError, depth + 1, clusters);
+            for (size_t id = firstNew; id < clusters.size(); ++id)
+                nextPending.push_back(static_cast<uint32_t>(id));
+        }
+
+        pending.swap(nextPending);
+        if (!progressed) break;
+    }
+
+    // 3)  (  =  )
+    out.clusters.reserve(clusters.size());
+    for (const WorkCluster& c : clusters)
+    {
+        MbinClusterLodRecord r{};
+        r.vertexOffset = static_cast<uint32_t>(out.vertices.size());
+        r.triangleOffset = static_cast<uint32_t>(out.triangles.size());
+        r.vertexCount = static_cast<uint32_t>(c.vertices.size());
+        r.triangleCount = static_cast<uint32_t>(c.triangles.size() / 3);
+        for (int k = 0; k < 3; ++k) r.selfCenter[k] = c.selfCenter[k];
+        r.selfRadius = c.selfRadius;
+        r.selfError = c.selfError;
+        for (int k = 0; k < 3; ++k) r.parentCenter[k] = c.parentCenter[k];
+        r.parentRadius = c.parentRadius;
+        r.parentError = c.parentError;
+        r.depth = c.depth;
+        out.clusters.push_back(r);
+
+        out.vertices.insert(out.vertices.end(), c.vertices.begin(), c.vertices.end());
+        out.triangles.insert(out.triangles.end(), c.triangles.begin(), c.triangles.end());
+        out.triangles.resize((out.triangles.size() + 3) & ~size_t(3), 0);
+
+        out.depthCount = std::max(out.depthCount, c.depth + 1);
+    }
+}
+
+//  ġ Ŭ LOD  (޽  ״)
+inline void WriteMbinClusterLodSection(BinaryWriter& out, const std::vector<MbinSubMeshClusterLod>& subMeshClusterLods)
+{
+    for (const MbinSubMeshClusterLod& c : subMeshClusterLods)
+    {
+        const uint32_t counts[4] =
+        {
+            static_cast<uint32_t>(c.clusters.size()),
+            static_cast<uint32_t>(c.vertices.size()),
+            static_cast<uint32_t>(c.triangles.size()),
+            c.depthCount,
+        };
+        out.WriteRaw(counts, sizeof(counts));
+        out.WriteRaw(c.clusters.data(), c.clusters.size() * sizeof(MbinClusterLodRecord));
+        out.WriteRaw(c.vertices.data(), c.vertices.size() * sizeof(uint32_t));
+        out.WriteRaw(c.triangles.data(), c.triangles.size());
+    }
+}
+
+inline size_t EstimateMbinClusterLodSectionBytes(const std::vector<MbinSubMeshClusterLod>& subMeshClusterLods)
+{
+    size_t bytes = 0;
+    for (const MbinSubMeshClusterLod& c : subMeshClusterLods)
+    {
+        bytes += sizeof(uint32_t) * 4;
+        bytes += c.clusters.size() * sizeof(MbinClusterLodRecord);
+        bytes += c.vertices.size() * sizeof(uint32_t) + c.triangles.size();
+    }
+    return bytes;
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "../StaticModelBinExtractor/ModelBinExtractor/meshoptimizer.h"
+#include "BinaryWriter.h"
+#include "MbinFormat.h"
+#include "MbinQuantize.h"
+
+// ==========================================================
+// ޽ ġ  Ʈ + ׸ ε ( н / ׸ڸʿ,  )
+// - ġ Ʈ: ޽  1:1, ġ ϰ
+//     float ̸ float x3 (12Ʈ)
+//     ȭ ̸ MbinQuantizedVertex::position ״ (uint16 x4, 8Ʈ,  Ķʹ ޽ )
+//   ->  н  ġ ̶ ̰ Ʈ  , Ϲ ε ۷ε ׸  ִ
+// - ׸ ε: meshopt_generateShadowIndexBuffer (ġ   = UV/ ŷθ   ϳ)
+//     ĳ ȭ. ġ Ʈ  ε  / ޽ÿ 
+// - /ε ȭ   ޽÷  Ѵ
+// -  Ʈ(MBIN_FLAG_COMPRESSED_STREAMS)̾ ״  (ε  ٷ ø)
+// -  ġ(v5/v6) Ͽ ٸ ΰ ǵ  ڿ ٴ´ (MBIN_FLAG_DEPTH_STREAMS)
+//     ޽ø
+//       uint32 positionStride, uint32 positionCount, uint32 shadowIndexCount
+//       uint8 x positionStride * positionCount
+//       uint32 x shadowIndexCount
+// - v7 MbinSectionedFormat.h DPRG/DPOS/DSHI 
+// ==========================================================
+
+struct MbinSubMeshDepthStream
+{
+    uint32_t positionStride = 0;
+    uint32_t positionCount = 0;
+    std::vector<uint8_t> positions;
+    std::vector<uint32_t> shadowIndices;
+};
+
+// VertexT: position[3]   (ȭ QuantizeMbinVertices  )
+template <class VertexT>
+inline void BuildMbinSubMeshDepthStream(
+    const std::vector<VertexT>& vertices,
+    const std::vector<uint32_t>& indices,
+    bool quantize,
+    bool positionHalf,
+    MbinSubMeshDepthStream& out)
+{
+    out = MbinSubMeshDepthStream{};
+    out.positionCount = static_cast<uint32_t>(vertices.size());
+
+    if (quantize)
+    {
+        std::vector<MbinQuantizedVertex> quantized;
+        MbinQuantizeParams params{};
+        QuantizeMbinVertices(vertices, positionHalf, quantized, params);
+
+        out.positionStride = sizeof(quantized[0].position);
+        out.positions.resize(size_t(out.positionStride) * quantized.size());
+        for (size_t i = 0; i < quantized.size(); ++i)
+            std::memcpy(&out.positions[i * out.positionStride], quantized[i].position, out.positionStride);
+    }
+    else
+    {
+        out.positionStride = sizeof(float) * 3;
+        out.positions.resize(size_t(out.positionStride) * vertices.size());
+        for (size_t i = 0; i < vertices.size(); ++i)
+            std::memcpy(&out.positions[i * out.positionStride], vertices[i].position, out.positionStride);
+    }
+
+    if (vertices.empty() || indices.empty()) return;
+
+    // Ǵ ġ Ʈ   ģ (ȭ ȭ   )
+    out.shadowIndices.resize(indices.size());
+    meshopt_generateShadowIndexBuffer(
+        out.shadowIndices.data(),
+        indices.data(),
+        indices.size(),
+        out.positions.data(),
+        vertices.size(),
+        out.positionStride,
+        out.positionStride);
+
+    meshopt_optimizeVertexCache(out.shadowIndices.data(), out.shadowIndices.data(), indices.size(), vertices.size());
+}
+
+//  ġ  Ʈ  (޽  ״)
+inline void WriteMbinDepthStreamSection(BinaryWriter& out, const std::vector<MbinSubMeshDepthStream>& depthStreams)
+{
+    for (const MbinSubMeshDepthStream& d : depthStreams)
+    {
+        const uint32_t counts[3] =
+        {
+            d.positionStride,
+            d.positionCount,
+            static_cast<uint32_t>(d.shadowIndices.size()),
+        };
+        out.WriteRaw(counts, sizeof(counts));
+        out.WriteRaw(d.positions.data(), d.positions.size());
+        out.WriteRaw(d.shadowIndices.data(), d.shadowIndices.size() * sizeof(uint32_t));
+    }
+}
+
+inline size_t EstimateMbinDepthStreamSectionBytes(const std::vector<MbinSubMeshDepthStream>& depthStreams)
+{
+    size_t bytes = 0;
+    for (const MbinSubMeshDepthStream& d : depthStreams)
+        bytes += sizeof(uint32_t) * 3 + d.positions.size() + d.shadowIndices.size() * sizeof(uint32_t);
+    return bytes;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+
+// ==========================================================
+// MBIN    (Static / Skinned  )
+// - : 'MBIN', version, flags, boneCount, materialCount, subMeshCount
+// - ⺻   ٸ (Static v5, Skinned v3)
+// - flags Ʈ ޽  /ε ġ ٲٰų ڿ ٴ  ˸
+// ==========================================================
+
+static constexpr uint32_t kMbinQuantizedVersion = 6;
+
+enum MbinHeaderFlags : uint32_t
+{
+    MBIN_FLAG_QUANTIZED_VERTEX = 1u << 0,    // 32Ʈ ȭ  (MbinQuantize.h)
+    MBIN_FLAG_POSITION_HALF = 1u << 1,       // ȭ ġ fp16
+    MBIN_FLAG_COMPRESSED_STREAMS = 1u << 2,  // /ε meshopt ڵ Ʈ (MbinStreamCodec.h)
+    MBIN_FLAG_MESHLETS = 1u << 3,            // ޽ ڿ meshlet  (MbinMeshlet.h)
+    MBIN_FLAG_MESHLETS_ENCODED = 1u << 4,    // meshlet /ﰢ meshopt_encodeMeshlet Ʈ
+    MBIN_FLAG_CLUSTER_LOD = 1u << 5,         // ޽ ڿ Ŭ LOD DAG  (MbinClusterLod.h)
+    MBIN_FLAG_DRAW_RANGES = 1u << 6,         // Ƽ  ޽ +   draw range 
+    MBIN_FLAG_INSTANCES = 1u << 7,           // νϽ  ޽ + νϽ ȯ ̺ 
+    MBIN_FLAG_INDEX16 = 1u << 8,             // v7:  65536  ޽ô 16Ʈ ε (indexStride 2)
+    MBIN_FLAG_DEPTH_STREAMS = 1u << 9,       // ġ  Ʈ + ׸ ε  (MbinDepthStream.h)
+};
+
+// ----------------------------------------------------------
+// Meshlet ڵ (MBIN_FLAG_MESHLETS,  ġ v7 )
+// -  ޽ ϳ meshlet 迭 
+//   ⺻: vertexOffset = meshlet  (uint32) 迭  ε,
+//         triangleOffset = ﰢ Ʈ 迭  Ʈ  (ﰢ  ε 3Ʈ, meshlet 4Ʈ )
+//   MBIN_FLAG_MESHLETS_ENCODED: vertexOffset = ڵ Ʈ  Ʈ ,
+//         triangleOffset =  meshlet ڵ Ʈ  (meshopt_decodeMeshlet ״)
+// ----------------------------------------------------------
+struct MbinMeshletRecord
+{
+    uint32_t vertexOffset;
+    uint32_t triangleOffset;
+    uint32_t vertexCount;
+    uint32_t triangleCount;
+};
+static_assert(sizeof(MbinMeshletRecord) == 16, "MbinMeshletRecord must be 16 bytes");
+
+// meshopt_Bounds  ġ (culling:  +  , s8  x / 127)
+struct MbinMeshletBoundsRecord
+{
+    float center[3];
+    float radius;
+    float coneApex[3];
+    float coneAxis[3];
+    float coneCutoff;        // cos( ݰ)
+    int8_t coneAxisS8[3];
+    int8_t coneCutoffS8;
+};
+static_assert(sizeof(MbinMeshletBoundsRecord) == 48, "MbinMeshletBoundsRecord must be 48 bytes");
+
+// ----------------------------------------------------------
+// Ŭ LOD DAG ڵ (MBIN_FLAG_CLUSTER_LOD,  ġ v7 )
+// - vertexOffset/triangleOffset/vertexCount/triangleCount: ڵ   MbinMeshletRecord  
+//   (޽ ϳ Ŭ   / ﰢ Ʈ 迭 )
+// - self:  Ŭ͸  ܼȭ / ( Ŭʹ ڱ ,  0)
+// - parent:  ŬͰ  ׷ ܼȭ  / (Ʈ parentError = FLT_MAX)
+//    ޽  밪,    ڽ -> θ  
+// - Ÿ :  (self) <= Ӱ谪 &&  (parent) > Ӱ谪  Ŭ͸ ׸
+//   ( ׷  parent Ƿ ׻ Բ õ -> տ )
+// ----------------------------------------------------------
+struct MbinClusterLodRecord
+{
+    uint32_t vertexOffset;
+    uint32_t triangleOffset;
+    uint32_t vertexCount;
+    uint32_t triangleCount;
+
+    float selfCenter[3];
+    float selfRadius;
+    float selfError;
+
+    float parentCenter[3];
+    float parentRadius;
+    float parentError;
+
+    uint32_t depth;          // 0 =  ﰢ
+    uint32_t reserved;
+};
+static_assert(sizeof(MbinClusterLodRecord) == 64, "MbinClusterLodRecord must be 64 bytes");
+
+// νϽ ÷ (MBIN_FLAG_INSTANCES)
+enum MbinInstanceFlags : uint32_t
+{
+    MBIN_INSTANCE_MIRRORED = 1u << 0,        // ȯ Ľ < 0: ﰢ    ׸ 
+};
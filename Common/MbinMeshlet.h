@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "../StaticModelBinExtractor/ModelBinExtractor/meshoptimizer.h"
+#include "BinaryWriter.h"
+#include "MbinFormat.h"
+
+// ==========================================================
+// ޽ meshlet  (޽ ̴ / GPU ø,  )
+// - meshopt_buildMeshlets -> meshlet  ȭ -> /  bounds
+// - /ε ȭ   ε ۷  Ѵ
+//   (meshlet   = ޽  迭 ε)
+// -  ġ(v5/v6) Ͽ ޽  ڿ ٴ´ (MBIN_FLAG_MESHLETS)
+//     ޽ø
+//       uint32 meshletCount, uint32 vertexRefCount, uint32 triangleBytes
+//       MbinMeshletRecord x meshletCount
+//       MbinMeshletBoundsRecord x meshletCount
+//       uint32 x vertexRefCount   (ڵ̸ 0)
+//       uint8 x triangleBytes     (ڵ̸ ڵ Ʈ ü)
+// - v7 MbinSectionedFormat.h meshlet ǵ
+// ==========================================================
+
+struct MbinMeshletSettings
+{
+    uint32_t maxVertices = 64;    // <= 256
+    uint32_t maxTriangles = 124;  // <= 256 (ڵ ), 4  
+    float coneWeight = 0.25f;     // 0 = ũ 켱, 1 =   ø ȿ 켱
+    bool encode = false;          // meshopt_encodeMeshlet
+};
+
+struct MbinSubMeshMeshlets
+{
+    std::vector<MbinMeshletRecord> meshlets;
+    std::vector<MbinMeshletBoundsRecord> bounds;
+    std::vector<uint32_t> vertices;   // ڵ̸  
+    std::vector<uint8_t> triangles;   // ڵ̸ ڵ Ʈ
+};
+
+static_assert(sizeof(MbinMeshletRecord) == sizeof(meshopt_Meshlet), "MbinMeshletRecord must match meshopt_Meshlet");
+
+inline MbinMeshletBoundsRecord MakeMbinMeshletBoundsRecord(const meshopt_Bounds& b)
+{
+    MbinMeshletBoundsRecord r{};
+    std::memcpy(r.center, b.center, sizeof(r.center));
+    r.radius = b.radius;
+    std::memcpy(r.coneApex, b.cone_apex, sizeof(r.coneApex));
+    std::memcpy(r.coneAxis, b.cone_axis, sizeof(r.coneAxis));
+    r.coneCutoff = b.cone_cutoff;
+    std::memcpy(r.coneAxisS8, b.cone_axis_s8, sizeof(r.coneAxisS8));
+    r.coneCutoffS8 = b.cone_cutoff_s8;
+    return r;
+}
+
+// VertexT: position[3]  
+template <class VertexT>
+inline void BuildMbinSubMeshMeshlets(
+    const std::vector<VertexT>& vertices,
+    const std::vector<uint32_t>& indices,
+    const MbinMeshletSettings& settings,
+    MbinSubMeshMeshlets& out)
+{
+    out = MbinSubMeshMeshlets{};
+    if (vertices.empty() || indices.size() < 3) return;
+
+    const float* positions = &vertices[0].position[0];
+
+    const size_t maxMeshlets = meshopt_buildMeshletsBound(indices.size(), settings.maxVertices, settings.maxTriangles);
+    std::vector<meshopt_Meshlet> meshlets(maxMeshlets);
+    std::vector<uint32_t> meshletVertices(indices.size());
+    std::vector<uint8_t> meshletTriangles(indices.size());
+
+    const size_t meshletCount = meshopt_buildMeshlets(
+        meshlets.data(),
+        meshletVertices.data(),
+        meshletTriangles.data(),
+        indices.data(),
+        indices.size(),
+        positions,
+        vertices.size(),
+        sizeof(VertexT),
+        settings.maxVertices,
+        settings.maxTriangles,
+        settings.coneWeight);
+
+    meshlets.resize(meshletCount);
+    out.meshlets.reserve(meshletCount);
+    out.bounds.reserve(meshletCount);
+
+    std::vector<uint8_t> encoded(settings.encode ? meshopt_encodeMeshletBound(settings.maxVertices, settings.maxTriangles) : 0);
+
+    for (const meshopt_Meshlet& m : meshlets)
+    {
+        uint32_t* mv = &meshletVertices[m.vertex_offset];
+        uint8_t* mt = &meshletTriangles[m.triangle_offset];
+
+        // ڵ level 3 /ð  (ﰢ    ȸ  )
+        if (settings.encode)
+            meshopt_optimizeMeshletLevel(mv, m.vertex_count, mt, m.triangle_count, 3);
+        else
+            meshopt_optimizeMeshlet(mv, mt, m.triangle_count, m.vertex_count);
+
+        out.bounds.push_back(MakeMbinMeshletBoundsRecord(meshopt_computeMeshletBounds(
+            mv, mt, m.triangle_count, positions, vertices.size(), sizeof(VertexT))));
+
+        MbinMeshletRecord r{};
+        r.vertexCount = m.vertex_count;
+        r.triangleCount = m.triangle_count;
+
+        if (settings.encode)
+        {
+            const size_t bytes = meshopt_encodeMeshlet(encoded.data(), encoded.size(), mv, m.vertex_count, mt, m.triangle_count);
+            r.vertexOffset = static_cast<uint32_t>(out.triangles.size());
+            r.triangleOffset = static_cast<uint32_t>(bytes);
+            out.triangles.insert(out.triangles.end(), encoded.begin(), encoded.begin() + bytes);
+        }
+        else
+        {
+            r.vertexOffset = static_cast<uint32_t>(out.vertices.size());
+            r.triangleOffset = static_cast<uint32_t>(out.triangles.size());
+            out.vertices.insert(out.vertices.end(), mv, mv + m.vertex_count);
+            out.triangles.insert(out.triangles.end(), mt, mt + m.triangle_count * 3);
+            out.triangles.resize((out.triangles.size() + 3) & ~size_t(3), 0);
+        }
+
+        out.meshlets.push_back(r);
+    }
+}
+
+//  ġ meshlet  (޽  ״)
+inline void WriteMbinMeshletSection(BinaryWriter& out, const std::vector<MbinSubMeshMeshlets>& subMeshMeshlets)
+{
+    for (const MbinSubMeshMeshlets& m : subMeshMeshlets)
+    {
+        const uint32_t counts[3] =
+        {
+            static_cast<uint32_t>(m.meshlets.size()),
+            static_cast<uint32_t>(m.vertices.size()),
+            static_cast<uint32_t>(m.triangles.size()),
+        };
+        out.WriteRaw(counts, sizeof(counts));
+        out.WriteRaw(m.meshlets.data(), m.meshlets.size() * sizeof(MbinMeshletRecord));
+        out.WriteRaw(m.bounds.data(), m.bounds.size() * sizeof(MbinMeshletBoundsRecord));
+        out.WriteRaw(m.vertices.data(), m.vertices.size() * sizeof(uint32_t));
+        out.WriteRaw(m.triangles.data(), m.triangles.size());
+    }
+}
+
+inline size_t EstimateMbinMeshletSectionBytes(const std::vector<MbinSubMeshMeshlets>& subMeshMeshlets)
+{
+    size_t bytes = 0;
+    for (const MbinSubMeshMeshlets& m : subMeshMeshlets)
+    {
+        bytes += sizeof(uint32_t) * 3;
+        bytes += m.meshlets.size() * (sizeof(MbinMeshletRecord) + sizeof(MbinMeshletBoundsRecord));
+        bytes += m.vertices.size() * sizeof(uint32_t) + m.triangles.size();
+    }
+    return bytes;
+}
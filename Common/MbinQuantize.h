@@ -0,0 +1,181 @@
+#pragma once
+
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "../StaticModelBinExtractor/ModelBinExtractor/meshoptimizer.h"
+#include "MbinFormat.h"
+
+// ==========================================================
+// MBIN v6 ȭ  (Static / Skinned  ,  )
+// - 80Ʈ float  -> 32Ʈ
+//   position : unorm16 x3 (޽ AABB ) Ǵ fp16 x3, w = 0
+//   normal   : 16bit Ÿ已 (meshopt_encodeFilterOct, z = 1.0, w = 0)
+//   tangent  : 8bit Ÿ已, w = ȣ(+-127)
+//   uv       : unorm16 x2 (޽ UV  , 0~1  Ÿϸ UV ״)
+//   bone     : uint8 ε x4 + unorm8 ġ x4 (ġ  = Ȯ 255,   0)
+// - : value = offset + q / 65535 * scale (fp16 ġ offset/scale )
+//   normal/tangent meshopt_decodeFilterOct Ǵ ̴  
+// ==========================================================
+
+struct MbinQuantizedVertex
+{
+    uint16_t position[4];
+    int16_t normal[4];
+    int8_t tangent[4];
+    uint16_t uv[2];
+    uint8_t boneIndices[4];
+    uint8_t boneWeights[4];
+};
+static_assert(sizeof(MbinQuantizedVertex) == 32, "MbinQuantizedVertex must be 32 bytes");
+
+// ޽ø Ͽ ״  (float 10)
+struct MbinQuantizeParams
+{
+    float positionOffset[3] = { 0.0f, 0.0f, 0.0f };
+    float positionScale[3] = { 1.0f, 1.0f, 1.0f };
+    float uvOffset[2] = { 0.0f, 0.0f };
+    float uvScale[2] = { 1.0f, 1.0f };
+};
+static_assert(sizeof(MbinQuantizeParams) == sizeof(float) * 10, "MbinQuantizeParams must be tightly packed");
+
+// ġ  Ȯ 255 ǵ (ִ  )
+inline void QuantizeBoneWeights(const float weights[4], uint8_t outWeights[4])
+{
+    float sum = 0.0f;
+    for (int i = 0; i < 4; ++i) sum += std::max(0.0f, weights[i]);
+
+    if (sum <= 0.0f)
+    {
+        for (int i = 0; i < 4; ++i) outWeights[i] = 0;
+        return;
+    }
+
+    int q[4];
+    float remainder[4];
+    int total = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        const float scaled = std::max(0.0f, weights[i]) / sum * 255.0f;
+        q[i] = static_cast<int>(scaled);
+        remainder[i] = scaled - static_cast<float>(q[i]);
+        total += q[i];
+    }
+
+    // ڶ ŭ  ū  1
+    while (total < 255)
+    {
+        int best = 0;
+        for (int i = 1; i < 4; ++i)
+            if (remainder[i] > remainder[best]) best = i;
+
+        ++q[best];
+        remainder[best] = -1.0f;
+        ++total;
+    }
+
+    for (int i = 0; i < 4; ++i) outWeights[i] = static_cast<uint8_t>(q[i]);
+}
+
+inline uint16_t QuantizeUnorm16InRange(float v, float offset, float scale)
+{
+    const float t = (scale > 0.0f) ? (v - offset) / scale : 0.0f;
+    return static_cast<uint16_t>(meshopt_quantizeUnorm(t, 16));
+}
+
+// VertexT: position[3], normal[3], uv[2], tangent[4], boneIndices[4], boneWeights[4]
+// boneIndices ȣڰ 256 ̸ 
+template <class VertexT>
+inline void QuantizeMbinVertices(
+    const std::vector<VertexT>& src,
+    bool positionHalf,
+    std::vector<MbinQuantizedVertex>& out,
+    MbinQuantizeParams& params)
+{
+    out.assign(src.size(), MbinQuantizedVertex{});
+    params = MbinQuantizeParams{};
+    if (src.empty()) return;
+
+    float posMin[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+    float posMax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    float uvMin[2] = { FLT_MAX, FLT_MAX };
+    float uvMax[2] = { -FLT_MAX, -FLT_MAX };
+
+    for (const VertexT& v : src)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            posMin[c] = std::min(posMin[c], v.position[c]);
+            posMax[c] = std::max(posMax[c], v.position[c]);
+        }
+        for (int c = 0; c < 2; ++c)
+        {
+            uvMin[c] = std::min(uvMin[c], v.uv[c]);
+            uvMax[c] = std::max(uvMax[c], v.uv[c]);
+        }
+    }
+
+    if (!positionHalf)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            params.positionOffset[c] = posMin[c];
+            params.positionScale[c] = posMax[c] - posMin[c];
+        }
+    }
+    for (int c = 0; c < 2; ++c)
+    {
+        params.uvOffset[c] = uvMin[c];
+        params.uvScale[c] = uvMax[c] - uvMin[c];
+    }
+
+    // Ÿ已 ڵ float4 迭 Է
+    std::vector<float> normals(src.size() * 4);
+    std::vector<float> tangents(src.size() * 4);
+
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+        const VertexT& v = src[i];
+        MbinQuantizedVertex& q = out[i];
+
+        for (int c = 0; c < 3; ++c)
+        {
+            q.position[c] = positionHalf
+                ? meshopt_quantizeHalf(v.position[c])
+                : QuantizeUnorm16InRange(v.position[c], params.positionOffset[c], params.positionScale[c]);
+        }
+        q.position[3] = 0;
+
+        for (int c = 0; c < 2; ++c)
+            q.uv[c] = QuantizeUnorm16InRange(v.uv[c], params.uvOffset[c], params.uvScale[c]);
+
+        normals[i * 4 + 0] = v.normal[0];
+        normals[i * 4 + 1] = v.normal[1];
+        normals[i * 4 + 2] = v.normal[2];
+        normals[i * 4 + 3] = 0.0f;
+
+        tangents[i * 4 + 0] = v.tangent[0];
+        tangents[i * 4 + 1] = v.tangent[1];
+        tangents[i * 4 + 2] = v.tangent[2];
+        tangents[i * 4 + 3] = (v.tangent[3] < 0.0f) ? -1.0f : 1.0f;
+
+        for (int b = 0; b < 4; ++b)
+            q.boneIndices[b] = static_cast<uint8_t>(v.boneIndices[b]);
+        QuantizeBoneWeights(v.boneWeights, q.boneWeights);
+    }
+
+    //   stride 4/8 ̶  ڵ   ִ´
+    std::vector<int16_t> encodedNormals(src.size() * 4);
+    std::vector<int8_t> encodedTangents(src.size() * 4);
+    meshopt_encodeFilterOct(encodedNormals.data(), src.size(), sizeof(int16_t) * 4, 16, normals.data());
+    meshopt_encodeFilterOct(encodedTangents.data(), src.size(), sizeof(int8_t) * 4, 8, tangents.data());
+
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+        std::memcpy(out[i].normal, &encodedNormals[i * 4], sizeof(out[i].normal));
+        std::memcpy(out[i].tangent, &encodedTangents[i * 4], sizeof(out[i].tangent));
+    }
+}
@@ -0,0 +1,527 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MbinSectionedFormat.h"
+
+// ==========================================================
+// MBIN v7 δ (/ , FBX SDK ʿ)
+// -  б  ϰ /TOC/ڵ  ˻
+//   (Ľ/ ,   =  + ˻)
+// - /ε ʹ ε ޸𸮸 ״ Ų
+//   -> GPU ε ۿ ٷ memcpy (16Ʈ )
+//    Ʈ(MBIN_FLAG_COMPRESSED_STREAMS)̸ DecodeMbin*Stream  
+// - ʹ MbinFile  ִ ȸ ȿ
+// ==========================================================
+
+// ----------------------------------------------------------
+// б   
+// ----------------------------------------------------------
+class MbinMappedFile
+{
+public:
+    MbinMappedFile() = default;
+    ~MbinMappedFile() { Close(); }
+
+    MbinMappedFile(const MbinMappedFile&) = delete;
+    MbinMappedFile& operator=(const MbinMappedFile&) = delete;
+
+    bool Open(const std::filesystem::path& path, std::string* error = nullptr)
+    {
+        Close();
+
+#if defined(_WIN32)
+        m_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE)
+            return Fail(error, "  ");
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(m_file, &size) || size.QuadPart <= 0)
+            return Fail(error, " ");
+
+        m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!m_mapping)
+            return Fail(error, "  ");
+
+        m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!m_data)
+            return Fail(error, "  ");
+
+        m_size = static_cast<size_t>(size.QuadPart);
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return Fail(error, "  ");
+
+        struct stat st {};
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0)
+        {
+            ::close(fd);
+            return Fail(error, " ");
+        }
+
+        void* p = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); //  fd ݾƵ 
+        if (p == MAP_FAILED)
+            return Fail(error, "  ");
+
+        m_data = static_cast<const uint8_t*>(p);
+        m_size = static_cast<size_t>(st.st_size);
+#endif
+        return true;
+    }
+
+    void Close()
+    {
+#if defined(_WIN32)
+        if (m_data) UnmapViewOfFile(m_data);
+        if (m_mapping) CloseHandle(m_mapping);
+        if (m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+        m_mapping = nullptr;
+        m_file = INVALID_HANDLE_VALUE;
+#else
+        if (m_data) ::munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    const uint8_t* Data() const { return m_data; }
+    size_t Size() const { return m_size; }
+
+private:
+    bool Fail(std::string* error, const char* message)
+    {
+        if (error) *error = message;
+        Close();
+        return false;
+    }
+
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+
+#if defined(_WIN32)
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+#endif
+};
+
+// ----------------------------------------------------------
+// ޸𸮿 ö v7   ( )
+// - Open true   ˻   길
+// ----------------------------------------------------------
+class MbinView
+{
+public:
+    bool Open(const void* data, size_t size, std::string* error = nullptr)
+    {
+        *this = MbinView{};
+        m_data = static_cast<const uint8_t*>(data);
+        m_size = size;
+
+        if (!m_data || m_size < sizeof(MbinSectionedHeader))
+            return Fail(error, "  ");
+
+        m_header = reinterpret_cast<const MbinSectionedHeader*>(m_data);
+        if (std::memcmp(m_header->magic, "MBIN", 4) != 0)
+            return Fail(error, "MBIN  ƴ");
+        if (m_header->version != kMbinSectionedVersion)
+            return Fail(error, "v7( ġ)  ƴ");
+        if (m_header->headerBytes < sizeof(MbinSectionedHeader) || m_header->fileBytes != m_size)
+            return Fail(error, " ũ ġ (߸ ?)");
+
+        const uint64_t tocEnd = m_header->headerBytes + uint64_t(m_header->sectionCount) * sizeof(MbinSectionEntry);
+        if (tocEnd > m_size)
+            return Fail(error, "   ʰ");
+        m_toc = reinterpret_cast<const MbinSectionEntry*>(m_data + m_header->headerBytes);
+
+        for (uint32_t i = 0; i < m_header->sectionCount; ++i)
+        {
+            const MbinSectionEntry& e = m_toc[i];
+            if (e.offset % kMbinSectionAlignment != 0 || e.offset < tocEnd ||
+                e.offset > m_size || e.bytes > m_size - e.offset)
+                return Fail(error, "  ");
+        }
+
+        // ڿ ̺:  Ʈ '\0'̸  ̵ ϰ 
+        const MbinSectionEntry* strings = FindSection(MBIN_SECTION_STRINGS);
+        if (!strings || strings->bytes == 0 || m_data[strings->offset + strings->bytes - 1] != '\0')
+            return Fail(error, "ڿ ̺ ");
+        m_strings = reinterpret_cast<const char*>(m_data + strings->offset);
+        m_stringBytes = strings->bytes;
+
+        if (!BindRecords(MBIN_SECTION_MATERIALS, m_header->materialCount, m_materials) ||
+            !BindRecords(MBIN_SECTION_BONES, m_header->boneCount, m_bones) ||
+            !BindRecords(MBIN_SECTION_SUBMESHES, m_header->subMeshCount, m_subMeshes))
+            return Fail(error, "ڵ  ũ ġ");
+
+        const MbinSectionEntry* vertices = FindSection(MBIN_SECTION_VERTICES);
+        const MbinSectionEntry* indices = FindSection(MBIN_SECTION_INDICES);
+        if (!vertices || !indices)
+            return Fail(error, "/ε  ");
+
+        for (uint32_t i = 0; i < m_header->subMeshCount; ++i)
+        {
+            const MbinSubMeshRecord& sm = m_subMeshes[i];
+            if (!InSection(*vertices, sm.vertexOffset, sm.vertexBytes) ||
+                !InSection(*indices, sm.indexOffset, sm.indexBytes))
+                return Fail(error, "޽ /ε  ");
+
+            if (sm.indexStride != sizeof(uint32_t) &&
+                !(sm.indexStride == sizeof(uint16_t) && (m_header->flags & MBIN_FLAG_INDEX16)))
+                return Fail(error, "޽ ε  ");
+
+            if (!(m_header->flags & MBIN_FLAG_COMPRESSED_STREAMS) &&
+                (uint64_t(sm.vertexCount) * sm.vertexStride != sm.vertexBytes ||
+                 uint64_t(sm.indexCount) * sm.indexStride != sm.indexBytes))
+                return Fail(error, "޽ /ε ũ ġ");
+
+            // ̸ Ǯ ġ =   
+            if (!(m_header->flags & MBIN_FLAG_COMPRESSED_STREAMS) &&
+                (uint64_t(sm.baseVertex) * sm.vertexStride != sm.vertexOffset - vertices->offset ||
+                 uint64_t(sm.firstIndex) * sm.indexStride != sm.indexOffset - indices->offset))
+                return Fail(error, "޽ Ǯ ġ ġ");
+        }
+
+        if ((m_header->flags & MBIN_FLAG_MESHLETS) && !BindMeshlets())
+            return Fail(error, "meshlet  ");
+
+        if ((m_header->flags & MBIN_FLAG_CLUSTER_LOD) && !BindClusterLod())
+            return Fail(error, "Ŭ LOD  ");
+
+        if ((m_header->flags & MBIN_FLAG_DRAW_RANGES) && !BindDrawRanges())
+            return Fail(error, "draw range  ");
+
+        if ((m_header->flags & MBIN_FLAG_INSTANCES) && !BindInstances())
+            return Fail(error, "νϽ  ");
+
+        if ((m_header->flags & MBIN_FLAG_DEPTH_STREAMS) && !BindDepthStreams())
+            return Fail(error, " Ʈ  ");
+
+        return true;
+    }
+
+    const MbinSectionedHeader& Header() const { return *m_header; }
+    uint32_t Flags() const { return m_header->flags; }
+
+    const MbinSectionEntry* FindSection(uint32_t id) const
+    {
+        if (!m_header) return nullptr;
+        for (uint32_t i = 0; i < m_header->sectionCount; ++i)
+            if (m_toc[i].id == id) return &m_toc[i];
+        return nullptr;
+    }
+
+    //     ڿ
+    const char* String(uint32_t ref) const
+    {
+        return (ref < m_stringBytes) ? m_strings + ref : m_strings;
+    }
+
+    uint32_t MaterialCount() const { return m_header->materialCount; }
+    uint32_t BoneCount() const { return m_header->boneCount; }
+    uint32_t SubMeshCount() const { return m_header->subMeshCount; }
+
+    const MbinMaterialRecord* Materials() const { return m_materials; }
+    const MbinBoneRecord* Bones() const { return m_bones; }
+    const MbinSubMeshRecord* SubMeshes() const { return m_subMeshes; }
+
+    const void* VertexData(const MbinSubMeshRecord& sm) const { return m_data + sm.vertexOffset; }
+    const void* IndexData(const MbinSubMeshRecord& sm) const { return m_data + sm.indexOffset; }
+
+    //  ü /ε Ǯ (VTXB/IDXB °    ø ޽ô baseVertex/firstIndex ׸)
+    const void* VertexPoolData() const { return m_data + FindSection(MBIN_SECTION_VERTICES)->offset; }
+    uint64_t VertexPoolBytes() const { return FindSection(MBIN_SECTION_VERTICES)->bytes; }
+    const void* IndexPoolData() const { return m_data + FindSection(MBIN_SECTION_INDICES)->offset; }
+    uint64_t IndexPoolBytes() const { return FindSection(MBIN_SECTION_INDICES)->bytes; }
+
+    // MBIN_FLAG_MESHLETS  nullptr (޽ i  = MeshletRanges()[i])
+    const MbinMeshletRangeRecord* MeshletRanges() const { return m_meshletRanges; }
+    const MbinMeshletRecord* Meshlets(const MbinMeshletRangeRecord& r) const { return m_meshlets + r.firstMeshlet; }
+    const MbinMeshletBoundsRecord* MeshletBounds(const MbinMeshletRangeRecord& r) const { return m_meshletBounds + r.firstMeshlet; }
+    const uint32_t* MeshletVertices(const MbinMeshletRangeRecord& r) const { return m_meshletVertices + r.firstVertex; }
+    const uint8_t* MeshletTriangles(const MbinMeshletRangeRecord& r) const { return m_meshletTriangles + r.triangleByteOffset; }
+
+    // MBIN_FLAG_CLUSTER_LOD  nullptr (޽ i  = ClusterLodRanges()[i])
+    const MbinMeshletRangeRecord* ClusterLodRanges() const { return m_clusterRanges; }
+    const MbinClusterLodRecord* Clusters(const MbinMeshletRangeRecord& r) const { return m_clusters + r.firstMeshlet; }
+    const uint32_t* ClusterVertices(const MbinMeshletRangeRecord& r) const { return m_clusterVertices + r.firstVertex; }
+    const uint8_t* ClusterTriangles(const MbinMeshletRangeRecord& r) const { return m_clusterTriangles + r.triangleByteOffset; }
+
+    // MBIN_FLAG_DRAW_RANGES  nullptr (޽ i  = DrawRangeSpans()[i])
+    const MbinDrawRangeSpanRecord* DrawRangeSpans() const { return m_drawRangeSpans; }
+    const MbinDrawRangeRecord* DrawRanges(const MbinDrawRangeSpanRecord& s) const { return m_drawRanges + s.firstRange; }
+
+    // MBIN_FLAG_INSTANCES  0 / nullptr
+    uint32_t InstanceCount() const { return m_instanceCount; }
+    const MbinInstanceRecord* Instances() const { return m_instances; }
+
+    // MBIN_FLAG_DEPTH_STREAMS  nullptr (޽ i = DepthStreams()[i])
+    // Ǯ(DPOS/DSHI) ° øų ޽  ͷ
+    const MbinDepthStreamRecord* DepthStreams() const { return m_depthStreams; }
+    const void* DepthPositionPoolData() const { return m_depthPositions; }
+    uint64_t DepthPositionPoolBytes() const { return m_depthPositionBytes; }
+    const void* ShadowIndexPoolData() const { return m_shadowIndices; }
+    uint64_t ShadowIndexPoolBytes() const { return m_shadowIndexBytes; }
+    const void* DepthPositionData(const MbinDepthStreamRecord& d) const
+    {
+        return m_depthPositions + uint64_t(d.basePosition) * d.positionStride;
+    }
+    const void* ShadowIndexData(const MbinDepthStreamRecord& d, const MbinSubMeshRecord& sm) const
+    {
+        return m_shadowIndices + uint64_t(d.firstShadowIndex) * sm.indexStride;
+    }
+
+private:
+    bool Fail(std::string* error, const char* message)
+    {
+        if (error) *error = message;
+        *this = MbinView{};
+        return false;
+    }
+
+    bool InSection(const MbinSectionEntry& e, uint64_t offset, uint64_t bytes) const
+    {
+        return offset % kMbinSectionAlignment == 0 &&
+            offset >= e.offset && offset <= e.offset + e.bytes &&
+            bytes <= e.offset + e.bytes - offset;
+    }
+
+    bool BindMeshlets()
+    {
+        const MbinSectionEntry* meshlets = FindSection(MBIN_SECTION_MESHLETS);
+        const MbinSectionEntry* bounds = FindSection(MBIN_SECTION_MESHLET_BOUNDS);
+        const MbinSectionEntry* vertices = FindSection(MBIN_SECTION_MESHLET_VERTICES);
+        const MbinSectionEntry* triangles = FindSection(MBIN_SECTION_MESHLET_TRIANGLES);
+        if (!meshlets || !bounds || !vertices || !triangles) return false;
+
+        const uint64_t meshletCount = meshlets->bytes / sizeof(MbinMeshletRecord);
+        const uint64_t vertexCount = vertices->bytes / sizeof(uint32_t);
+        if (meshletCount * sizeof(MbinMeshletRecord) != meshlets->bytes ||
+            meshletCount * sizeof(MbinMeshletBoundsRecord) != bounds->bytes ||
+            vertexCount * sizeof(uint32_t) != vertices->bytes)
+            return false;
+
+        if (!BindRecords(MBIN_SECTION_MESHLET_RANGES, m_header->subMeshCount, m_meshletRanges) || !m_meshletRanges)
+            return false;
+
+        for (uint32_t i = 0; i < m_header->subMeshCount; ++i)
+        {
+            const MbinMeshletRangeRecord& r = m_meshletRanges[i];
+            if (uint64_t(r.firstMeshlet) + r.meshletCount > meshletCount ||
+                uint64_t(r.firstVertex) + r.vertexCount > vertexCount ||
+                uint64_t(r.triangleByteOffset) + r.triangleBytes > triangles->bytes)
+                return false;
+        }
+
+        m_meshlets = reinterpret_cast<const MbinMeshletRecord*>(m_data + meshlets->offset);
+        m_meshletBounds = reinterpret_cast<const MbinMeshletBoundsRecord*>(m_data + bounds->offset);
+        m_meshletVertices = reinterpret_cast<const uint32_t*>(m_data + vertices->offset);
+        m_meshletTriangles = m_data + triangles->offset;
+        return true;
+    }
+
+    bool BindClusterLod()
+    {
+        const MbinSectionEntry* clusters = FindSection(MBIN_SECTION_CLUSTERS);
+        const MbinSectionEntry* vertices = FindSection(MBIN_SECTION_CLUSTER_VERTICES);
+        const MbinSectionEntry* triangles = FindSection(MBIN_SECTION_CLUSTER_TRIANGLES);
+        if (!clusters || !vertices || !triangles) return false;
+
+        const uint64_t clusterCount = clusters->bytes / sizeof(MbinClusterLodRecord);
+        const uint64_t vertexCount = vertices->bytes / sizeof(uint32_t);
+        if (clusterCount * sizeof(MbinClusterLodRecord) != clusters->bytes ||
+            vertexCount * sizeof(uint32_t) != vertices->bytes)
+            return false;
+
+        if (!BindRecords(MBIN_SECTION_CLUSTER_RANGES, m_header->subMeshCount, m_clusterRanges) || !m_clusterRanges)
+            return false;
+
+        for (uint32_t i = 0; i < m_header->subMeshCount; ++i)
+        {
+            const MbinMeshletRangeRecord& r = m_clusterRanges[i];
+            if (uint64_t(r.firstMeshlet) + r.meshletCount > clusterCount ||
+                uint64_t(r.firstVertex) + r.vertexCount > vertexCount ||
+                uint64_t(r.triangleByteOffset) + r.triangleBytes > triangles->bytes)
+                return false;
+        }
+
+        m_clusters = reinterpret_cast<const MbinClusterLodRecord*>(m_data + clusters->offset);
+        m_clusterVertices = reinterpret_cast<const uint32_t*>(m_data + vertices->offset);
+        m_clusterTriangles = m_data + triangles->offset;
+        return true;
+    }
+
+    bool BindDrawRanges()
+    {
+        const MbinSectionEntry* ranges = FindSection(MBIN_SECTION_DRAW_RANGES);
+        if (!ranges) return false;
+
+        const uint64_t rangeCount = ranges->bytes / sizeof(MbinDrawRangeRecord);
+        if (rangeCount * sizeof(MbinDrawRangeRecord) != ranges->bytes)
+            return false;
+
+        if (!BindRecords(MBIN_SECTION_DRAW_RANGE_SPANS, m_header->subMeshCount, m_drawRangeSpans) || !m_drawRangeSpans)
+            return false;
+
+        m_drawRanges = reinterpret_cast<const MbinDrawRangeRecord*>(m_data + ranges->offset);
+
+        for (uint32_t i = 0; i < m_header->subMeshCount; ++i)
+        {
+            const MbinDrawRangeSpanRecord& span = m_drawRangeSpans[i];
+            if (uint64_t(span.firstRange) + span.rangeCount > rangeCount)
+                return false;
+
+            const MbinSubMeshRecord& sm = m_subMeshes[i];
+            for (uint32_t r = 0; r < span.rangeCount; ++r)
+            {
+                const MbinDrawRangeRecord& range = m_drawRanges[span.firstRange + r];
+                if (uint64_t(range.firstIndex) + range.indexCount > sm.indexCount ||
+                    uint64_t(range.firstVertex) + range.vertexCount > sm.vertexCount)
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    bool BindInstances()
+    {
+        const MbinSectionEntry* instances = FindSection(MBIN_SECTION_INSTANCES);
+        if (!instances) return false;
+
+        const uint64_t instanceCount = instances->bytes / sizeof(MbinInstanceRecord);
+        if (instanceCount * sizeof(MbinInstanceRecord) != instances->bytes || instanceCount > UINT32_MAX)
+            return false;
+
+        m_instances = reinterpret_cast<const MbinInstanceRecord*>(m_data + instances->offset);
+        m_instanceCount = static_cast<uint32_t>(instanceCount);
+
+        for (uint32_t i = 0; i < m_instanceCount; ++i)
+        {
+            if (uint64_t(m_instances[i].firstSubMesh) + m_instances[i].subMeshCount > m_header->subMeshCount)
+                return false;
+        }
+        return true;
+    }
+
+    bool BindDepthStreams()
+    {
+        const MbinSectionEntry* positions = FindSection(MBIN_SECTION_DEPTH_POSITIONS);
+        const MbinSectionEntry* shadowIndices = FindSection(MBIN_SECTION_SHADOW_INDICES);
+        if (!positions || !shadowIndices) return false;
+
+        if (!BindRecords(MBIN_SECTION_DEPTH_STREAMS, m_header->subMeshCount, m_depthStreams) || !m_depthStreams)
+            return false;
+
+        for (uint32_t i = 0; i < m_header->subMeshCount; ++i)
+        {
+            const MbinDepthStreamRecord& d = m_depthStreams[i];
+            const MbinSubMeshRecord& sm = m_subMeshes[i];
+            if (d.positionStride == 0 ||
+                (uint64_t(d.basePosition) + sm.vertexCount) * d.positionStride > positions->bytes ||
+                (uint64_t(d.firstShadowIndex) + d.shadowIndexCount) * sm.indexStride > shadowIndices->bytes)
+                return false;
+        }
+
+        m_depthPositions = m_data + positions->offset;
+        m_depthPositionBytes = positions->bytes;
+        m_shadowIndices = m_data + shadowIndices->offset;
+        m_shadowIndexBytes = shadowIndices->bytes;
+        return true;
+    }
+
+    template <class RecordT>
+    bool BindRecords(uint32_t id, uint32_t count, const RecordT*& out) const
+    {
+        const MbinSectionEntry* e = FindSection(id);
+        if (!e) return count == 0;
+        if (e->bytes != uint64_t(count) * sizeof(RecordT)) return false;
+        out = reinterpret_cast<const RecordT*>(m_data + e->offset);
+        return true;
+    }
+
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    const MbinSectionedHeader* m_header = nullptr;
+    const MbinSectionEntry* m_toc = nullptr;
+    const char* m_strings = "";
+    uint64_t m_stringBytes = 0;
+    const MbinMaterialRecord* m_materials = nullptr;
+    const MbinBoneRecord* m_bones = nullptr;
+    const MbinSubMeshRecord* m_subMeshes = nullptr;
+
+    const MbinMeshletRangeRecord* m_meshletRanges = nullptr;
+    const MbinMeshletRecord* m_meshlets = nullptr;
+    const MbinMeshletBoundsRecord* m_meshletBounds = nullptr;
+    const uint32_t* m_meshletVertices = nullptr;
+    const uint8_t* m_meshletTriangles = nullptr;
+
+    const MbinMeshletRangeRecord* m_clusterRanges = nullptr;
+    const MbinClusterLodRecord* m_clusters = nullptr;
+    const uint32_t* m_clusterVertices = nullptr;
+    const uint8_t* m_clusterTriangles = nullptr;
+
+    const MbinDrawRangeSpanRecord* m_drawRangeSpans = nullptr;
+    const MbinDrawRangeRecord* m_drawRanges = nullptr;
+
+    const MbinInstanceRecord* m_instances = nullptr;
+    uint32_t m_instanceCount = 0;
+
+    const MbinDepthStreamRecord* m_depthStreams = nullptr;
+    const uint8_t* m_depthPositions = nullptr;
+    uint64_t m_depthPositionBytes = 0;
+    const uint8_t* m_shadowIndices = nullptr;
+    uint64_t m_shadowIndexBytes = 0;
+};
+
+// ----------------------------------------------------------
+//  +  (Ϲ )
+//   MbinFile f; if (f.Open(path)) { const MbinView& v = f.View(); ... }
+// ----------------------------------------------------------
+class MbinFile
+{
+public:
+    bool Open(const std::filesystem::path& path, std::string* error = nullptr)
+    {
+        if (!m_file.Open(path, error))
+            return false;
+        if (!m_view.Open(m_file.Data(), m_file.Size(), error))
+        {
+            m_file.Close();
+            return false;
+        }
+        return true;
+    }
+
+    void Close()
+    {
+        m_view = MbinView{};
+        m_file.Close();
+    }
+
+    const MbinView& View() const { return m_view; }
+
+private:
+    MbinMappedFile m_file;
+    MbinView m_view;
+};
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <cstdint>
+
+#include "MbinFormat.h"
+
+// ==========================================================
+// MBIN v7  ġ (ī ε, Static / Skinned )
+// - v5/v3 ʵ带  о  ġ   ִ (  ڿ )
+//   v7  ũ  +  (TOC) ٷ ãư
+// -  ġ
+//     MbinSectionedHeader (48Ʈ)
+//     MbinSectionEntry x sectionCount ( )
+//     ǵ ( ġ 16Ʈ , 0 е)
+// - 
+//     STRS : ڿ ̺ (UTF-8, '\0' ,  ڿ  )
+//            ٸ ڵ ̺  Ʈ   (0 =  ڿ)
+//     MATL : MbinMaterialRecord x materialCount
+//     BONE : MbinBoneRecord x boneCount
+//     SUBM : MbinSubMeshRecord x subMeshCount
+//     VTXB :  ޽  (, ޽ø 16Ʈ ) =  ϳ  Ǯ
+//     IDXB :  ޽ ε (, ޽ø 16Ʈ ) =  ϳ ε Ǯ
+//            ޽ ڵ baseVertex/firstIndex   ° ø ۿ ٷ ׸
+//            (ε ޽   ȣ, MBIN_FLAG_INDEX16̸ ޽ø 2 Ǵ 4Ʈ)
+//   MBIN_FLAG_MESHLETS  (MbinMeshlet.h)
+//     MLRG : MbinMeshletRangeRecord x subMeshCount (޽ú Ʒ 迭 )
+//     MLET : MbinMeshletRecord ( ޽ ̾,  ޽  )
+//     MLBD : MbinMeshletBoundsRecord (MLET 1:1)
+//     MLVX : meshlet   uint32 (ڵ̸  )
+//     MLTR : meshlet ﰢ Ʈ Ǵ ڵ Ʈ (޽ø 16Ʈ )
+//   MBIN_FLAG_CLUSTER_LOD  (MbinClusterLod.h)
+//     CLRG : MbinMeshletRangeRecord x subMeshCount (firstMeshlet/meshletCount = Ŭ )
+//     CLUS : MbinClusterLodRecord ( ޽ ̾,  ޽  )
+//     CLVX : Ŭ   uint32
+//     CLTR : Ŭ ﰢ Ʈ (޽ø 16Ʈ )
+//   MBIN_FLAG_DRAW_RANGES  (Ƽ )
+//     DRSP : MbinDrawRangeSpanRecord x subMeshCount (޽ú DRAW )
+//     DRAW : MbinDrawRangeRecord ( ޽ ̾)
+//   MBIN_FLAG_INSTANCES 
+//     INST : MbinInstanceRecord ( ޽  + ȯ)
+//   MBIN_FLAG_DEPTH_STREAMS  (MbinDepthStream.h)
+//     DPRG : MbinDepthStreamRecord x subMeshCount
+//     DPOS :  ޽ ġ Ʈ (, е ) = /׸ н ġ Ǯ
+//     DSHI :  ޽ ׸ ε (޽ø 16Ʈ ,  ޽ indexStride)
+// - flags(MbinHeaderFlags) v5/v6  : ȭ ̸ stride 32,
+//    Ʈ̸ /ε  ڵ Ʈ (Ʈ  = vertexBytes/indexBytes)
+// -     , Ʋ 
+// - б MbinReader.h (mmap  ͸ ѱ)
+// ==========================================================
+
+static constexpr uint32_t kMbinSectionedVersion = 7;
+static constexpr uint32_t kMbinSectionAlignment = 16;
+
+constexpr uint32_t MbinFourCC(char a, char b, char c, char d)
+{
+    return static_cast<uint32_t>(static_cast<uint8_t>(a)) |
+        (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8) |
+        (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16) |
+        (static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24);
+}
+
+enum MbinSectionId : uint32_t
+{
+    MBIN_SECTION_STRINGS = MbinFourCC('S', 'T', 'R', 'S'),
+    MBIN_SECTION_MATERIALS = MbinFourCC('M', 'A', 'T', 'L'),
+    MBIN_SECTION_BONES = MbinFourCC('B', 'O', 'N', 'E'),
+    MBIN_SECTION_SUBMESHES = MbinFourCC('S', 'U', 'B', 'M'),
+    MBIN_SECTION_VERTICES = MbinFourCC('V', 'T', 'X', 'B'),
+    MBIN_SECTION_INDICES = MbinFourCC('I', 'D', 'X', 'B'),
+    MBIN_SECTION_MESHLET_RANGES = MbinFourCC('M', 'L', 'R', 'G'),
+    MBIN_SECTION_MESHLETS = MbinFourCC('M', 'L', 'E', 'T'),
+    MBIN_SECTION_MESHLET_BOUNDS = MbinFourCC('M', 'L', 'B', 'D'),
+    MBIN_SECTION_MESHLET_VERTICES = MbinFourCC('M', 'L', 'V', 'X'),
+    MBIN_SECTION_MESHLET_TRIANGLES = MbinFourCC('M', 'L', 'T', 'R'),
+    MBIN_SECTION_CLUSTER_RANGES = MbinFourCC('C', 'L', 'R', 'G'),
+    MBIN_SECTION_CLUSTERS = MbinFourCC('C', 'L', 'U', 'S'),
+    MBIN_SECTION_CLUSTER_VERTICES = MbinFourCC('C', 'L', 'V', 'X'),
+    MBIN_SECTION_CLUSTER_TRIANGLES = MbinFourCC('C', 'L', 'T', 'R'),
+    MBIN_SECTION_DRAW_RANGE_SPANS = MbinFourCC('D', 'R', 'S', 'P'),
+    MBIN_SECTION_DRAW_RANGES = MbinFourCC('D', 'R', 'A', 'W'),
+    MBIN_SECTION_INSTANCES = MbinFourCC('I', 'N', 'S', 'T'),
+    MBIN_SECTION_DEPTH_STREAMS = MbinFourCC('D', 'P', 'R', 'G'),
+    MBIN_SECTION_DEPTH_POSITIONS = MbinFourCC('D', 'P', 'O', 'S'),
+    MBIN_SECTION_SHADOW_INDICES = MbinFourCC('D', 'S', 'H', 'I'),
+};
+
+struct MbinSectionedHeader
+{
+    char magic[4];           // 'MBIN'
+    uint32_t version;        // kMbinSectionedVersion
+    uint32_t flags;          // MbinHeaderFlags
+    uint32_t boneCount;
+    uint32_t materialCount;
+    uint32_t subMeshCount;
+    uint32_t sectionCount;
+    uint32_t headerBytes;    // sizeof(MbinSectionedHeader), ڿ ʵ尡 þ TOC ġ ̰ɷ
+    uint64_t fileBytes;      // ߸  ˻
+    uint64_t reserved;
+};
+static_assert(sizeof(MbinSectionedHeader) == 48, "MbinSectionedHeader must be 48 bytes");
+
+struct MbinSectionEntry
+{
+    uint32_t id;             // MbinSectionId
+    uint32_t reserved;
+    uint64_t offset;
+    uint64_t bytes;
+};
+static_assert(sizeof(MbinSectionEntry) == 24, "MbinSectionEntry must be 24 bytes");
+
+struct MbinTexTransformRecord
+{
+    float scale[2];
+    float offset[2];
+    uint32_t wrapMode[2];    // 0=Repeat, 1=Clamp
+};
+static_assert(sizeof(MbinTexTransformRecord) == 24, "MbinTexTransformRecord must be 24 bytes");
+
+struct MbinMaterialRecord
+{
+    uint32_t name;           // ڿ ̺ 
+    uint32_t diffuseTexture;
+    uint32_t normalTexture;
+    uint32_t emissiveTexture;
+    uint32_t specularTexture;
+    uint32_t reserved[3];
+
+    float diffuseColor[4];
+    float emissiveColor[4];
+    float specularColor[4];  // rgb=specular, a=shininess
+
+    MbinTexTransformRecord diffuseTransform;
+    MbinTexTransformRecord normalTransform;
+    MbinTexTransformRecord emissiveTransform;
+    MbinTexTransformRecord specularTransform;
+};
+static_assert(sizeof(MbinMaterialRecord) == 176, "MbinMaterialRecord must be 176 bytes");
+
+struct MbinBoneRecord
+{
+    uint32_t name;
+    int32_t parentIndex;
+    uint32_t reserved[2];
+    float bindLocal[16];
+    float offsetMatrix[16];
+};
+static_assert(sizeof(MbinBoneRecord) == 144, "MbinBoneRecord must be 144 bytes");
+
+struct MbinSubMeshRecord
+{
+    uint32_t name;
+    uint32_t authoringPath;  // Static (Skinned  ڿ)
+    uint32_t materialIndex;
+    uint32_t hasExplicitLocalOOBB;
+    float explicitLocalOOBBMatrix[16];
+
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    uint32_t vertexStride;   // 80 (float) Ǵ 32 (ȭ)
+    uint32_t indexStride;    // 4 (uint32) Ǵ 2 (MBIN_FLAG_INDEX16, vertexCount <= 65536)
+
+    uint64_t vertexOffset;   //   (VTXB  ), 16Ʈ 
+    uint64_t vertexBytes;
+    uint64_t indexOffset;    //   (IDXB  ), 16Ʈ 
+    uint64_t indexBytes;
+
+    // ȭ  Ķ (MbinQuantizeParams  ġ, ȭ ƴϸ 0/1)
+    float positionOffset[3];
+    float positionScale[3];
+    float uvOffset[2];
+    float uvScale[2];
+
+    // Ǯ  ġ ( Ʈ̸   ġ =  ϰ  ġ)
+    uint32_t baseVertex;     // VTXB ۺ  
+    uint32_t firstIndex;     // IDXB ۺ  ޽ indexStride 
+};
+static_assert(sizeof(MbinSubMeshRecord) == 176, "MbinSubMeshRecord must be 176 bytes");
+
+// ޽ ϳ meshlet   (MLET/MLBD ڵ , MLVX uint32 , MLTR Ʈ)
+// Ŭ LOD(CLRG)  ڵ (CLUS ڵ / CLVX uint32 / CLTR Ʈ )
+struct MbinMeshletRangeRecord
+{
+    uint32_t firstMeshlet;
+    uint32_t meshletCount;
+    uint32_t firstVertex;
+    uint32_t vertexCount;
+    uint32_t triangleByteOffset;
+    uint32_t triangleBytes;
+};
+static_assert(sizeof(MbinMeshletRangeRecord) == 24, "MbinMeshletRangeRecord must be 24 bytes");
+
+// Ƽ  ޽    ϳ (MBIN_FLAG_DRAW_RANGES)
+// - ε   迭  (baseVertex 0 ״ ׸)
+// - firstVertex/vertexCount:  尡    (OOBB   bounds )
+// - OOBB  ޽  ״ (  ø)
+struct MbinDrawRangeRecord
+{
+    uint32_t name;
+    uint32_t authoringPath;
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    uint32_t firstVertex;
+    uint32_t vertexCount;
+    uint32_t hasExplicitLocalOOBB;
+    uint32_t reserved;
+    float explicitLocalOOBBMatrix[16];
+};
+static_assert(sizeof(MbinDrawRangeRecord) == 96, "MbinDrawRangeRecord must be 96 bytes");
+
+struct MbinDrawRangeSpanRecord
+{
+    uint32_t firstRange;
+    uint32_t rangeCount;
+};
+static_assert(sizeof(MbinDrawRangeSpanRecord) == 8, "MbinDrawRangeSpanRecord must be 8 bytes");
+
+// νϽ ϳ (MBIN_FLAG_INSTANCES)
+// -  ޽ [firstSubMesh, firstSubMesh + subMeshCount) transform ׸
+//    ޽  ,  ޽ô νϽ  ܵ ׸ ʴ´
+// - transform:  -> ũ , OOBB İ  ġ ( , ̵ [12..14])
+struct MbinInstanceRecord
+{
+    uint32_t name;
+    uint32_t authoringPath;
+    uint32_t firstSubMesh;
+    uint32_t subMeshCount;
+    uint32_t flags;          // MbinInstanceFlags
+    uint32_t reserved[3];
+    float transform[16];
+};
+static_assert(sizeof(MbinInstanceRecord) == 96, "MbinInstanceRecord must be 96 bytes");
+
+// ޽ ϳ ġ Ʈ + ׸ ε (MBIN_FLAG_DEPTH_STREAMS)
+// - ġ  = ޽ vertexCount, ȭ  Ķʹ ޽ ڵ 
+// - DPOS/DSHI ° ø DrawIndexed(shadowIndexCount, firstShadowIndex, basePosition)
+//   Ϲ ε(IDXB) basePosition ״ ׸  ִ ( н)
+struct MbinDepthStreamRecord
+{
+    uint32_t basePosition;      // DPOS ۺ positionStride 
+    uint32_t positionStride;    // 12 (float x3) Ǵ 8 (ȭ uint16 x4)
+    uint32_t firstShadowIndex;  // DSHI ۺ ޽ indexStride 
+    uint32_t shadowIndexCount;
+};
+static_assert(sizeof(MbinDepthStreamRecord) == 16, "MbinDepthStreamRecord must be 16 bytes");
@@ -0,0 +1,469 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "BinaryWriter.h"
+#include "MbinClusterLod.h"
+#include "MbinDepthStream.h"
+#include "MbinMeshlet.h"
+#include "MbinQuantize.h"
+#include "MbinSectionedFormat.h"
+#include "MbinStreamCodec.h"
+
+// ==========================================================
+// MBIN v7   (MbinSectionedFormat.h)
+// - ڵ/ڿ//ε Ǻ Ҵٰ Build   ġ
+// - ڿ InternString ְ   ڵ忡 
+// - ޽ /ε ߰   (ȭ/ ӽ   )
+// ==========================================================
+
+inline uint64_t AlignMbinOffset(uint64_t offset)
+{
+    return (offset + (kMbinSectionAlignment - 1)) & ~static_cast<uint64_t>(kMbinSectionAlignment - 1);
+}
+
+class MbinSectionedBuilder
+{
+public:
+    MbinSectionedBuilder()
+    {
+        //  0 =  ڿ
+        m_strings.push_back('\0');
+        m_stringOffsets.emplace(std::string(), 0u);
+    }
+
+    uint32_t InternString(const std::string& s)
+    {
+        const auto it = m_stringOffsets.find(s);
+        if (it != m_stringOffsets.end())
+            return it->second;
+
+        const uint32_t offset = static_cast<uint32_t>(m_strings.size());
+        m_strings.insert(m_strings.end(), s.begin(), s.end());
+        m_strings.push_back('\0');
+        m_stringOffsets.emplace(s, offset);
+        return offset;
+    }
+
+    void AddMaterial(const MbinMaterialRecord& record) { m_materials.push_back(record); }
+    void AddBone(const MbinBoneRecord& record) { m_bones.push_back(record); }
+    void AddInstance(const MbinInstanceRecord& record) { m_instances.push_back(record); }
+
+    // record vertexOffset/Bytes, indexOffset/Bytes, baseVertex/firstIndex ⼭ ä
+    // (vertexCount/indexCount/vertexStride/indexStride ȣڰ ä )
+    void AddSubMesh(
+        MbinSubMeshRecord record,
+        const void* vertexData,
+        size_t vertexBytes,
+        const void* indexData,
+        size_t indexBytes)
+    {
+        record.vertexOffset = AppendAligned(m_vertexBlob, vertexData, vertexBytes);
+        record.vertexBytes = vertexBytes;
+        record.indexOffset = AppendAligned(m_indexBlob, indexData, indexBytes);
+        record.indexBytes = indexBytes;
+
+        // Ǯ ġ  ġ    (̸ blob ° ٸ)
+        //  stride(80/32) 16   е  baseVertex 
+        m_vertexPoolBytes = AlignMbinOffset(m_vertexPoolBytes);
+        m_indexPoolBytes = AlignMbinOffset(m_indexPoolBytes);
+        record.baseVertex = record.vertexStride ? static_cast<uint32_t>(m_vertexPoolBytes / record.vertexStride) : 0;
+        record.firstIndex = record.indexStride ? static_cast<uint32_t>(m_indexPoolBytes / record.indexStride) : 0;
+        m_vertexPoolBytes += uint64_t(record.vertexCount) * record.vertexStride;
+        m_indexPoolBytes += uint64_t(record.indexCount) * record.indexStride;
+
+        m_subMeshes.push_back(record);
+    }
+
+    //   ޽ÿ  AddSubMesh    
+    void AddSubMeshMeshlets(const MbinSubMeshMeshlets& m)
+    {
+        MbinMeshletRangeRecord range{};
+        range.firstMeshlet = static_cast<uint32_t>(m_meshlets.size());
+        range.meshletCount = static_cast<uint32_t>(m.meshlets.size());
+        range.firstVertex = static_cast<uint32_t>(m_meshletVertices.size());
+        range.vertexCount = static_cast<uint32_t>(m.vertices.size());
+        range.triangleByteOffset = static_cast<uint32_t>(AppendAligned(m_meshletTriangles, m.triangles.data(), m.triangles.size()));
+        range.triangleBytes = static_cast<uint32_t>(m.triangles.size());
+        m_meshletRanges.push_back(range);
+
+        m_meshlets.insert(m_meshlets.end(), m.meshlets.begin(), m.meshlets.end());
+        m_meshletBounds.insert(m_meshletBounds.end(), m.bounds.begin(), m.bounds.end());
+        m_meshletVertices.insert(m_meshletVertices.end(), m.vertices.begin(), m.vertices.end());
+    }
+
+    //   ޽ÿ  AddSubMesh    
+    void AddSubMeshClusterLod(const MbinSubMeshClusterLod& c)
+    {
+        MbinMeshletRangeRecord range{};
+        range.firstMeshlet = static_cast<uint32_t>(m_clusters.size());
+        range.meshletCount = static_cast<uint32_t>(c.clusters.size());
+        range.firstVertex = static_cast<uint32_t>(m_clusterVertices.size());
+        range.vertexCount = static_cast<uint32_t>(c.vertices.size());
+        range.triangleByteOffset = static_cast<uint32_t>(AppendAligned(m_clusterTriangles, c.triangles.data(), c.triangles.size()));
+        range.triangleBytes = static_cast<uint32_t>(c.triangles.size());
+        m_clusterRanges.push_back(range);
+
+        m_clusters.insert(m_clusters.end(), c.clusters.begin(), c.clusters.end());
+        m_clusterVertices.insert(m_clusterVertices.end(), c.vertices.begin(), c.vertices.end());
+    }
+
+    //   ޽ÿ  AddSubMesh     (̸ InternString ä )
+    void AddSubMeshDrawRanges(const std::vector<MbinDrawRangeRecord>& ranges)
+    {
+        MbinDrawRangeSpanRecord span{};
+        span.firstRange = static_cast<uint32_t>(m_drawRanges.size());
+        span.rangeCount = static_cast<uint32_t>(ranges.size());
+        m_drawRangeSpans.push_back(span);
+        m_drawRanges.insert(m_drawRanges.end(), ranges.begin(), ranges.end());
+    }
+
+    //   ޽ÿ  AddSubMesh ڿ    
+    // ׸ ε   ޽ indexStride  (16Ʈ ε  )
+    void AddSubMeshDepthStream(const MbinSubMeshDepthStream& d)
+    {
+        const MbinSubMeshRecord& sm = m_subMeshes[m_depthStreams.size()];
+
+        MbinDepthStreamRecord record{};
+        record.positionStride = d.positionStride;
+        record.basePosition = d.positionStride ? static_cast<uint32_t>(m_depthPositions.size() / d.positionStride) : 0;
+        record.shadowIndexCount = static_cast<uint32_t>(d.shadowIndices.size());
+        m_depthPositions.insert(m_depthPositions.end(), d.positions.begin(), d.positions.end());
+
+        uint64_t offset = 0;
+        if (sm.indexStride == sizeof(uint16_t))
+        {
+            const std::vector<uint16_t> narrow(d.shadowIndices.begin(), d.shadowIndices.end());
+            offset = AppendAligned(m_shadowIndices, narrow.data(), narrow.size() * sizeof(uint16_t));
+        }
+        else
+        {
+            offset = AppendAligned(m_shadowIndices, d.shadowIndices.data(), d.shadowIndices.size() * sizeof(uint32_t));
+        }
+        record.firstShadowIndex = static_cast<uint32_t>(offset / sm.indexStride);
+
+        m_depthStreams.push_back(record);
+    }
+
+    BinaryWriter Build(uint32_t flags) const
+    {
+        struct Section
+        {
+            uint32_t id;
+            const void* data;
+            uint64_t bytes;
+        };
+
+        std::vector<Section> sections =
+        {
+            { MBIN_SECTION_STRINGS, m_strings.data(), m_strings.size() },
+            { MBIN_SECTION_MATERIALS, m_materials.data(), m_materials.size() * sizeof(MbinMaterialRecord) },
+            { MBIN_SECTION_BONES, m_bones.data(), m_bones.size() * sizeof(MbinBoneRecord) },
+            { MBIN_SECTION_SUBMESHES, nullptr, m_subMeshes.size() * sizeof(MbinSubMeshRecord) }, //    
+            { MBIN_SECTION_VERTICES, m_vertexBlob.data(), m_vertexBlob.size() },
+            { MBIN_SECTION_INDICES, m_indexBlob.data(), m_indexBlob.size() },
+        };
+
+        if (!m_meshletRanges.empty())
+        {
+            sections.push_back({ MBIN_SECTION_MESHLET_RANGES, m_meshletRanges.data(), m_meshletRanges.size() * sizeof(MbinMeshletRangeRecord) });
+            sections.push_back({ MBIN_SECTION_MESHLETS, m_meshlets.data(), m_meshlets.size() * sizeof(MbinMeshletRecord) });
+            sections.push_back({ MBIN_SECTION_MESHLET_BOUNDS, m_meshletBounds.data(), m_meshletBounds.size() * sizeof(MbinMeshletBoundsRecord) });
+            sections.push_back({ MBIN_SECTION_MESHLET_VERTICES, m_meshletVertices.data(), m_meshletVertices.size() * sizeof(uint32_t) });
+            sections.push_back({ MBIN_SECTION_MESHLET_TRIANGLES, m_meshletTriangles.data(), m_meshletTriangles.size() });
+        }
+
+        if (!m_clusterRanges.empty())
+        {
+            sections.push_back({ MBIN_SECTION_CLUSTER_RANGES, m_clusterRanges.data(), m_clusterRanges.size() * sizeof(MbinMeshletRangeRecord) });
+            sections.push_back({ MBIN_SECTION_CLUSTERS, m_clusters.data(), m_clusters.size() * sizeof(MbinClusterLodRecord) });
+            sections.push_back({ MBIN_SECTION_CLUSTER_VERTICES, m_clusterVertices.data(), m_clusterVertices.size() * sizeof(uint32_t) });
+            sections.push_back({ MBIN_SECTION_CLUSTER_TRIANGLES, m_clusterTriangles.data(), m_clusterTriangles.size() });
+        }
+
+        if (!m_drawRangeSpans.empty())
+        {
+            sections.push_back({ MBIN_SECTION_DRAW_RANGE_SPANS, m_drawRangeSpans.data(), m_drawRangeSpans.size() * sizeof(MbinDrawRangeSpanRecord) });
+            sections.push_back({ MBIN_SECTION_DRAW_RANGES, m_drawRanges.data(), m_drawRanges.size() * sizeof(MbinDrawRangeRecord) });
+        }
+
+        if (!m_instances.empty())
+            sections.push_back({ MBIN_SECTION_INSTANCES, m_instances.data(), m_instances.size() * sizeof(MbinInstanceRecord) });
+
+        if (!m_depthStreams.empty())
+        {
+            sections.push_back({ MBIN_SECTION_DEPTH_STREAMS, m_depthStreams.data(), m_depthStreams.size() * sizeof(MbinDepthStreamRecord) });
+            sections.push_back({ MBIN_SECTION_DEPTH_POSITIONS, m_depthPositions.data(), m_depthPositions.size() });
+            sections.push_back({ MBIN_SECTION_SHADOW_INDICES, m_shadowIndices.data(), m_shadowIndices.size() });
+        }
+
+        // ÷װ    䱸ϹǷ (MbinReader.h Bind*)    ÷״ 
+        // (޽ð     )
+        if (m_meshletRanges.empty())
+            flags &= ~(MBIN_FLAG_MESHLETS | MBIN_FLAG_MESHLETS_ENCODED);
+
+        if (m_clusterRanges.empty())
+            flags &= ~MBIN_FLAG_CLUSTER_LOD;
+
+        if (m_drawRangeSpans.empty())
+            flags &= ~MBIN_FLAG_DRAW_RANGES;
+
+        if (m_instances.empty())
+            flags &= ~MBIN_FLAG_INSTANCES;
+
+        if (m_depthStreams.empty())
+            flags &= ~MBIN_FLAG_DEPTH_STREAMS;
+
+        const uint32_t sectionCount = static_cast<uint32_t>(sections.size());
+
+        // 1) ġ 
+        std::vector<MbinSectionEntry> toc(sectionCount);
+        uint64_t cursor = AlignMbinOffset(sizeof(MbinSectionedHeader) + sizeof(MbinSectionEntry) * toc.size());
+        uint64_t fileBytes = cursor;
+        for (uint32_t i = 0; i < sectionCount; ++i)
+        {
+            toc[i].id = sections[i].id;
+            toc[i].offset = cursor;
+            toc[i].bytes = sections[i].bytes;
+            fileBytes = cursor + sections[i].bytes;
+            cursor = AlignMbinOffset(fileBytes);
+        }
+
+        MbinSectionedHeader header{};
+        std::memcpy(header.magic, "MBIN", 4);
+        header.version = kMbinSectionedVersion;
+        header.flags = flags;
+        header.boneCount = static_cast<uint32_t>(m_bones.size());
+        header.materialCount = static_cast<uint32_t>(m_materials.size());
+        header.subMeshCount = static_cast<uint32_t>(m_subMeshes.size());
+        header.sectionCount = sectionCount;
+        header.headerBytes = sizeof(MbinSectionedHeader);
+        header.fileBytes = fileBytes;
+
+        uint64_t vertexBase = 0;
+        uint64_t indexBase = 0;
+        for (const MbinSectionEntry& e : toc)
+        {
+            if (e.id == MBIN_SECTION_VERTICES) vertexBase = e.offset;
+            if (e.id == MBIN_SECTION_INDICES) indexBase = e.offset;
+        }
+
+        // 2) 
+        BinaryWriter out;
+        out.Reserve(static_cast<size_t>(fileBytes));
+        out.WriteRaw(&header, sizeof(header));
+        out.WriteRaw(toc.data(), sizeof(MbinSectionEntry) * toc.size());
+
+        for (uint32_t i = 0; i < sectionCount; ++i)
+        {
+            out.PadTo(kMbinSectionAlignment);
+
+            if (sections[i].id != MBIN_SECTION_SUBMESHES)
+            {
+                out.WriteRaw(sections[i].data, static_cast<size_t>(sections[i].bytes));
+                continue;
+            }
+
+            // blob    ->  
+            for (MbinSubMeshRecord record : m_subMeshes)
+            {
+                record.vertexOffset += vertexBase;
+                record.indexOffset += indexBase;
+                out.WriteRaw(&record, sizeof(record));
+            }
+        }
+
+        return out;
+    }
+
+private:
+    static uint64_t AppendAligned(std::vector<uint8_t>& blob, const void* data, size_t bytes)
+    {
+        blob.resize(static_cast<size_t>(AlignMbinOffset(blob.size())), 0);
+        const uint64_t offset = blob.size();
+        if (bytes > 0)
+        {
+            const uint8_t* p = static_cast<const uint8_t*>(data);
+            blob.insert(blob.end(), p, p + bytes);
+        }
+        return offset;
+    }
+
+    std::vector<char> m_strings;
+    std::unordered_map<std::string, uint32_t> m_stringOffsets;
+
+    std::vector<MbinMaterialRecord> m_materials;
+    std::vector<MbinBoneRecord> m_bones;
+    std::vector<MbinSubMeshRecord> m_subMeshes;
+
+    std::vector<uint8_t> m_vertexBlob;
+    std::vector<uint8_t> m_indexBlob;
+    uint64_t m_vertexPoolBytes = 0;
+    uint64_t m_indexPoolBytes = 0;
+
+    std::vector<MbinMeshletRangeRecord> m_meshletRanges;
+    std::vector<MbinMeshletRecord> m_meshlets;
+    std::vector<MbinMeshletBoundsRecord> m_meshletBounds;
+    std::vector<uint32_t> m_meshletVertices;
+    std::vector<uint8_t> m_meshletTriangles;
+
+    std::vector<MbinMeshletRangeRecord> m_clusterRanges;
+    std::vector<MbinClusterLodRecord> m_clusters;
+    std::vector<uint32_t> m_clusterVertices;
+    std::vector<uint8_t> m_clusterTriangles;
+
+    std::vector<MbinDrawRangeSpanRecord> m_drawRangeSpans;
+    std::vector<MbinDrawRangeRecord> m_drawRanges;
+
+    std::vector<MbinInstanceRecord> m_instances;
+
+    std::vector<MbinDepthStreamRecord> m_depthStreams;
+    std::vector<uint8_t> m_depthPositions;
+    std::vector<uint8_t> m_shadowIndices;
+};
+
+// ----------------------------------------------------------
+//  ü -> v7 ڵ (Material / Bone ʵ ̸  Ⱑ )
+// ----------------------------------------------------------
+
+template <class TexTransformT>
+inline MbinTexTransformRecord MakeMbinTexTransformRecord(const TexTransformT& t)
+{
+    MbinTexTransformRecord r{};
+    std::memcpy(r.scale, t.scale, sizeof(r.scale));
+    std::memcpy(r.offset, t.offset, sizeof(r.offset));
+    std::memcpy(r.wrapMode, t.wrapMode, sizeof(r.wrapMode));
+    return r;
+}
+
+template <class MaterialT>
+inline MbinMaterialRecord MakeMbinMaterialRecord(MbinSectionedBuilder& builder, const MaterialT& m)
+{
+    MbinMaterialRecord r{};
+    r.name = builder.InternString(m.name);
+    r.diffuseTexture = builder.InternString(m.diffuseTextureName);
+    r.normalTexture = builder.InternString(m.normalTextureName);
+    r.emissiveTexture = builder.InternString(m.emissiveTextureName);
+    r.specularTexture = builder.InternString(m.specularTextureName);
+
+    std::memcpy(r.diffuseColor, m.diffuseColor, sizeof(r.diffuseColor));
+    std::memcpy(r.emissiveColor, m.emissiveColor, sizeof(r.emissiveColor));
+    std::memcpy(r.specularColor, m.specularColor, sizeof(r.specularColor));
+
+    r.diffuseTransform = MakeMbinTexTransformRecord(m.diffuseTransform);
+    r.normalTransform = MakeMbinTexTransformRecord(m.normalTransform);
+    r.emissiveTransform = MakeMbinTexTransformRecord(m.emissiveTransform);
+    r.specularTransform = MakeMbinTexTransformRecord(m.specularTransform);
+    return r;
+}
+
+template <class BoneT>
+inline MbinBoneRecord MakeMbinBoneRecord(MbinSectionedBuilder& builder, const BoneT& b)
+{
+    MbinBoneRecord r{};
+    r.name = builder.InternString(b.name);
+    r.parentIndex = b.parentIndex;
+    std::memcpy(r.bindLocal, b.bindLocal, sizeof(r.bindLocal));
+    std::memcpy(r.offsetMatrix, b.offsetMatrix, sizeof(r.offsetMatrix));
+    return r;
+}
+
+inline MbinSubMeshRecord MakeMbinSubMeshRecord()
+{
+    MbinSubMeshRecord r{};
+    const float identity[16] =
+    {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+    std::memcpy(r.explicitLocalOOBBMatrix, identity, sizeof(identity));
+    for (int c = 0; c < 3; ++c) r.positionScale[c] = 1.0f;
+    for (int c = 0; c < 2; ++c) r.uvScale[c] = 1.0f;
+    r.indexStride = sizeof(uint32_t);
+    return r;
+}
+
+// 16Ʈ ε  ޽ (ε ޽  ȣ)
+inline bool CanUseMbinIndex16(size_t vertexCount)
+{
+    return vertexCount <= 65536;
+}
+
+// ----------------------------------------------------------
+// ޽ /ε ߰ (ȭ/ v5/v6 ο  Լ )
+// - record: ̸/Ƽ/OOBB ȣڰ ä 
+// - index16:  65536 ϸ 16Ʈ ε (MBIN_FLAG_INDEX16)
+//    Ʈ ״ (meshopt ε ڵ    ), indexStride  
+// ----------------------------------------------------------
+template <class VertexT>
+inline void AddMbinSubMeshStreams(
+    MbinSectionedBuilder& builder,
+    MbinSubMeshRecord record,
+    const std::vector<VertexT>& vertices,
+    const std::vector<uint32_t>& indices,
+    bool quantize,
+    bool positionHalf,
+    bool compress,
+    bool index16,
+    MbinStreamDecodeBenchmark* decodeBench)
+{
+    record.vertexCount = static_cast<uint32_t>(vertices.size());
+    record.indexCount = static_cast<uint32_t>(indices.size());
+    record.indexStride = (index16 && CanUseMbinIndex16(vertices.size())) ? sizeof(uint16_t) : sizeof(uint32_t);
+
+    const void* vertexData = vertices.data();
+    size_t vertexSize = sizeof(VertexT);
+
+    std::vector<MbinQuantizedVertex> quantized;
+    if (quantize)
+    {
+        MbinQuantizeParams params{};
+        QuantizeMbinVertices(vertices, positionHalf, quantized, params);
+        static_assert(sizeof(params) == sizeof(float) * 10, "quantize params layout");
+        std::memcpy(record.positionOffset, params.positionOffset, sizeof(record.positionOffset));
+        std::memcpy(record.positionScale, params.positionScale, sizeof(record.positionScale));
+        std::memcpy(record.uvOffset, params.uvOffset, sizeof(record.uvOffset));
+        std::memcpy(record.uvScale, params.uvScale, sizeof(record.uvScale));
+
+        vertexData = quantized.data();
+        vertexSize = sizeof(MbinQuantizedVertex);
+    }
+    record.vertexStride = static_cast<uint32_t>(vertexSize);
+
+    if (!compress)
+    {
+        if (record.indexStride == sizeof(uint16_t))
+        {
+            std::vector<uint16_t> narrow(indices.begin(), indices.end());
+            builder.AddSubMesh(record,
+                vertexData, vertexSize * vertices.size(),
+                narrow.data(), sizeof(uint16_t) * narrow.size());
+            return;
+        }
+
+        builder.AddSubMesh(record,
+            vertexData, vertexSize * vertices.size(),
+            indices.data(), sizeof(uint32_t) * indices.size());
+        return;
+    }
+
+    std::vector<uint8_t> encodedVertices;
+    std::vector<uint8_t> encodedIndices;
+    EncodeMbinVertexStream(vertexData, vertices.size(), vertexSize, encodedVertices);
+    EncodeMbinIndexStream(indices.data(), indices.size(), vertices.size(), encodedIndices);
+    if (decodeBench)
+    {
+        decodeBench->AddVertexStream(encodedVertices, vertexData, vertices.size(), vertexSize);
+        decodeBench->AddIndexStream(encodedIndices, indices.data(), indices.size());
+    }
+
+    builder.AddSubMesh(record,
+        encodedVertices.data(), encodedVertices.size(),
+        encodedIndices.data(), encodedIndices.size());
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "MbinReader.h"
+
+// ==========================================================
+// Ų MBIN ̷ ( ̸ + θ + ε ) б / ؽ
+// - ִϸ̼ Ⱑ Ʈ  ȣ ų  ũ   (FBX SDK ʿ)
+// - ؽ: FNV-1a 64,   ̸ Ʈ + '\0' + int32 parentIndex (  )
+//   Ÿ ̷ ø     ΰ ABIN skeletonHash  (Ŭ ε O(1))
+// - bindLocal / offsetMatrix: FbxAMatrix ġ ״ ( , ̵ [12..14])
+//   ۷ι = bindLocal * θ ۷ι, Ű = offsetMatrix * ۷ι
+// -  ġ(v3/v6): 24Ʈ  ٷ ڰ  
+//      string name (uint16  + UTF-8), int32 parentIndex, float bindLocal[16], float offsetMatrix[16]
+//   v7: BONE  (MbinReader.h)
+// ==========================================================
+
+struct MbinSkeletonBone
+{
+    std::string name;
+    int32_t parentIndex;
+    float bindLocal[16];
+    float offsetMatrix[16];
+};
+
+// BoneT: name(std::string) / parentIndex(int32_t) ʵ ( Bone ü ״)
+template <class BoneT>
+inline uint64_t ComputeMbinSkeletonHash(const std::vector<BoneT>& bones)
+{
+    uint64_t h = 14695981039346656037ull;
+    auto add = [&h](const void* data, size_t bytes)
+        {
+            const uint8_t* p = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < bytes; ++i)
+            {
+                h ^= p[i];
+                h *= 1099511628211ull;
+            }
+        };
+
+    for (const BoneT& b : bones)
+    {
+        add(b.name.data(), b.name.size());
+        add("", 1);
+        const int32_t parent = b.parentIndex;
+        add(&parent, sizeof(parent));
+    }
+    return h;
+}
+
+inline bool LoadMbinSkeleton(
+    const std::filesystem::path& path,
+    std::vector<MbinSkeletonBone>& outBones,
+    std::string* error = nullptr)
+{
+    outBones.clear();
+
+    MbinMappedFile file;
+    if (!file.Open(path, error))
+        return false;
+
+    const uint8_t* data = file.Data();
+    const size_t size = file.Size();
+
+    auto fail = [&](const char* message)
+        {
+            if (error) *error = message;
+            outBones.clear();
+            return false;
+        };
+
+    uint32_t version = 0;
+    if (size < 8 || std::memcmp(data, "MBIN", 4) != 0)
+        return fail("MBIN  ƴ");
+    std::memcpy(&version, data + 4, sizeof(version));
+
+    if (version == kMbinSectionedVersion)
+    {
+        MbinView view;
+        if (!view.Open(data, size, error))
+            return false;
+
+        outBones.reserve(view.BoneCount());
+        for (uint32_t i = 0; i < view.BoneCount(); ++i)
+        {
+            const MbinBoneRecord& r = view.Bones()[i];
+            MbinSkeletonBone b;
+            b.name = view.String(r.name);
+            b.parentIndex = r.parentIndex;
+            std::memcpy(b.bindLocal, r.bindLocal, sizeof(b.bindLocal));
+            std::memcpy(b.offsetMatrix, r.offsetMatrix, sizeof(b.offsetMatrix));
+            outBones.push_back(std::move(b));
+        }
+    }
+    else
+    {
+        // magic, version, flags, boneCount, materialCount, subMeshCount
+        static constexpr size_t kHeaderBytes = 24;
+        static constexpr size_t kBoneMatrixBytes = sizeof(float) * 32;
+        if (size < kHeaderBytes)
+            return fail(" ߸");
+
+        uint32_t boneCount = 0;
+        std::memcpy(&boneCount, data + 12, sizeof(boneCount));
+
+        size_t cursor = kHeaderBytes;
+        outBones.reserve(boneCount);
+        for (uint32_t i = 0; i < boneCount; ++i)
+        {
+            uint16_t len = 0;
+            if (size - cursor < sizeof(len)) return fail("  ߸");
+            std::memcpy(&len, data + cursor, sizeof(len));
+            cursor += sizeof(len);
+
+            if (size - cursor < size_t(len) + sizeof(int32_t) + kBoneMatrixBytes) return fail("  ߸");
+            MbinSkeletonBone b;
+            b.name.assign(reinterpret_cast<const char*>(data + cursor), len);
+            cursor += len;
+            std::memcpy(&b.parentIndex, data + cursor, sizeof(b.parentIndex));
+            cursor += sizeof(int32_t);
+            std::memcpy(b.bindLocal, data + cursor, sizeof(b.bindLocal));
+            std::memcpy(b.offsetMatrix, data + cursor + sizeof(b.bindLocal), sizeof(b.offsetMatrix));
+            cursor += kBoneMatrixBytes;
+            outBones.push_back(std::move(b));
+        }
+    }
+
+    if (outBones.empty())
+        return fail("  (Ų MBIN ƴ)");
+    return true;
+}
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <vector>
+
+#include "../StaticModelBinExtractor/ModelBinExtractor/meshoptimizer.h"
+#include "MbinFormat.h"
+
+// ==========================================================
+// MBIN  Ʈ (MBIN_FLAG_COMPRESSED_STREAMS, Static / Skinned )
+// - ޽ø /ε 迭 
+//     uint32 vertexStreamBytes, bytes[...]
+//     uint32 indexStreamBytes,  bytes[...]
+//   (vertexCount/indexCount, v6  Ķʹ ״ տ )
+// - : meshopt_encodeVertexBuffer ( ũ = 80 Ǵ 32)
+//   ε: meshopt_encodeIndexBuffer (ﰢ Ʈ, ׻ uint32 )
+//           ﰢ  winding ״ ﰢ    ȸ  
+// -  ĳ/ġ ȭ  ڿ ڵؾ   ´
+// - δ   DecodeMbin*Stream ( =  ջ)
+// ==========================================================
+
+inline void EncodeMbinVertexStream(
+    const void* vertices,
+    size_t vertexCount,
+    size_t vertexSize,
+    std::vector<uint8_t>& out)
+{
+    out.resize(meshopt_encodeVertexBufferBound(vertexCount, vertexSize));
+    const size_t bytes = meshopt_encodeVertexBuffer(out.data(), out.size(), vertices, vertexCount, vertexSize);
+    out.resize(bytes);
+}
+
+inline void EncodeMbinIndexStream(
+    const uint32_t* indices,
+    size_t indexCount,
+    size_t vertexCount,
+    std::vector<uint8_t>& out)
+{
+    out.resize(meshopt_encodeIndexBufferBound(indexCount, vertexCount));
+    const size_t bytes = meshopt_encodeIndexBuffer(out.data(), out.size(), indices, indexCount);
+    out.resize(bytes);
+}
+
+inline bool DecodeMbinVertexStream(
+    void* destination,
+    size_t vertexCount,
+    size_t vertexSize,
+    const uint8_t* stream,
+    size_t streamBytes)
+{
+    return meshopt_decodeVertexBuffer(destination, vertexCount, vertexSize, stream, streamBytes) == 0;
+}
+
+inline bool DecodeMbinIndexStream(
+    uint32_t* destination,
+    size_t indexCount,
+    const uint8_t* stream,
+    size_t streamBytes)
+{
+    return meshopt_decodeIndexBuffer(destination, indexCount, sizeof(uint32_t), stream, streamBytes) == 0;
+}
+
+// ----------------------------------------------------------
+//  ӵ  (ͽƮ  Ȯο, ⺻ )
+// - ڵ Ʈ  Ƶ״ٰ    -> GB/s( Ʈ )
+// - ù     (պ , ε ﰢ ȸ )
+// ----------------------------------------------------------
+class MbinStreamDecodeBenchmark
+{
+public:
+    void AddVertexStream(const std::vector<uint8_t>& encoded, const void* raw, size_t vertexCount, size_t vertexSize)
+    {
+        Stream s{};
+        s.isIndex = false;
+        s.count = vertexCount;
+        s.elementSize = vertexSize;
+        s.encoded = encoded;
+        s.raw.assign(static_cast<const uint8_t*>(raw), static_cast<const uint8_t*>(raw) + vertexCount * vertexSize);
+        m_streams.push_back(std::move(s));
+    }
+
+    void AddIndexStream(const std::vector<uint8_t>& encoded, const uint32_t* raw, size_t indexCount)
+    {
+        Stream s{};
+        s.isIndex = true;
+        s.count = indexCount;
+        s.elementSize = sizeof(uint32_t);
+        s.encoded = encoded;
+        s.raw.assign(reinterpret_cast<const uint8_t*>(raw), reinterpret_cast<const uint8_t*>(raw) + indexCount * sizeof(uint32_t));
+        m_streams.push_back(std::move(s));
+    }
+
+    // minSeconds ̻ ݺؼ 
+    bool Run(std::ostream& log, double minSeconds = 0.25) const
+    {
+        uint64_t rawVertexBytes = 0, encodedVertexBytes = 0;
+        uint64_t rawIndexBytes = 0, encodedIndexBytes = 0;
+        for (const Stream& s : m_streams)
+        {
+            (s.isIndex ? rawIndexBytes : rawVertexBytes) += s.raw.size();
+            (s.isIndex ? encodedIndexBytes : encodedVertexBytes) += s.encoded.size();
+        }
+        if (m_streams.empty()) return true;
+
+        std::vector<uint8_t> scratch;
+        bool ok = true;
+
+        // պ 
+        for (const Stream& s : m_streams)
+        {
+            scratch.resize(s.raw.size());
+            if (!DecodeStream(s, scratch.data()) || !SameAsRaw(s, scratch.data()))
+                ok = false;
+        }
+
+        const double vertexSeconds = TimeDecode(false, scratch, minSeconds);
+        const double indexSeconds = TimeDecode(true, scratch, minSeconds);
+
+        auto GBps = [](uint64_t bytes, double seconds) { return seconds > 0.0 ? bytes / seconds / 1e9 : 0.0; };
+
+        log << "[STREAM DECODE] vertex " << rawVertexBytes << " -> " << encodedVertexBytes << " bytes, "
+            << GBps(rawVertexBytes, vertexSeconds) << " GB/s"
+            << " | index " << rawIndexBytes << " -> " << encodedIndexBytes << " bytes, "
+            << GBps(rawIndexBytes, indexSeconds) << " GB/s"
+            << " | roundtrip=" << (ok ? "OK" : "MISMATCH") << "\n";
+        return ok;
+    }
+
+private:
+    struct Stream
+    {
+        bool isIndex = false;
+        size_t count = 0;
+        size_t elementSize = 0;
+        std::vector<uint8_t> encoded;
+        std::vector<uint8_t> raw;
+    };
+
+    static bool DecodeStream(const Stream& s, uint8_t* destination)
+    {
+        return s.isIndex
+            ? DecodeMbinIndexStream(reinterpret_cast<uint32_t*>(destination), s.count, s.encoded.data(), s.encoded.size())
+            : DecodeMbinVertexStream(destination, s.count, s.elementSize, s.encoded.data(), s.encoded.size());
+    }
+
+    static bool SameAsRaw(const Stream& s, const uint8_t* decoded)
+    {
+        if (!s.isIndex)
+            return std::memcmp(decoded, s.raw.data(), s.raw.size()) == 0;
+
+        const uint32_t* a = reinterpret_cast<const uint32_t*>(s.raw.data());
+        const uint32_t* b = reinterpret_cast<const uint32_t*>(decoded);
+        for (size_t t = 0; t + 2 < s.count; t += 3)
+        {
+            const bool same =
+                (b[t] == a[t] && b[t + 1] == a[t + 1] && b[t + 2] == a[t + 2]) ||
+                (b[t] == a[t + 1] && b[t + 1] == a[t + 2] && b[t + 2] == a[t]) ||
+                (b[t] == a[t + 2] && b[t + 1] == a[t] && b[t + 2] == a[t + 1]);
+            if (!same) return false;
+        }
+        return true;
+    }
+
+    //  (ش  Ʈ )  ð
+    double TimeDecode(bool indexStreams, std::vector<uint8_t>& scratch, double minSeconds) const
+    {
+        using Clock = std::chrono::steady_clock;
+
+        size_t rounds = 0;
+        const Clock::time_point start = Clock::now();
+        double elapsed = 0.0;
+
+        do
+        {
+            for (const Stream& s : m_streams)
+            {
+                if (s.isIndex != indexStreams) continue;
+                scratch.resize(s.raw.size());
+                DecodeStream(s, scratch.data());
+            }
+            ++rounds;
+            elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        } while (elapsed < minSeconds);
+
+        return elapsed / static_cast<double>(rounds);
+    }
+
+    std::vector<Stream> m_streams;
+};
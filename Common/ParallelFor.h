@@ -0,0 +1,90 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "BatchExport.h"
+
+// ==========================================================
+//    ۾ (LOD/޽ )
+// -  ȣڰ ̸ ũ⸦ Ƶ Կ ε  ->  
+// - ۾ α׵  Ҵٰ ε  ȣ α׿ δ
+//   (  ϰ    )
+// - ġ Ŀ    ׸ŭ ھ  
+// ==========================================================
+
+inline unsigned ParallelForThreadBudget()
+{
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    const unsigned activeJobs = std::max<unsigned>(1u, BatchActiveJobCount().load());
+    return std::max(1u, hw / activeJobs);
+}
+
+inline void ParallelFor(size_t taskCount, const std::function<void(size_t taskIndex)>& task)
+{
+    if (taskCount == 0) return;
+
+    const unsigned threadCount =
+        static_cast<unsigned>(std::min<size_t>(ParallelForThreadBudget(), taskCount));
+
+    std::vector<std::ostringstream> taskLogs(taskCount);
+    std::atomic<size_t> nextTask{ 0 };
+
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+
+    auto Worker = [&]()
+        {
+            std::ostringstream* const outerSlot = BatchJobLogSlot();
+
+            for (;;)
+            {
+                const size_t i = nextTask.fetch_add(1);
+                if (i >= taskCount) break;
+
+                BatchJobLogSlot() = &taskLogs[i];
+                try
+                {
+                    task(i);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!firstError) firstError = std::current_exception();
+                }
+            }
+
+            BatchJobLogSlot() = outerSlot;
+        };
+
+    if (threadCount <= 1)
+    {
+        Worker();
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        for (unsigned t = 1; t < threadCount; ++t)
+            threads.emplace_back(Worker);
+
+        Worker(); // ȣ 嵵  Ѵ
+
+        for (std::thread& th : threads)
+            th.join();
+    }
+
+    std::ostream& log = BatchLog();
+    for (const std::ostringstream& taskLog : taskLogs)
+        log << taskLog.str();
+
+    if (firstError)
+        std::rethrow_exception(firstError);
+}
@@ -0,0 +1,246 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <chrono>
+#include <filesystem>
+#include <system_error>
+#include <algorithm>
+
+#include <fbxsdk.h>
+
+#include "../../Common/FbxCurveEvaluator.h"
+#include "../../Common/FbxSceneImport.h"
+
+using namespace std;
+
+// ==========================================================
+// Ŀ   : FbxCurveEvaluator.h vs EvaluateLocalTransform
+// - import/ Ʒ FBX   Ʈ (ConvertSceneToExportSpace) 
+//   AnimStack ,  θ   ؼ  T/R/S  
+//    ð =   kCheckSampleRate  +   Ŀ Ű ð
+// - ѵ Ѵ  ̸ ϰ  ڵ 1
+//   (AnimeBinExtractor NATIVE_CURVE_EVAL ѱ  ͼ¿    )
+// - ̾  ̻  ⵵ SDK 򰡶 ǳʶ
+// -  ð   ( 򰡴   ,  )
+// ==========================================================
+
+static constexpr double kCheckSampleRate = 60.0;
+
+// ѵ: AnimeBinExtractor kNativeEval*Tolerance   (̵ EXPORT_SCALE_F    )
+static constexpr double kTranslationTolerance = 1e-3;
+static constexpr double kRotationToleranceDeg = 0.01;
+static constexpr double kScaleTolerance = 1e-5;
+
+struct CurveEvalError
+{
+    double t = 0.0;
+    double rDeg = 0.0;
+    double s = 0.0;
+
+    void Max(const CurveEvalError& o)
+    {
+        t = max(t, o.t);
+        rDeg = max(rDeg, o.rDeg);
+        s = max(s, o.s);
+    }
+
+    bool Exceeds() const
+    {
+        return t > kTranslationTolerance || rDeg > kRotationToleranceDeg || s > kScaleTolerance;
+    }
+};
+
+struct CheckTotals
+{
+    size_t stacks = 0;
+    size_t skippedStacks = 0;
+    size_t nodes = 0;
+    size_t samples = 0;
+    size_t failedNodes = 0;
+    double nativeSeconds = 0.0;
+    double sdkSeconds = 0.0;
+    CurveEvalError maxError;
+};
+
+static double QuatAngleDeg(const double a[4], const double b[4])
+{
+    const double dot = fabs(a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3]);
+    return 2.0 * acos(min(dot, 1.0)) * 180.0 / 3.14159265358979323846;
+}
+
+static void CollectNodes(FbxNode* node, vector<FbxNode*>& out)
+{
+    out.push_back(node);
+    for (int i = 0; i < node->GetChildCount(); ++i)
+        CollectNodes(node->GetChild(i), out);
+}
+
+//  +   Ű ð (, ߺ )
+static void BuildSampleTimes(const FbxNodeCurveSnapshot& snapshot, double startSec, double endSec, vector<double>& out)
+{
+    out.clear();
+    const size_t gridCount = static_cast<size_t>(ceil((endSec - startSec) * kCheckSampleRate)) + 1;
+    for (size_t i = 0; i < gridCount; ++i)
+        out.push_back(min(startSec + double(i) / kCheckSampleRate, endSec));
+
+    for (const FbxCurveSnapshot& c : snapshot.curves)
+        for (double t : c.times)
+            if (t >= startSec && t <= endSec)
+                out.push_back(t);
+
+    sort(out.begin(), out.end());
+    out.erase(unique(out.begin(), out.end()), out.end());
+}
+
+static void CheckStack(FbxScene* scene, FbxAnimStack* stack, const string& fileName, CheckTotals& totals)
+{
+    using Clock = chrono::steady_clock;
+
+    scene->SetCurrentAnimationStack(stack);
+    const string stackName = stack->GetName();
+
+    if (stack->GetMemberCount<FbxAnimLayer>() != 1)
+    {
+        cout << fileName << " [" << stackName << "]: ̾ " << stack->GetMemberCount<FbxAnimLayer>() << ", ǳʶ\n";
+        ++totals.skippedStacks;
+        return;
+    }
+    FbxAnimLayer* layer = stack->GetMember<FbxAnimLayer>(0);
+
+    const FbxTimeSpan span = stack->GetLocalTimeSpan();
+    const double startSec = span.GetStart().GetSecondDouble();
+    const double endSec = max(startSec, span.GetStop().GetSecondDouble());
+
+    vector<FbxNode*> nodes;
+    CollectNodes(scene->GetRootNode(), nodes);
+
+    CurveEvalError stackError;
+    size_t stackSamples = 0, stackFailed = 0;
+    FbxNodeCurveSnapshot snapshot;
+    FbxLocalTrsSamples local;
+    vector<double> times;
+
+    for (FbxNode* node : nodes)
+    {
+        CaptureFbxNodeCurves(node, layer, snapshot);
+        BuildSampleTimes(snapshot, startSec, endSec, times);
+
+        const Clock::time_point nativeStart = Clock::now();
+        CaptureFbxNodeCurves(node, layer, snapshot);
+        EvaluateFbxNodeCurves(snapshot, times.data(), times.size(), local);
+        totals.nativeSeconds += chrono::duration<double>(Clock::now() - nativeStart).count();
+
+        CurveEvalError nodeError;
+        const Clock::time_point sdkStart = Clock::now();
+        for (size_t j = 0; j < times.size(); ++j)
+        {
+            FbxTime t;
+            t.SetSecondDouble(times[j]);
+            const FbxAMatrix m = node->EvaluateLocalTransform(t);
+            const FbxVector4 T = m.GetT();
+            FbxQuaternion Q = m.GetQ();
+            const FbxVector4 S = m.GetS();
+            Q.Normalize();
+
+            const double dx = local.t[0][j] - T[0], dy = local.t[1][j] - T[1], dz = local.t[2][j] - T[2];
+            const double qa[4] = { local.q[0][j], local.q[1][j], local.q[2][j], local.q[3][j] };
+            const double qb[4] = { Q[0], Q[1], Q[2], Q[3] };
+
+            CurveEvalError e;
+            e.t = sqrt(dx * dx + dy * dy + dz * dz);
+            e.rDeg = QuatAngleDeg(qa, qb);
+            e.s = max({ fabs(local.s[0][j] - S[0]), fabs(local.s[1][j] - S[1]), fabs(local.s[2][j] - S[2]) });
+            nodeError.Max(e);
+        }
+        totals.sdkSeconds += chrono::duration<double>(Clock::now() - sdkStart).count();
+
+        if (nodeError.Exceeds())
+        {
+            cout << "  ġ " << node->GetName() << ": T=" << nodeError.t << " R=" << nodeError.rDeg
+                << "deg S=" << nodeError.s << "\n";
+            ++stackFailed;
+        }
+        stackError.Max(nodeError);
+        stackSamples += times.size();
+    }
+
+    cout << fileName << " [" << stackName << "]:  " << nodes.size() << ",  " << stackSamples
+        << ", ִ  T=" << stackError.t << " R=" << stackError.rDeg << "deg S=" << stackError.s
+        << ", ġ  " << stackFailed << "\n";
+
+    ++totals.stacks;
+    totals.nodes += nodes.size();
+    totals.samples += stackSamples;
+    totals.failedNodes += stackFailed;
+    totals.maxError.Max(stackError);
+}
+
+// ==========================================================
+// main
+// ==========================================================
+
+int main()
+{
+    namespace fs = std::filesystem;
+
+    const fs::path importDir = "import";
+    std::error_code ec;
+
+    vector<fs::path> fbxFiles;
+    for (fs::recursive_directory_iterator it(importDir, ec), end; !ec && it != end; it.increment(ec))
+    {
+        if (!it->is_regular_file(ec)) continue;
+        string ext = it->path().extension().string();
+        transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(tolower(c)); });
+        if (ext == ".fbx")
+            fbxFiles.push_back(it->path());
+    }
+    sort(fbxFiles.begin(), fbxFiles.end());
+
+    if (fbxFiles.empty())
+    {
+        cout << "import  FBX  \n";
+        return 1;
+    }
+
+    FbxManager* manager = FbxManager::Create();
+    FbxIOSettings* ios = FbxIOSettings::Create(manager, IOSROOT);
+    manager->SetIOSettings(ios);
+
+    CheckTotals totals;
+    size_t failedFiles = 0;
+
+    for (const fs::path& fbxPath : fbxFiles)
+    {
+        FbxScene* scene = ImportFbxScene(manager, fbxPath.string(), "CurveEvalCheck");
+        if (!scene)
+        {
+            ++failedFiles;
+            continue;
+        }
+
+        //    (DirectX + meter)
+        ConvertSceneToExportSpace(scene);
+
+        const string fileName = fbxPath.filename().string();
+        for (int i = 0; i < scene->GetSrcObjectCount<FbxAnimStack>(); ++i)
+            CheckStack(scene, scene->GetSrcObject<FbxAnimStack>(i), fileName, totals);
+
+        scene->Destroy();
+    }
+
+    manager->Destroy();
+
+    auto Ms = [](double seconds) { return seconds * 1000.0; };
+
+    cout << "\n==========================================\n";
+    cout << " " << fbxFiles.size() << " (  " << failedFiles << "),  " << totals.stacks
+        << " (ǳʶ " << totals.skippedStacks << "),  " << totals.nodes << ",  " << totals.samples << "\n";
+    cout << "ִ  T=" << totals.maxError.t << " R=" << totals.maxError.rDeg << "deg S=" << totals.maxError.s << "\n";
+    cout << " ð:  " << Ms(totals.nativeSeconds) << " ms | SDK " << Ms(totals.sdkSeconds) << " ms\n";
+    cout << "ġ  " << totals.failedNodes << "\n";
+
+    return (totals.failedNodes == 0 && failedFiles == 0) ? 0 : 1;
+}
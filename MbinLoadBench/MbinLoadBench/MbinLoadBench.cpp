@@ -0,0 +1,406 @@
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <chrono>
+#include <filesystem>
+#include <system_error>
+#include <algorithm>
+
+#include "../../Common/BinaryWriter.h"
+#include "../../Common/MbinReader.h"
+#include "../../Common/MbinSectionedWriter.h"
+
+using namespace std;
+
+// ==========================================================
+// MBIN ε ð :  ġ(Static v5 / Skinned v3) vs v7  ġ(mmap)
+// - export/ Ʒ  ġ BIN
+//   1)  : ifstream ʵ  Ľ + /ε ͷ 
+//   2)   v7 ȯ ӽ   -> MbinFile  ( + ˻)
+//      ( 65536  ޽ô 16Ʈ ε,  WRITE_INDEX16 )
+//      "ε"(/ε ¡ ۷ memcpy)  ð 
+//   v7 ε /ε Ǯ °   
+// - ϸ minSeconds ̻ ݺؼ  (OS  ĳð   ,
+//   ݵ ε ũ ӵ ؼ  ̰ پ)
+// - ȭ/(v6, flags != 0)  Static/Skinned   ż ǳʶ
+// - FBX SDK ʿ
+// ==========================================================
+
+static constexpr double kMinSecondsPerMeasure = 0.25;
+
+// ==========================================================
+//  ġ б (v5/v3, ʵ )
+// ==========================================================
+
+struct SequentialSubMesh
+{
+    string meshName;
+    string authoringPath;
+    uint32_t materialIndex = 0;
+    uint32_t hasExplicitLocalOOBB = 0;
+    float explicitLocalOOBBMatrix[16] = {};
+
+    uint32_t vertexCount = 0;
+    vector<uint8_t> vertices;   // 80Ʈ 
+    vector<uint32_t> indices;
+};
+
+struct SequentialBone
+{
+    string name;
+    int32_t parentIndex = -1;
+    float bindLocal[16] = {};
+    float offsetMatrix[16] = {};
+};
+
+struct SequentialTexTransform
+{
+    float scale[2] = {};
+    float offset[2] = {};
+    uint32_t wrapMode[2] = {};
+};
+
+struct SequentialMaterial
+{
+    string name;
+    string diffuseTextureName;
+    string normalTextureName;
+    string emissiveTextureName;
+    string specularTextureName;
+
+    float diffuseColor[4] = {};
+    float emissiveColor[4] = {};
+    float specularColor[4] = {};
+
+    SequentialTexTransform diffuseTransform;
+    SequentialTexTransform normalTransform;
+    SequentialTexTransform emissiveTransform;
+    SequentialTexTransform specularTransform;
+};
+
+struct SequentialModel
+{
+    uint32_t version = 0;
+    vector<SequentialBone> bones;
+    vector<SequentialMaterial> materials;
+    vector<SequentialSubMesh> subMeshes;
+};
+
+static constexpr size_t kSequentialVertexSize = 80;
+
+static bool ReadRaw(ifstream& in, void* data, size_t size)
+{
+    in.read(static_cast<char*>(data), static_cast<streamsize>(size));
+    return static_cast<bool>(in);
+}
+
+static bool ReadUInt32(ifstream& in, uint32_t& v) { return ReadRaw(in, &v, sizeof(v)); }
+
+static bool ReadStringUtf8(ifstream& in, string& s)
+{
+    uint16_t len = 0;
+    if (!ReadRaw(in, &len, sizeof(len))) return false;
+    s.resize(len);
+    return len == 0 || ReadRaw(in, s.data(), len);
+}
+
+static bool ReadTexTransform(ifstream& in, SequentialTexTransform& t)
+{
+    return ReadRaw(in, t.scale, sizeof(t.scale)) &&
+        ReadRaw(in, t.offset, sizeof(t.offset)) &&
+        ReadRaw(in, t.wrapMode, sizeof(t.wrapMode));
+}
+
+static bool LoadSequentialModelBin(const filesystem::path& path, SequentialModel& model)
+{
+    model = SequentialModel{};
+
+    ifstream in(path, ios::binary);
+    if (!in.is_open()) return false;
+
+    char magic[4] = {};
+    uint32_t flags = 0, boneCount = 0, materialCount = 0, subCount = 0;
+    if (!ReadRaw(in, magic, 4) || memcmp(magic, "MBIN", 4) != 0) return false;
+    if (!ReadUInt32(in, model.version) || !ReadUInt32(in, flags)) return false;
+    if (!ReadUInt32(in, boneCount) || !ReadUInt32(in, materialCount) || !ReadUInt32(in, subCount)) return false;
+
+    const bool isStatic = (model.version == 5);
+    if ((model.version != 5 && model.version != 3) || flags != 0) return false;
+
+    model.bones.resize(boneCount);
+    for (SequentialBone& b : model.bones)
+    {
+        if (!ReadStringUtf8(in, b.name) ||
+            !ReadRaw(in, &b.parentIndex, sizeof(b.parentIndex)) ||
+            !ReadRaw(in, b.bindLocal, sizeof(b.bindLocal)) ||
+            !ReadRaw(in, b.offsetMatrix, sizeof(b.offsetMatrix)))
+            return false;
+    }
+
+    model.materials.resize(materialCount);
+    for (SequentialMaterial& m : model.materials)
+    {
+        if (!ReadStringUtf8(in, m.name) ||
+            !ReadStringUtf8(in, m.diffuseTextureName) ||
+            !ReadStringUtf8(in, m.normalTextureName) ||
+            !ReadStringUtf8(in, m.emissiveTextureName) ||
+            !ReadStringUtf8(in, m.specularTextureName) ||
+            !ReadRaw(in, m.diffuseColor, sizeof(m.diffuseColor)) ||
+            !ReadRaw(in, m.emissiveColor, sizeof(m.emissiveColor)) ||
+            !ReadRaw(in, m.specularColor, sizeof(m.specularColor)) ||
+            !ReadTexTransform(in, m.diffuseTransform) ||
+            !ReadTexTransform(in, m.normalTransform) ||
+            !ReadTexTransform(in, m.emissiveTransform) ||
+            !ReadTexTransform(in, m.specularTransform))
+            return false;
+    }
+
+    model.subMeshes.resize(subCount);
+    for (SequentialSubMesh& sm : model.subMeshes)
+    {
+        if (!ReadStringUtf8(in, sm.meshName)) return false;
+        if (isStatic && !ReadStringUtf8(in, sm.authoringPath)) return false;
+        if (!ReadUInt32(in, sm.materialIndex)) return false;
+        if (isStatic &&
+            (!ReadUInt32(in, sm.hasExplicitLocalOOBB) ||
+             !ReadRaw(in, sm.explicitLocalOOBBMatrix, sizeof(sm.explicitLocalOOBBMatrix))))
+            return false;
+
+        uint32_t idxCount = 0;
+        if (!ReadUInt32(in, sm.vertexCount) || !ReadUInt32(in, idxCount)) return false;
+
+        sm.vertices.resize(static_cast<size_t>(sm.vertexCount) * kSequentialVertexSize);
+        sm.indices.resize(idxCount);
+        if (!ReadRaw(in, sm.vertices.data(), sm.vertices.size()) ||
+            !ReadRaw(in, sm.indices.data(), sm.indices.size() * sizeof(uint32_t)))
+            return false;
+    }
+
+    return true;
+}
+
+// ==========================================================
+//   v7
+// ==========================================================
+
+static BinaryWriter BuildSectionedFromSequential(const SequentialModel& model)
+{
+    MbinSectionedBuilder builder;
+
+    for (const SequentialBone& b : model.bones)
+        builder.AddBone(MakeMbinBoneRecord(builder, b));
+
+    for (const SequentialMaterial& m : model.materials)
+        builder.AddMaterial(MakeMbinMaterialRecord(builder, m));
+
+    for (const SequentialSubMesh& sm : model.subMeshes)
+    {
+        MbinSubMeshRecord record = MakeMbinSubMeshRecord();
+        record.name = builder.InternString(sm.meshName);
+        record.authoringPath = builder.InternString(sm.authoringPath);
+        record.materialIndex = sm.materialIndex;
+        record.hasExplicitLocalOOBB = sm.hasExplicitLocalOOBB;
+        memcpy(record.explicitLocalOOBBMatrix, sm.explicitLocalOOBBMatrix, sizeof(record.explicitLocalOOBBMatrix));
+        record.vertexCount = sm.vertexCount;
+        record.indexCount = static_cast<uint32_t>(sm.indices.size());
+        record.vertexStride = static_cast<uint32_t>(kSequentialVertexSize);
+
+        if (CanUseMbinIndex16(sm.vertexCount))
+        {
+            const vector<uint16_t> narrow(sm.indices.begin(), sm.indices.end());
+            record.indexStride = sizeof(uint16_t);
+            builder.AddSubMesh(record,
+                sm.vertices.data(), sm.vertices.size(),
+                narrow.data(), narrow.size() * sizeof(uint16_t));
+            continue;
+        }
+
+        builder.AddSubMesh(record,
+            sm.vertices.data(), sm.vertices.size(),
+            sm.indices.data(), sm.indices.size() * sizeof(uint32_t));
+    }
+
+    return builder.Build(MBIN_FLAG_INDEX16);
+}
+
+// ==========================================================
+// 
+// ==========================================================
+
+// ε 䳻: /ε ¡  ϳ ̾ δ
+class StagingBuffer
+{
+public:
+    void Reset() { m_used = 0; }
+
+    void Upload(const void* data, size_t bytes)
+    {
+        if (m_used + bytes > m_bytes.size())
+            m_bytes.resize(m_used + bytes);
+        if (bytes > 0)
+            memcpy(m_bytes.data() + m_used, data, bytes);
+        m_used += bytes;
+    }
+
+    size_t Used() const { return m_used; }
+
+private:
+    vector<uint8_t> m_bytes;
+    size_t m_used = 0;
+};
+
+// fn false ָ  (-1)
+template <class Fn>
+static double MeasureAverageSeconds(Fn&& fn)
+{
+    using Clock = chrono::steady_clock;
+
+    size_t rounds = 0;
+    const Clock::time_point start = Clock::now();
+    double elapsed = 0.0;
+
+    do
+    {
+        if (!fn()) return -1.0;
+        ++rounds;
+        elapsed = chrono::duration<double>(Clock::now() - start).count();
+    } while (elapsed < kMinSecondsPerMeasure);
+
+    return elapsed / static_cast<double>(rounds);
+}
+
+struct LoadTimes
+{
+    double sequential = 0.0;
+    double sequentialUpload = 0.0;
+    double sectioned = 0.0;
+    double sectionedUpload = 0.0;
+};
+
+static bool BenchmarkFile(const filesystem::path& binPath, const filesystem::path& tmpDir, LoadTimes& times)
+{
+    SequentialModel model;
+    if (!LoadSequentialModelBin(binPath, model))
+        return false;
+
+    const filesystem::path v7Path = tmpDir / (binPath.stem().string() + ".v7.bin");
+    BinaryWriter sectioned = BuildSectionedFromSequential(model);
+    if (!WriteFileAtomic(v7Path.string(), sectioned.Data(), sectioned.Size()))
+    {
+        cout << "  v7 ӽ   : " << v7Path.string() << "\n";
+        return false;
+    }
+
+    StagingBuffer staging;
+
+    times.sequential = MeasureAverageSeconds([&]
+        {
+            return LoadSequentialModelBin(binPath, model);
+        });
+
+    times.sequentialUpload = MeasureAverageSeconds([&]
+        {
+            if (!LoadSequentialModelBin(binPath, model)) return false;
+            staging.Reset();
+            for (const SequentialSubMesh& sm : model.subMeshes)
+            {
+                staging.Upload(sm.vertices.data(), sm.vertices.size());
+                staging.Upload(sm.indices.data(), sm.indices.size() * sizeof(uint32_t));
+            }
+            return true;
+        });
+
+    times.sectioned = MeasureAverageSeconds([&]
+        {
+            MbinFile file;
+            return file.Open(v7Path);
+        });
+
+    times.sectionedUpload = MeasureAverageSeconds([&]
+        {
+            MbinFile file;
+            if (!file.Open(v7Path)) return false;
+            const MbinView& view = file.View();
+            staging.Reset();
+            staging.Upload(view.VertexPoolData(), static_cast<size_t>(view.VertexPoolBytes()));
+            staging.Upload(view.IndexPoolData(), static_cast<size_t>(view.IndexPoolBytes()));
+            return true;
+        });
+
+    std::error_code ec;
+    filesystem::remove(v7Path, ec);
+
+    return times.sequential >= 0.0 && times.sequentialUpload >= 0.0 &&
+        times.sectioned >= 0.0 && times.sectionedUpload >= 0.0;
+}
+
+// ==========================================================
+// main
+// ==========================================================
+
+int main()
+{
+    namespace fs = std::filesystem;
+
+    const fs::path exportDir = "export";
+    std::error_code ec;
+    const fs::path tmpDir = fs::temp_directory_path(ec) / "mbin_load_bench";
+    fs::create_directories(tmpDir, ec);
+
+    vector<fs::path> binFiles;
+    for (fs::recursive_directory_iterator it(exportDir, ec), end; !ec && it != end; it.increment(ec))
+    {
+        if (it->is_regular_file(ec) && it->path().extension() == ".bin")
+            binFiles.push_back(it->path());
+    }
+    sort(binFiles.begin(), binFiles.end());
+
+    if (binFiles.empty())
+    {
+        cout << "export  BIN  \n";
+        return 1;
+    }
+
+    auto Ms = [](double seconds) { return seconds * 1000.0; };
+
+    LoadTimes total{};
+    size_t measured = 0;
+    size_t skipped = 0;
+
+    for (const fs::path& binPath : binFiles)
+    {
+        LoadTimes times{};
+        if (!BenchmarkFile(binPath, tmpDir, times))
+        {
+            ++skipped;
+            continue;
+        }
+
+        cout << binPath.filename().string()
+            << ": v5/v3 " << Ms(times.sequential) << " ms (+ε " << Ms(times.sequentialUpload) << " ms)"
+            << " | v7 " << Ms(times.sectioned) << " ms (+ε " << Ms(times.sectionedUpload) << " ms)\n";
+
+        total.sequential += times.sequential;
+        total.sequentialUpload += times.sequentialUpload;
+        total.sectioned += times.sectioned;
+        total.sectionedUpload += times.sectionedUpload;
+        ++measured;
+    }
+
+    fs::remove(tmpDir, ec);
+
+    cout << "\n==========================================\n";
+    cout << " " << measured << ", ǳʶ " << skipped << " (v6//v7/б )\n";
+    if (measured == 0)
+        return 1;
+
+    cout << "հ v5/v3 " << Ms(total.sequential) << " ms (+ε " << Ms(total.sequentialUpload) << " ms)"
+        << " | v7 " << Ms(total.sectioned) << " ms (+ε " << Ms(total.sectionedUpload) << " ms)\n";
+    if (total.sectionedUpload > 0.0)
+        cout << "ε  ӵ x" << (total.sequentialUpload / total.sectionedUpload) << "\n";
+
+    return 0;
+}
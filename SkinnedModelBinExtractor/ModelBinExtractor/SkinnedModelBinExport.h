@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <fbxsdk.h>
+
+// ==========================================================
+// Ų :    ( ⿡ )
+// - scene ConvertSceneToExportSpace + TriangulateScene  
+// -   δ outOutputs ߰ (ͽƮ ĳ Ͽ)
+// ==========================================================
+
+namespace SkinnedModelBin
+{
+    //   + EXPORT_SCALE / MIRROR_X / EXPORT_ROT
+    uint64_t ComputeExportSettingsHash();
+
+    // skipIfEmpty: Ų ޽ð ϳ    ʰ  ó
+    bool ExportSkinnedModelScene(
+        FbxScene* scene,
+        const std::string& name,
+        const std::string& exportDir,
+        bool skipIfEmpty,
+        std::vector<std::string>& outOutputs);
+}
@@ -13,11 +13,28 @@
 #include <filesystem>
 #include <system_error>
 #include <cmath>
+#include <cstddef>
 
 #include <fbxsdk.h>
+#include "../../Common/BatchExport.h"
+#include "../../Common/BinaryWriter.h"
+#include "../../Common/ExportCache.h"
+#include "../../Common/FbxMaterialExtract.h"
+#include "../../Common/FbxPolygonVertexDedup.h"
+#include "../../Common/FbxSceneImport.h"
+#include "../../Common/MbinFormat.h"
+#include "../../Common/MbinQuantize.h"
+#include "../../Common/MbinSectionedWriter.h"
+#include "../../Common/MbinStreamCodec.h"
+#include "../../Common/ParallelFor.h"
+#include "../../StaticModelBinExtractor/ModelBinExtractor/meshoptimizer.h"
+#include "SkinnedModelBinExport.h"
 
 using namespace std;
 
+namespace SkinnedModelBin
+{
+
 static constexpr double EXPORT_SCALE_D = 0.01;
 static constexpr float  EXPORT_SCALE_F = 0.01f;
 static constexpr bool MIRROR_X_EXPORT = true;
@@ -26,6 +43,53 @@ static constexpr double EXPORT_ROT_X_DEG = -90.0;
 static constexpr double EXPORT_ROT_Y_DEG = 0.0;
 static constexpr double EXPORT_ROT_Z_DEG = 0.0;
 
+// GPU ȭ (޽ø weld ->  ĳ ->  ->  ġ)
+static constexpr unsigned kVertexCacheSize = 16;    // ACMR   ĳ ũ
+static constexpr float kOverdrawThreshold = 1.05f;  // θ   ĳ ȿ ̸ŭ 纸
+
+// MBIN v6 ȭ  (MbinQuantize.h, 80 -> 32Ʈ). false  v3 ״
+//  256  uint8 ε  Ƿ  ϸ v3 
+static constexpr bool QUANTIZE_VERTICES = false;
+static constexpr bool QUANTIZE_POSITION_HALF = false; // true: fp16, false: unorm16 (޽ AABB )
+
+// /ε meshopt ڵ Ʈ  (MbinStreamCodec.h,  flags ǥ)
+static constexpr bool COMPRESS_STREAMS = false;
+// COMPRESS_STREAMS  ϸ  ӵ(GB/s) պ   α׷
+static constexpr bool BENCHMARK_STREAM_DECODE = false;
+
+// MBIN v7  ġ (MbinSectionedFormat.h):   + 16Ʈ  /ε + ڿ ̺
+//  MbinReader.h mmap    ε. false   ġ(v3/v6)
+static constexpr bool WRITE_SECTIONED_LAYOUT = false;
+
+// v7 :  65536  ޽ô 16Ʈ ε ( flags ǥ)
+// /ε  ϳ Ǯ ϳ (VTXB/IDXB), ޽ô firstIndex/indexCount/baseVertex ׸
+static constexpr bool WRITE_INDEX16 = false;
+
+//  ͽƮ ĳ: (BIN) ޶  ϸ ø 
+// ( ü : export/.exportcache_skinned )
+static constexpr uint32_t kExportToolVersion = 4;
+
+uint64_t ComputeExportSettingsHash()
+{
+    ExportHasher h;
+    h.AddString("SkinnedModelBinExtractor");
+    h.AddU32(kExportToolVersion);
+    h.AddDouble(EXPORT_SCALE_D);
+    h.AddFloat(EXPORT_SCALE_F);
+    h.AddBool(MIRROR_X_EXPORT);
+    h.AddDouble(EXPORT_ROT_X_DEG);
+    h.AddDouble(EXPORT_ROT_Y_DEG);
+    h.AddDouble(EXPORT_ROT_Z_DEG);
+    h.AddU32(kVertexCacheSize);
+    h.AddFloat(kOverdrawThreshold);
+    h.AddBool(QUANTIZE_VERTICES);
+    h.AddBool(QUANTIZE_POSITION_HALF);
+    h.AddBool(COMPRESS_STREAMS);
+    h.AddBool(WRITE_SECTIONED_LAYOUT);
+    h.AddBool(WRITE_INDEX16);
+    return h.Finish();
+}
+
 static FbxAMatrix MakeRotateX(double deg)
 {
     FbxAMatrix R;
@@ -63,8 +127,8 @@ static FbxAMatrix BuildExportRotation()
 #define DEBUGLOG 1
 
 #if DEBUGLOG
-#define DLOG(x)   do { std::cout << x; } while(0)
-#define DLOGLN(x) do { std::cout << x << "\n"; } while(0)
+#define DLOG(x)   do { BatchLog() << x; } while(0)
+#define DLOGLN(x) do { BatchLog() << x << "\n"; } while(0)
 #else
 #define DLOG(x)   do {} while(0)
 #define DLOGLN(x) do {} while(0)
@@ -72,7 +136,7 @@ static FbxAMatrix BuildExportRotation()
 
 
 // ==========================================================
-//    (FBX Ľ  ⿡ ä)
+//   (FBX Ľ  ۾ ؽƮ ä)
 // ==========================================================
 
 struct Bone {
@@ -91,557 +155,251 @@ struct Vertex {
     float boneWeights[4];
 };
 
-struct MaterialTexTransform
-{
-    float scale[2] = { 1.0f, 1.0f };
-    float offset[2] = { 0.0f, 0.0f };
-    uint32_t wrapMode[2] = { 0u, 0u }; // 0=Repeat, 1=Clamp
-};
-
-struct Material
-{
-    string name;
-    string diffuseTextureName;
-    string normalTextureName;
-    string emissiveTextureName;
-    string specularTextureName;
-
-    float diffuseColor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
-    float emissiveColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
-    float specularColor[4] = { 0.0f, 0.0f, 0.0f, 0.0f }; // rgb=specular, a=shininess
-
-    MaterialTexTransform diffuseTransform;
-    MaterialTexTransform normalTransform;
-    MaterialTexTransform emissiveTransform;
-    MaterialTexTransform specularTransform;
-};
-
 struct SubMesh {
     string meshName;
-    uint32_t materialIndex;   // g_Materials ε
+    uint32_t materialIndex;   // materials ε
     vector<Vertex> vertices;
     vector<uint32_t> indices;
 };
 
-vector<Bone> g_Bones;
-vector<SubMesh> g_SubMeshes;
-unordered_map<string, int> g_BoneNameToIndex;
-unordered_map<string, FbxNode*> g_BoneNameToNode;
-
-vector<Material> g_Materials;
-unordered_map<string, uint32_t> g_MaterialNameToIndex;
-
-// ==========================================================
-// [] u8path()  (C++20 deprecation )
-// - u8path(fn) : std::u8string(UTF-8 Ʈ) -> path 
-// ==========================================================
-static std::string SafeStemFromFbxFileName(const char* fn)
+// ġ Ŀ ϳ:   ۾ ؽƮ ´
+struct SkinnedExportContext
 {
-    if (!fn || !fn[0]) return "";
-
-    try
-    {
-        std::string s(fn);
-        std::u8string u8(reinterpret_cast<const char8_t*>(s.data()), s.size());
-        std::filesystem::path p(u8);
-
-        std::u8string stem_u8 = p.stem().u8string();
-        return std::string(reinterpret_cast<const char*>(stem_u8.data()), stem_u8.size());
-    }
-    catch (...)
-    {
-        std::string s(fn);
-
-        size_t pos = s.find_last_of("/\\");
-        std::string base = (pos == std::string::npos) ? s : s.substr(pos + 1);
-
-        size_t dot = base.find_last_of('.');
-        if (dot != std::string::npos) base = base.substr(0, dot);
+    vector<Bone> bones;
+    vector<SubMesh> subMeshes;
+    unordered_map<string, int> boneNameToIndex;
+    unordered_map<string, FbxNode*> boneNameToNode;
 
-        return base;
-    }
-}
-
-// ==========================================================
-//   Ʈ ()
-// ==========================================================
-static std::ofstream g_out;
+    vector<Material> materials;
+    unordered_map<string, uint32_t> materialNameToIndex;
+};
 
 // ==========================================================
-// Raw write helpers
+// Raw write helpers (Ʈ ۾  )
 // ==========================================================
-static void WriteRaw(const void* data, size_t size)
+static void WriteRaw(BinaryWriter& out, const void* data, size_t size)
 {
-    g_out.write(reinterpret_cast<const char*>(data), size);
+    out.WriteRaw(data, size);
 }
 
-static void WriteUInt16(uint16_t v) { WriteRaw(&v, sizeof(v)); }
-static void WriteUInt32(uint32_t v) { WriteRaw(&v, sizeof(v)); }
-static void WriteInt32(int32_t v) { WriteRaw(&v, sizeof(v)); }
+static void WriteUInt16(BinaryWriter& out, uint16_t v) { WriteRaw(out, &v, sizeof(v)); }
+static void WriteUInt32(BinaryWriter& out, uint32_t v) { WriteRaw(out, &v, sizeof(v)); }
+static void WriteInt32(BinaryWriter& out, int32_t v) { WriteRaw(out, &v, sizeof(v)); }
 
-static void WriteFloatArray(const float* f, size_t count)
+static void WriteFloatArray(BinaryWriter& out, const float* f, size_t count)
 {
-    WriteRaw(f, sizeof(float) * count);
+    WriteRaw(out, f, sizeof(float) * count);
 }
 
-static void WriteStringUtf8(const std::string& s)
+static void WriteStringUtf8(BinaryWriter& out, const std::string& s)
 {
     uint16_t len = static_cast<uint16_t>(s.size());
-    WriteUInt16(len);
+    WriteUInt16(out, len);
     if (len > 0)
-        WriteRaw(s.data(), len);
+        WriteRaw(out, s.data(), len);
 }
 
-static void WriteMaterialTexTransform(const MaterialTexTransform& t)
+static void WriteMaterialTexTransform(BinaryWriter& out, const MaterialTexTransform& t)
 {
-    WriteFloatArray(t.scale, 2);
-    WriteFloatArray(t.offset, 2);
-    WriteRaw(t.wrapMode, sizeof(uint32_t) * 2);
+    WriteFloatArray(out, t.scale, 2);
+    WriteFloatArray(out, t.offset, 2);
+    WriteRaw(out, t.wrapMode, sizeof(uint32_t) * 2);
 }
 
-static void WriteMaterialSection()
+static void WriteMaterialSection(BinaryWriter& out, const SkinnedExportContext& ctx)
 {
-    for (auto& m : g_Materials)
+    for (auto& m : ctx.materials)
     {
-        WriteStringUtf8(m.name);
-        WriteStringUtf8(m.diffuseTextureName);
-        WriteStringUtf8(m.normalTextureName);
-        WriteStringUtf8(m.emissiveTextureName);
-        WriteStringUtf8(m.specularTextureName);
-
-        WriteFloatArray(m.diffuseColor, 4);
-        WriteFloatArray(m.emissiveColor, 4);
-        WriteFloatArray(m.specularColor, 4);
-
-        WriteMaterialTexTransform(m.diffuseTransform);
-        WriteMaterialTexTransform(m.normalTransform);
-        WriteMaterialTexTransform(m.emissiveTransform);
-        WriteMaterialTexTransform(m.specularTransform);
+        WriteStringUtf8(out, m.name);
+        WriteStringUtf8(out, m.diffuseTextureName);
+        WriteStringUtf8(out, m.normalTextureName);
+        WriteStringUtf8(out, m.emissiveTextureName);
+        WriteStringUtf8(out, m.specularTextureName);
+
+        WriteFloatArray(out, m.diffuseColor, 4);
+        WriteFloatArray(out, m.emissiveColor, 4);
+        WriteFloatArray(out, m.specularColor, 4);
+
+        WriteMaterialTexTransform(out, m.diffuseTransform);
+        WriteMaterialTexTransform(out, m.normalTransform);
+        WriteMaterialTexTransform(out, m.emissiveTransform);
+        WriteMaterialTexTransform(out, m.specularTransform);
     }
 }
 
 // ==========================================================
 // 1)   
 // ==========================================================
-static void WriteModelHeader()
+static uint32_t MakeModelHeaderFlags(bool quantized)
 {
-    char magic[4] = { 'M', 'B', 'I', 'N' };
-    WriteRaw(magic, 4);
-
-    uint32_t version = 3;
     uint32_t flags = 0;
-    uint32_t boneCount = (uint32_t)g_Bones.size();
-    uint32_t materialCount = (uint32_t)g_Materials.size();
-    uint32_t subCount = (uint32_t)g_SubMeshes.size();
-
-    WriteUInt32(version);
-    WriteUInt32(flags);
-    WriteUInt32(boneCount);
-    WriteUInt32(materialCount);
-    WriteUInt32(subCount);
+    if (quantized)
+        flags |= MBIN_FLAG_QUANTIZED_VERTEX | (QUANTIZE_POSITION_HALF ? MBIN_FLAG_POSITION_HALF : 0u);
+    if (COMPRESS_STREAMS)
+        flags |= MBIN_FLAG_COMPRESSED_STREAMS;
+    if (WRITE_SECTIONED_LAYOUT && WRITE_INDEX16)
+        flags |= MBIN_FLAG_INDEX16;
+    return flags;
+}
+
+static void WriteModelHeader(BinaryWriter& out, const SkinnedExportContext& ctx, bool quantized)
+{
+    char magic[4] = { 'M', 'B', 'I', 'N' };
+    WriteRaw(out, magic, 4);
+
+    uint32_t version = quantized ? kMbinQuantizedVersion : 3;
+    uint32_t flags = MakeModelHeaderFlags(quantized);
+    uint32_t boneCount = (uint32_t)ctx.bones.size();
+    uint32_t materialCount = (uint32_t)ctx.materials.size();
+    uint32_t subCount = (uint32_t)ctx.subMeshes.size();
+
+    WriteUInt32(out, version);
+    WriteUInt32(out, flags);
+    WriteUInt32(out, boneCount);
+    WriteUInt32(out, materialCount);
+    WriteUInt32(out, subCount);
 }
 
 // ==========================================================
 // 2) Skeleton  
 // ==========================================================
-static void WriteSkeletonSection()
+static void WriteSkeletonSection(BinaryWriter& out, const SkinnedExportContext& ctx)
 {
-    for (auto& b : g_Bones)
+    for (auto& b : ctx.bones)
     {
-        WriteStringUtf8(b.name);
-        WriteInt32(b.parentIndex);
-        WriteFloatArray(b.bindLocal, 16);
-        WriteFloatArray(b.offsetMatrix, 16);
+        WriteStringUtf8(out, b.name);
+        WriteInt32(out, b.parentIndex);
+        WriteFloatArray(out, b.bindLocal, 16);
+        WriteFloatArray(out, b.offsetMatrix, 16);
     }
 }
 
 // ==========================================================
 // 3) SubMesh  
 // ==========================================================
-static void WriteSubMeshSection()
+static void WriteSubMeshSection(
+    BinaryWriter& out,
+    const SkinnedExportContext& ctx,
+    bool quantized,
+    MbinStreamDecodeBenchmark* decodeBench)
 {
-    for (auto& sm : g_SubMeshes)
+    std::vector<MbinQuantizedVertex> quantizedVertices;
+    std::vector<uint8_t> encoded;
+
+    for (auto& sm : ctx.subMeshes)
     {
-        WriteStringUtf8(sm.meshName);
-        WriteUInt32(sm.materialIndex);
+        WriteStringUtf8(out, sm.meshName);
+        WriteUInt32(out, sm.materialIndex);
 
         uint32_t vtxCount = (uint32_t)sm.vertices.size();
         uint32_t idxCount = (uint32_t)sm.indices.size();
-        WriteUInt32(vtxCount);
-        WriteUInt32(idxCount);
-
-        for (const Vertex& v : sm.vertices)
-        {
-            WriteFloatArray(v.position, 3);
-            WriteFloatArray(v.normal, 3);
-            WriteFloatArray(v.uv, 2);
-            WriteFloatArray(v.tangent, 4);
-            WriteRaw(v.boneIndices, sizeof(uint32_t) * 4);
-            WriteFloatArray(v.boneWeights, 4);
-        }
+        WriteUInt32(out, vtxCount);
+        WriteUInt32(out, idxCount);
 
-        if (idxCount > 0)
-            WriteRaw(sm.indices.data(), sizeof(uint32_t) * idxCount);
-    }
-}
+        // Vertex ü ġ =  ġ (position, normal, uv, tangent, boneIndices, boneWeights)
+        static_assert(sizeof(Vertex) == sizeof(float) * 16 + sizeof(uint32_t) * 4, "Vertex must be tightly packed");
+        const void* vertexData = sm.vertices.data();
+        size_t vertexSize = sizeof(Vertex);
 
-// ==========================================================
-// BIN   Լ
-// ==========================================================
-static bool SaveModelBin(const std::string& filename)
-{
-    g_out.open(filename, ios::binary);
-    if (!g_out.is_open()) return false;
-
-    WriteModelHeader();
-    WriteSkeletonSection();
-    WriteMaterialSection();
-    WriteSubMeshSection();
+        if (quantized)
+        {
+            // v6:  Ķ(float 10) + 32Ʈ 
+            MbinQuantizeParams params{};
+            QuantizeMbinVertices(sm.vertices, QUANTIZE_POSITION_HALF, quantizedVertices, params);
+            WriteRaw(out, &params, sizeof(params));
 
-    g_out.close();
-    return true;
-}
-static std::string ExtractFirstTextureStem(FbxProperty prop)
-{
-    if (!prop.IsValid()) return "";
+            vertexData = quantizedVertices.data();
+            vertexSize = sizeof(MbinQuantizedVertex);
+        }
 
-    // LayeredTexture ( 0)
-    if (prop.GetSrcObjectCount<FbxLayeredTexture>() > 0)
-    {
-        auto* layered = prop.GetSrcObject<FbxLayeredTexture>(0);
-        if (layered && layered->GetSrcObjectCount<FbxTexture>() > 0)
+        if (COMPRESS_STREAMS)
         {
-            auto* tex = FbxCast<FbxFileTexture>(layered->GetSrcObject<FbxTexture>(0));
-            if (tex) return SafeStemFromFbxFileName(tex->GetFileName());
+            EncodeMbinVertexStream(vertexData, vtxCount, vertexSize, encoded);
+            if (decodeBench) decodeBench->AddVertexStream(encoded, vertexData, vtxCount, vertexSize);
+            WriteUInt32(out, (uint32_t)encoded.size());
+            WriteRaw(out, encoded.data(), encoded.size());
+
+            EncodeMbinIndexStream(sm.indices.data(), idxCount, vtxCount, encoded);
+            if (decodeBench) decodeBench->AddIndexStream(encoded, sm.indices.data(), idxCount);
+            WriteUInt32(out, (uint32_t)encoded.size());
+            WriteRaw(out, encoded.data(), encoded.size());
         }
-        return "";
-    }
+        else
+        {
+            if (vtxCount > 0)
+                WriteRaw(out, vertexData, vertexSize * vtxCount);
 
-    // Ϲ ؽó
-    if (prop.GetSrcObjectCount<FbxTexture>() > 0)
-    {
-        auto* tex = FbxCast<FbxFileTexture>(prop.GetSrcObject<FbxTexture>(0));
-        if (tex) return SafeStemFromFbxFileName(tex->GetFileName());
+            if (idxCount > 0)
+                WriteRaw(out, sm.indices.data(), sizeof(uint32_t) * idxCount);
+        }
     }
-    return "";
 }
 
-static FbxTexture* ExtractFirstTextureObject(FbxProperty prop)
-{
-    if (!prop.IsValid()) return nullptr;
-
-    if (prop.GetSrcObjectCount<FbxLayeredTexture>() > 0)
-    {
-        auto* layered = prop.GetSrcObject<FbxLayeredTexture>(0);
-        if (layered && layered->GetSrcObjectCount<FbxTexture>() > 0)
-            return layered->GetSrcObject<FbxTexture>(0);
-        return nullptr;
-    }
-
-    if (prop.GetSrcObjectCount<FbxTexture>() > 0)
-        return prop.GetSrcObject<FbxTexture>(0);
-
-    return nullptr;
-}
-
-static const char* WrapModeToString(FbxTexture::EWrapMode mode)
+// ==========================================================
+// BIN    ( BinaryWriter.h I/O )
+// ==========================================================
+static size_t EstimateModelBinBytes(const SkinnedExportContext& ctx)
 {
-    switch (mode)
+    size_t bytes = 64 + ctx.materials.size() * 512;
+    for (const auto& b : ctx.bones)
+        bytes += 2 + b.name.size() + sizeof(int32_t) + sizeof(float) * 32;
+    for (const auto& sm : ctx.subMeshes)
     {
-    case FbxTexture::eRepeat: return "Repeat";
-    case FbxTexture::eClamp:  return "Clamp";
-    default:                  return "Unknown";
+        bytes += 64 + sm.meshName.size();
+        bytes += sm.vertices.size() * sizeof(Vertex);
+        bytes += sm.indices.size() * sizeof(uint32_t);
     }
+    return bytes;
 }
 
-static const char* MaterialClassToString(FbxSurfaceMaterial* mat)
+// v7  ġ (WRITE_SECTIONED_LAYOUT)
+static BinaryWriter BuildSectionedModelBin(
+    const SkinnedExportContext& ctx,
+    bool quantized,
+    MbinStreamDecodeBenchmark* decodeBench)
 {
-    if (!mat) return "null";
-    if (FbxCast<FbxSurfacePhong>(mat))   return "Phong";
-    if (FbxCast<FbxSurfaceLambert>(mat)) return "Lambert";
-    return "Other";
-}
+    MbinSectionedBuilder builder;
 
-static void DumpDouble3Value(const char* label, const FbxDouble3& v)
-{
-    DLOG("  ");
-    DLOG(label);
-    DLOG(" = (");
-    DLOG(v[0]); DLOG(", ");
-    DLOG(v[1]); DLOG(", ");
-    DLOG(v[2]); DLOGLN(")");
-}
+    for (const auto& b : ctx.bones)
+        builder.AddBone(MakeMbinBoneRecord(builder, b));
 
-static void DumpDoubleValue(const char* label, double v)
-{
-    DLOG("  ");
-    DLOG(label);
-    DLOG(" = ");
-    DLOGLN(v);
-}
+    for (const auto& m : ctx.materials)
+        builder.AddMaterial(MakeMbinMaterialRecord(builder, m));
 
-static void DumpTextureSlotDebug(const char* slotName, FbxProperty prop)
-{
-    DLOG("  [TextureSlot] ");
-    DLOG(slotName);
-
-    if (!prop.IsValid())
+    for (const auto& sm : ctx.subMeshes)
     {
-        DLOGLN(" : property invalid");
-        return;
-    }
-
-    const bool hasLayered = (prop.GetSrcObjectCount<FbxLayeredTexture>() > 0);
-    FbxTexture* tex = ExtractFirstTextureObject(prop);
+        MbinSubMeshRecord record = MakeMbinSubMeshRecord();
+        record.name = builder.InternString(sm.meshName);
+        record.materialIndex = sm.materialIndex;
 
-    if (!tex)
-    {
-        DLOG(" : connected=0");
-        DLOG(" layered="); DLOG(hasLayered ? 1 : 0);
-        DLOGLN("");
-        return;
+        AddMbinSubMeshStreams(builder, record, sm.vertices, sm.indices,
+            quantized, QUANTIZE_POSITION_HALF, COMPRESS_STREAMS, WRITE_INDEX16, decodeBench);
     }
 
-    auto* fileTex = FbxCast<FbxFileTexture>(tex);
-
-    DLOG(" : connected=1");
-    DLOG(" layered="); DLOG(hasLayered ? 1 : 0);
-    DLOG(" type=\""); DLOG(fileTex ? "FileTexture" : "Texture"); DLOG("\"");
-
-    DLOG(" scale=(");
-    DLOG(tex->GetScaleU()); DLOG(", ");
-    DLOG(tex->GetScaleV()); DLOG(")");
-
-    DLOG(" trans=(");
-    DLOG(tex->GetTranslationU()); DLOG(", ");
-    DLOG(tex->GetTranslationV()); DLOG(")");
-
-    DLOG(" wrap=(");
-    DLOG(WrapModeToString(tex->GetWrapModeU())); DLOG(", ");
-    DLOG(WrapModeToString(tex->GetWrapModeV())); DLOG(")");
-
-    if (fileTex)
-    {
-        const char* fileName = fileTex->GetFileName();
-        DLOG(" file=\""); DLOG(fileName ? fileName : ""); DLOG("\"");
-        DLOG(" stem=\""); DLOG(SafeStemFromFbxFileName(fileName)); DLOG("\"");
-    }
-
-    DLOGLN("");
+    return builder.Build(MakeModelHeaderFlags(quantized));
 }
 
-static void DumpMaterialDebug(FbxSurfaceMaterial* mat)
+static BinaryWriter BuildModelBin(const SkinnedExportContext& ctx, MbinStreamDecodeBenchmark* decodeBench)
 {
-    if (!mat)
-    {
-        DLOGLN("[MaterialDump] null");
-        return;
-    }
-
-    DLOGLN("\n--------------------------------------------------");
-    DLOG("[MaterialDump] name=\""); DLOG(mat->GetName()); DLOG("\" ");
-    DLOG("class=\""); DLOG(MaterialClassToString(mat)); DLOGLN("\"");
-
-    if (auto* lambert = FbxCast<FbxSurfaceLambert>(mat))
+    bool quantized = QUANTIZE_VERTICES;
+    if (quantized && ctx.bones.size() > 256)
     {
-        DumpDouble3Value("Lambert.Ambient", lambert->Ambient.Get());
-        DumpDoubleValue("Lambert.AmbientFactor", lambert->AmbientFactor.Get());
-
-        DumpDouble3Value("Lambert.Diffuse", lambert->Diffuse.Get());
-        DumpDoubleValue("Lambert.DiffuseFactor", lambert->DiffuseFactor.Get());
-
-        DumpDouble3Value("Lambert.Emissive", lambert->Emissive.Get());
-        DumpDoubleValue("Lambert.EmissiveFactor", lambert->EmissiveFactor.Get());
-
-        DumpDouble3Value("Lambert.TransparentColor", lambert->TransparentColor.Get());
-        DumpDoubleValue("Lambert.TransparencyFactor", lambert->TransparencyFactor.Get());
+        BatchLog() << " " << ctx.bones.size() << ": uint8  ε  ʰ, ȭ  \n";
+        quantized = false;
     }
 
-    if (auto* phong = FbxCast<FbxSurfacePhong>(mat))
-    {
-        DumpDouble3Value("Phong.Specular", phong->Specular.Get());
-        DumpDoubleValue("Phong.SpecularFactor", phong->SpecularFactor.Get());
-        DumpDoubleValue("Phong.Shininess", phong->Shininess.Get());
-        DumpDouble3Value("Phong.Reflection", phong->Reflection.Get());
-        DumpDoubleValue("Phong.ReflectionFactor", phong->ReflectionFactor.Get());
-    }
+    if (WRITE_SECTIONED_LAYOUT)
+        return BuildSectionedModelBin(ctx, quantized, decodeBench);
 
-    DumpTextureSlotDebug("Diffuse", mat->FindProperty(FbxSurfaceMaterial::sDiffuse));
-    DumpTextureSlotDebug("NormalMap", mat->FindProperty(FbxSurfaceMaterial::sNormalMap));
-    DumpTextureSlotDebug("Bump", mat->FindProperty(FbxSurfaceMaterial::sBump));
-    DumpTextureSlotDebug("Emissive", mat->FindProperty(FbxSurfaceMaterial::sEmissive));
-    DumpTextureSlotDebug("Specular", mat->FindProperty(FbxSurfaceMaterial::sSpecular));
-}
+    BinaryWriter out;
+    out.Reserve(EstimateModelBinBytes(ctx));
 
-static uint32_t EncodeWrapMode(FbxTexture::EWrapMode mode)
-{
-    return (mode == FbxTexture::eClamp) ? 1u : 0u;
-}
+    WriteModelHeader(out, ctx, quantized);
+    WriteSkeletonSection(out, ctx);
+    WriteMaterialSection(out, ctx);
+    WriteSubMeshSection(out, ctx, quantized, decodeBench);
 
-static void FillColor4(float out[4], double x, double y, double z, double w)
-{
-    out[0] = (float)x;
-    out[1] = (float)y;
-    out[2] = (float)z;
-    out[3] = (float)w;
-}
-
-static void FillTexTransformFromProperty(FbxProperty prop, MaterialTexTransform& outTransform)
-{
-    outTransform = MaterialTexTransform{};
-
-    FbxTexture* tex = ExtractFirstTextureObject(prop);
-    if (!tex) return;
-
-    outTransform.scale[0] = (float)tex->GetScaleU();
-    outTransform.scale[1] = (float)tex->GetScaleV();
-    outTransform.offset[0] = (float)tex->GetTranslationU();
-    outTransform.offset[1] = (float)tex->GetTranslationV();
-    outTransform.wrapMode[0] = EncodeWrapMode(tex->GetWrapModeU());
-    outTransform.wrapMode[1] = EncodeWrapMode(tex->GetWrapModeV());
-}
-
-static bool IsNearlyBlack3(const float c[4], float eps = 1e-6f)
-{
-    return
-        (fabsf(c[0]) <= eps) &&
-        (fabsf(c[1]) <= eps) &&
-        (fabsf(c[2]) <= eps);
-}
-
-static bool IsIdentityTexTransform(const MaterialTexTransform& t, float eps = 1e-6f)
-{
-    return
-        (fabsf(t.scale[0] - 1.0f) <= eps) &&
-        (fabsf(t.scale[1] - 1.0f) <= eps) &&
-        (fabsf(t.offset[0]) <= eps) &&
-        (fabsf(t.offset[1]) <= eps) &&
-        (t.wrapMode[0] == 0u) &&
-        (t.wrapMode[1] == 0u);
-}
-
-static void ExtractMaterialAttributes(FbxSurfaceMaterial* mat, Material& outMat)
-{
-    if (!mat) return;
-
-    FbxProperty diffuseProp = mat->FindProperty(FbxSurfaceMaterial::sDiffuse);
-    FbxProperty normalProp = mat->FindProperty(FbxSurfaceMaterial::sNormalMap);
-    FbxProperty bumpProp = mat->FindProperty(FbxSurfaceMaterial::sBump);
-    FbxProperty emissiveProp = mat->FindProperty(FbxSurfaceMaterial::sEmissive);
-    FbxProperty specularProp = mat->FindProperty(FbxSurfaceMaterial::sSpecular);
-
-    outMat.diffuseTextureName = ExtractFirstTextureStem(diffuseProp);
-    outMat.normalTextureName = ExtractFirstTextureStem(normalProp);
-    outMat.emissiveTextureName = ExtractFirstTextureStem(emissiveProp);
-    outMat.specularTextureName = ExtractFirstTextureStem(specularProp);
-
-    FillTexTransformFromProperty(diffuseProp, outMat.diffuseTransform);
-
-    if (outMat.normalTextureName.empty())
-    {
-        outMat.normalTextureName = ExtractFirstTextureStem(bumpProp);
-        FillTexTransformFromProperty(bumpProp, outMat.normalTransform);
-    }
-    else
-    {
-        FillTexTransformFromProperty(normalProp, outMat.normalTransform);
-    }
-
-    FillTexTransformFromProperty(emissiveProp, outMat.emissiveTransform);
-    FillTexTransformFromProperty(specularProp, outMat.specularTransform);
-
-    if (auto* lambert = FbxCast<FbxSurfaceLambert>(mat))
-    {
-        const FbxDouble3 d = lambert->Diffuse.Get();
-        const double df = lambert->DiffuseFactor.Get();
-        FillColor4(outMat.diffuseColor, d[0] * df, d[1] * df, d[2] * df, 1.0);
-
-        const FbxDouble3 e = lambert->Emissive.Get();
-        const double ef = lambert->EmissiveFactor.Get();
-        FillColor4(outMat.emissiveColor, e[0] * ef, e[1] * ef, e[2] * ef, 1.0);
-    }
-
-    if (auto* phong = FbxCast<FbxSurfacePhong>(mat))
-    {
-        const FbxDouble3 s = phong->Specular.Get();
-        const double sf = phong->SpecularFactor.Get();
-        const double shininess = phong->Shininess.Get();
-        FillColor4(outMat.specularColor, s[0] * sf, s[1] * sf, s[2] * sf, shininess);
-    }
-
-    if (!outMat.normalTextureName.empty() &&
-        IsIdentityTexTransform(outMat.normalTransform) &&
-        !IsIdentityTexTransform(outMat.diffuseTransform))
-    {
-        outMat.normalTransform = outMat.diffuseTransform;
-    }
-
-    if (!outMat.emissiveTextureName.empty() &&
-        IsIdentityTexTransform(outMat.emissiveTransform) &&
-        !IsIdentityTexTransform(outMat.diffuseTransform))
-    {
-        outMat.emissiveTransform = outMat.diffuseTransform;
-    }
-
-    if (!outMat.specularTextureName.empty() &&
-        IsIdentityTexTransform(outMat.specularTransform) &&
-        !IsIdentityTexTransform(outMat.diffuseTransform))
-    {
-        outMat.specularTransform = outMat.diffuseTransform;
-    }
-
-    if (!outMat.emissiveTextureName.empty() && IsNearlyBlack3(outMat.emissiveColor))
-    {
-        FillColor4(outMat.emissiveColor, 1.0, 1.0, 1.0, 1.0);
-    }
-
-    if (!outMat.specularTextureName.empty())
-    {
-        if (IsNearlyBlack3(outMat.specularColor))
-        {
-            outMat.specularColor[0] = 1.0f;
-            outMat.specularColor[1] = 1.0f;
-            outMat.specularColor[2] = 1.0f;
-        }
-
-        if (outMat.specularColor[3] <= 0.0f)
-        {
-            outMat.specularColor[3] = 32.0f;
-        }
-    }
-}
-
-static int GetPolygonMaterialSlot(FbxNode* node, FbxMesh* mesh, int polygonIndex)
-{
-    if (!node || !mesh) return 0;
-
-    const int nodeMaterialCount = node->GetMaterialCount();
-    if (nodeMaterialCount <= 1) return 0;
-
-    FbxGeometryElementMaterial* matElem = mesh->GetElementMaterial();
-    if (!matElem) return 0;
-
-    int localMaterialSlot = 0;
-
-    if (matElem->GetMappingMode() == FbxGeometryElement::eByPolygon)
-    {
-        if (polygonIndex >= 0 && polygonIndex < matElem->GetIndexArray().GetCount())
-            localMaterialSlot = matElem->GetIndexArray().GetAt(polygonIndex);
-    }
-    else if (matElem->GetMappingMode() == FbxGeometryElement::eAllSame)
-    {
-        if (matElem->GetIndexArray().GetCount() > 0)
-            localMaterialSlot = matElem->GetIndexArray().GetAt(0);
-    }
-    else
-    {
-        localMaterialSlot = 0;
-    }
-
-    if (localMaterialSlot < 0 || localMaterialSlot >= nodeMaterialCount)
-        localMaterialSlot = 0;
-
-    return localMaterialSlot;
+    return out;
 }
 static void ComputeTangentForTri(Vertex& a, Vertex& b, Vertex& c)
 {
@@ -721,7 +479,11 @@ static void ComputeTangentForTri(Vertex& a, Vertex& b, Vertex& c)
 // ==========================================================
 // Ų ġ ä
 // ==========================================================
-static void FillSkinWeights(FbxMesh* mesh, SubMesh& sm, const std::vector<int>& vtxCpIndex)
+static void FillSkinWeights(
+    FbxMesh* mesh,
+    SubMesh& sm,
+    const std::vector<int>& vtxCpIndex,
+    const unordered_map<string, int>& boneNameToIndex)
 {
     int cpCount = mesh->GetControlPointsCount();
 
@@ -741,8 +503,8 @@ static void FillSkinWeights(FbxMesh* mesh, SubMesh& sm, const std::vector<int>&
             if (!cluster) continue;
 
             string boneName = cluster->GetLink() ? cluster->GetLink()->GetName() : "";
-            auto it = g_BoneNameToIndex.find(boneName);
-            if (it == g_BoneNameToIndex.end()) continue;
+            auto it = boneNameToIndex.find(boneName);
+            if (it == boneNameToIndex.end()) continue;
 
             int boneIndex = it->second;
 
@@ -853,22 +615,14 @@ static int Bool01(bool v) { return v ? 1 : 0; }
 // - Ų ޽ø SubMesh 
 // - Ų ũ/   
 // ==========================================================
-static void ExtractFromFBX(FbxScene* scene)
+static void ExtractFromFBX(FbxScene* scene, SkinnedExportContext& ctx)
 {
-    g_Bones.clear();
-    g_SubMeshes.clear();
-    g_BoneNameToIndex.clear();
-    g_BoneNameToNode.clear();
+    ctx.bones.clear();
+    ctx.subMeshes.clear();
+    ctx.boneNameToIndex.clear();
+    ctx.boneNameToNode.clear();
 
-    // 1) DirectX ǥ + meter 
-    FbxAxisSystem::DirectX.ConvertScene(scene);
-    FbxSystemUnit::m.ConvertScene(scene);
-
-    // 2) Triangulate
-    {
-        FbxGeometryConverter conv(scene->GetFbxManager());
-        conv.Triangulate(scene, true);
-    }
+    // 1~2) DirectX ǥ + meter , Triangulate Ʈ Ŀ  
 
     // 3)  "Ų ޽" 
     struct MeshRef { FbxNode* node; FbxMesh* mesh; };
@@ -916,10 +670,10 @@ static void ExtractFromFBX(FbxScene* scene)
                     b.offsetMatrix[i] = (i % 5 == 0) ? 1.0f : 0.0f;
                 }
 
-                myIdx = (int)g_Bones.size();
-                g_BoneNameToIndex[b.name] = myIdx;
-                g_BoneNameToNode[b.name] = node;
-                g_Bones.push_back(b);
+                myIdx = (int)ctx.bones.size();
+                ctx.boneNameToIndex[b.name] = myIdx;
+                ctx.boneNameToNode[b.name] = node;
+                ctx.bones.push_back(b);
             }
 
             for (int i = 0; i < node->GetChildCount(); ++i)
@@ -927,7 +681,7 @@ static void ExtractFromFBX(FbxScene* scene)
         };
     ExtractBones(scene->GetRootNode(), -1);
 
-    const int boneCount = (int)g_Bones.size();
+    const int boneCount = (int)ctx.bones.size();
 
     // 5) base mesh  (  control points)
     int baseMeshIndex = 0;
@@ -964,8 +718,8 @@ static void ExtractFromFBX(FbxScene* scene)
 
     for (int i = 0; i < boneCount; ++i)
     {
-        auto itN = g_BoneNameToNode.find(g_Bones[i].name);
-        FbxNode* boneNode = (itN != g_BoneNameToNode.end()) ? itN->second : nullptr;
+        auto itN = ctx.boneNameToNode.find(ctx.bones[i].name);
+        FbxNode* boneNode = (itN != ctx.boneNameToNode.end()) ? itN->second : nullptr;
 
         if (!boneNode)
         {
@@ -1003,7 +757,7 @@ static void ExtractFromFBX(FbxScene* scene)
             boneHasBind[i] = true;
         }
 
-        int p = g_Bones[i].parentIndex;
+        int p = ctx.bones[i].parentIndex;
 
         FbxAMatrix parentM;
         if (p >= 0 && boneHasBind[p]) parentM = boneGlobalBind[p];
@@ -1013,7 +767,7 @@ static void ExtractFromFBX(FbxScene* scene)
 
         for (int r = 0; r < 4; ++r)
             for (int c = 0; c < 4; ++c)
-                g_Bones[i].bindLocal[r * 4 + c] = (float)local.Get(r, c);
+                ctx.bones[i].bindLocal[r * 4 + c] = (float)local.Get(r, c);
     }
 
     // 8) offsetMatrix 
@@ -1023,49 +777,19 @@ static void ExtractFromFBX(FbxScene* scene)
 
         for (int r = 0; r < 4; ++r)
             for (int c = 0; c < 4; ++c)
-                g_Bones[i].offsetMatrix[r * 4 + c] = (float)off.Get(r, c);
+                ctx.bones[i].offsetMatrix[r * 4 + c] = (float)off.Get(r, c);
     }
 
     // 9) Material + Diffuse Texture  (ü 忡 ص )
-    g_Materials.clear();
-    g_MaterialNameToIndex.clear();
-
-    function<void(FbxNode*)> CollectMaterials = [&](FbxNode* node)
-        {
-            if (!node) return;
-
-            int matCount = node->GetMaterialCount();
-            for (int i = 0; i < matCount; ++i)
-            {
-                FbxSurfaceMaterial* mat = node->GetMaterial(i);
-                if (!mat) continue;
-
-                string matName = mat->GetName();
-                if (g_MaterialNameToIndex.count(matName))
-                    continue;
-
-                Material m{};
-                m.name = matName;
-                ExtractMaterialAttributes(mat, m);
+    ctx.materials.clear();
+    ctx.materialNameToIndex.clear();
 
-#if DEBUGLOG
-                DumpMaterialDebug(mat);
-#endif
-
-                uint32_t idx = (uint32_t)g_Materials.size();
-                g_Materials.push_back(m);
-                g_MaterialNameToIndex[matName] = idx;
-            }
-
-            for (int i = 0; i < node->GetChildCount(); ++i)
-                CollectMaterials(node->GetChild(i));
-        };
-    CollectMaterials(scene->GetRootNode());
+    CollectSceneMaterials(scene->GetRootNode(), ctx.materials, ctx.materialNameToIndex, DEBUGLOG != 0);
 #if DEBUGLOG
     DLOGLN("\n[Material List]");
-    for (size_t i = 0; i < g_Materials.size(); ++i)
+    for (size_t i = 0; i < ctx.materials.size(); ++i)
     {
-        const auto& m = g_Materials[i];
+        const auto& m = ctx.materials[i];
         DLOG("  ["); DLOG(i); DLOG("] ");
         DLOG("name=\""); DLOG(m.name); DLOG("\" ");
         DLOG(" diffuse=\""); DLOG(m.diffuseTextureName); DLOG("\"");
@@ -1085,7 +809,6 @@ static void ExtractFromFBX(FbxScene* scene)
 
         std::vector<SubMesh> splitSubMeshes(nodeMaterialCount);
         std::vector<std::vector<int>> splitVtxCpIndex(nodeMaterialCount);
-        std::vector<bool> splitSubMeshUsed(nodeMaterialCount, false);
 
         for (int matSlot = 0; matSlot < nodeMaterialCount; ++matSlot)
         {
@@ -1096,8 +819,8 @@ static void ExtractFromFBX(FbxScene* scene)
                 FbxSurfaceMaterial* mat = node->GetMaterial(matSlot);
                 if (mat)
                 {
-                    auto it = g_MaterialNameToIndex.find(mat->GetName());
-                    if (it != g_MaterialNameToIndex.end())
+                    auto it = ctx.materialNameToIndex.find(mat->GetName());
+                    if (it != ctx.materialNameToIndex.end())
                         globalMaterialIndex = it->second;
                 }
             }
@@ -1106,8 +829,6 @@ static void ExtractFromFBX(FbxScene* scene)
             splitSubMeshes[matSlot].materialIndex = globalMaterialIndex;
         }
 
-        int polyCount = mesh->GetPolygonCount();
-        int cpCount = mesh->GetControlPointsCount();
         FbxVector4* cp = mesh->GetControlPoints();
 
         // UV Ʈ
@@ -1144,38 +865,23 @@ static void ExtractFromFBX(FbxScene* scene)
 
         bool flipWinding = (Det3x3Local(meshG * geo) < 0.0) ^ MIRROR_X_EXPORT;
 
-        for (int matSlot = 0; matSlot < nodeMaterialCount; ++matSlot)
-        {
-            splitSubMeshes[matSlot].vertices.reserve(polyCount * 3);
-            splitSubMeshes[matSlot].indices.reserve(polyCount * 3);
-            splitVtxCpIndex[matSlot].reserve(polyCount * 3);
-        }
-
-        for (int p = 0; p < polyCount; ++p)
-        {
-            int localMaterialSlot = GetPolygonMaterialSlot(node, mesh, p);
-            if (localMaterialSlot < 0 || localMaterialSlot >= nodeMaterialCount)
-                localMaterialSlot = 0;
-
-            SubMesh& sm = splitSubMeshes[localMaterialSlot];
-            std::vector<int>& vtxCpIndex = splitVtxCpIndex[localMaterialSlot];
-            splitSubMeshUsed[localMaterialSlot] = true;
-
-            Vertex triV[3]{};
-            int triCp[3]{ -1, -1, -1 };
+        //   ߺ  (slot ε +   , ũ Ȯ)
+        //  ġ control point  Ű control point  
+        std::vector<FbxDedupedSlot> dedupedSlots;
+        DedupPolygonVertices(node, mesh, nodeMaterialCount, uvSetName, dedupedSlots);
 
-            for (int k = 0; k < 3; ++k)
+        auto EvaluateVertex = [&](int p, int k, int cpIdx) -> Vertex
             {
-                int cpIdx = mesh->GetPolygonVertex(p, k);
-                triCp[k] = cpIdx;
+                Vertex v{};
+                if (cpIdx < 0) return v;
 
                 // position (base  ȯ)
                 FbxVector4 p4 = toBase.MultT(cp[cpIdx]);
                 p4 = R.MultT(p4);
                 if (MIRROR_X_EXPORT) p4[0] = -p4[0];
-                triV[k].position[0] = (float)p4[0] * EXPORT_SCALE_F;
-                triV[k].position[1] = (float)p4[1] * EXPORT_SCALE_F;
-                triV[k].position[2] = (float)p4[2] * EXPORT_SCALE_F;
+                v.position[0] = (float)p4[0] * EXPORT_SCALE_F;
+                v.position[1] = (float)p4[1] * EXPORT_SCALE_F;
+                v.position[2] = (float)p4[2] * EXPORT_SCALE_F;
 
                 // normal
                 FbxVector4 nL;
@@ -1186,9 +892,9 @@ static void ExtractFromFBX(FbxScene* scene)
                 if (MIRROR_X_EXPORT) nW[0] = -nW[0];
 
                 nW.Normalize();
-                triV[k].normal[0] = (float)nW[0];
-                triV[k].normal[1] = (float)nW[1];
-                triV[k].normal[2] = (float)nW[2];
+                v.normal[0] = (float)nW[0];
+                v.normal[1] = (float)nW[1];
+                v.normal[2] = (float)nW[2];
 
                 // UV
                 if (hasUVSet)
@@ -1197,48 +903,58 @@ static void ExtractFromFBX(FbxScene* scene)
                     bool unmapped = false;
                     if (mesh->GetPolygonVertexUV(p, k, uvSetName, uv, unmapped))
                     {
-                        triV[k].uv[0] = (float)uv[0];
-                        triV[k].uv[1] = 1.0f - (float)uv[1];
-                    }
-                    else
-                    {
-                        triV[k].uv[0] = 0.0f;
-                        triV[k].uv[1] = 0.0f;
+                        v.uv[0] = (float)uv[0];
+                        v.uv[1] = 1.0f - (float)uv[1];
                     }
                 }
-                else
-                {
-                    triV[k].uv[0] = 0.0f;
-                    triV[k].uv[1] = 0.0f;
-                }
-            }
 
-            if (!flipWinding)
-                ComputeTangentForTri(triV[0], triV[1], triV[2]);
-            else
-                ComputeTangentForTri(triV[0], triV[2], triV[1]);
+                return v;
+            };
 
-            uint32_t base = (uint32_t)sm.vertices.size();
+        for (int matSlot = 0; matSlot < nodeMaterialCount; ++matSlot)
+        {
+            const FbxDedupedSlot& ds = dedupedSlots[matSlot];
+            if (ds.vertices.empty()) continue;
 
-            sm.vertices.push_back(triV[0]);
-            sm.vertices.push_back(triV[1]);
-            sm.vertices.push_back(triV[2]);
+            SubMesh& sm = splitSubMeshes[matSlot];
+            sm.vertices.resize(ds.vertices.size());
+            sm.indices.resize(ds.indices.size());
 
-            vtxCpIndex.push_back(triCp[0]);
-            vtxCpIndex.push_back(triCp[1]);
-            vtxCpIndex.push_back(triCp[2]);
+            std::vector<int>& vtxCpIndex = splitVtxCpIndex[matSlot];
+            vtxCpIndex.resize(ds.vertices.size());
+            for (size_t v = 0; v < ds.vertices.size(); ++v)
+                vtxCpIndex[v] = ds.vertices[v].controlPoint;
 
-            if (!flipWinding)
-            {
-                sm.indices.push_back(base + 0);
-                sm.indices.push_back(base + 1);
-                sm.indices.push_back(base + 2);
-            }
-            else
+            // ȣ emitted ̸̻  ﰢ ó   (źƮ  ﰢ )
+            uint32_t emitted = 0;
+
+            for (size_t t = 0; t < ds.triangles.size(); ++t)
             {
-                sm.indices.push_back(base + 0);
-                sm.indices.push_back(base + 2);
-                sm.indices.push_back(base + 1);
+                const int p = ds.triangles[t];
+                const uint32_t* triIdx = &ds.indices[t * 3];
+
+                sm.indices[t * 3 + 0] = triIdx[0];
+                sm.indices[t * 3 + 1] = flipWinding ? triIdx[2] : triIdx[1];
+                sm.indices[t * 3 + 2] = flipWinding ? triIdx[1] : triIdx[2];
+
+                const uint32_t maxIdx = std::max(triIdx[0], std::max(triIdx[1], triIdx[2]));
+                if (maxIdx < emitted) continue; //    ̹ 
+
+                Vertex triV[3]{};
+                for (int k = 0; k < 3; ++k)
+                    triV[k] = EvaluateVertex(p, k, ds.vertices[triIdx[k]].controlPoint);
+
+                if (!flipWinding)
+                    ComputeTangentForTri(triV[0], triV[1], triV[2]);
+                else
+                    ComputeTangentForTri(triV[0], triV[2], triV[1]);
+
+                for (int k = 0; k < 3; ++k)
+                {
+                    if (triIdx[k] >= emitted) sm.vertices[triIdx[k]] = triV[k];
+                }
+
+                emitted = maxIdx + 1;
             }
         }
 
@@ -1246,18 +962,17 @@ static void ExtractFromFBX(FbxScene* scene)
         {
             SubMesh& sm = splitSubMeshes[matSlot];
 
-            if (!splitSubMeshUsed[matSlot]) continue;
             if (sm.vertices.empty()) continue;
 
-            FillSkinWeights(mesh, sm, splitVtxCpIndex[matSlot]);
+            FillSkinWeights(mesh, sm, splitVtxCpIndex[matSlot], ctx.boneNameToIndex);
 
 #if DEBUGLOG
             DLOG("[SubMesh] mesh=\""); DLOG(sm.meshName); DLOG("\" ");
             DLOG("materialIndex="); DLOG(sm.materialIndex);
 
-            if (sm.materialIndex < g_Materials.size())
+            if (sm.materialIndex < ctx.materials.size())
             {
-                const auto& mat = g_Materials[sm.materialIndex];
+                const auto& mat = ctx.materials[sm.materialIndex];
                 DLOG(" ("); DLOG(mat.name); DLOG(")");
                 DLOG(" diffuse=\""); DLOG(mat.diffuseTextureName); DLOG("\"");
                 DLOG(" normal=\""); DLOG(mat.normalTextureName); DLOG("\"");
@@ -1265,72 +980,270 @@ static void ExtractFromFBX(FbxScene* scene)
             DLOGLN("");
 #endif
 
-            g_SubMeshes.push_back(std::move(sm));
+            ctx.subMeshes.push_back(std::move(sm));
         }
     }
 }
 
 // ==========================================================
-// main
+// ޽ GPU ȭ
+// - weld Ű: position/normal/uv +  ε/ġ (źƮ ó   )
+// -  ĳ ->  ->  ġ  (meshoptimizer  )
+// - ޽ó ̶ ,   İ 
 // ==========================================================
-int main()
+
+struct SubMeshOptimizeStats
 {
-    std::string importDir = "import";
-    std::string exportDir = "export";
+    size_t srcVertices = 0;
+    size_t dstVertices = 0;
+    size_t triangles = 0;
+    size_t transformedBefore = 0; // ACMR  (ĳ ̽ ȯ  )
+    size_t transformedAfter = 0;
+};
 
-    namespace fs = std::filesystem;
+static void WeldSkinnedSubMesh(SubMesh& sm)
+{
+    static_assert(offsetof(Vertex, normal) == offsetof(Vertex, position) + sizeof(float) * 3 &&
+                  offsetof(Vertex, uv) == offsetof(Vertex, normal) + sizeof(float) * 3 &&
+                  offsetof(Vertex, boneWeights) == offsetof(Vertex, boneIndices) + sizeof(uint32_t) * 4,
+                  "weld streams assume position/normal/uv and bone indices/weights are contiguous");
 
-    // export  
-    std::error_code ec;
-    fs::create_directories(exportDir, ec);
+    // tangent  Ʈ  
+    const meshopt_Stream streams[] =
+    {
+        { &sm.vertices[0].position[0], sizeof(float) * 8, sizeof(Vertex) },                           // position + normal + uv
+        { &sm.vertices[0].boneIndices[0], sizeof(uint32_t) * 4 + sizeof(float) * 4, sizeof(Vertex) }, // bone indices + weights
+    };
+
+    std::vector<unsigned int> remap(sm.vertices.size());
+    const size_t weldedCount = meshopt_generateVertexRemapMulti(
+        remap.data(),
+        sm.indices.data(),
+        sm.indices.size(),
+        sm.vertices.size(),
+        streams,
+        sizeof(streams) / sizeof(streams[0]));
+
+    if (weldedCount == sm.vertices.size())
+        return;
 
-    FbxManager* manager = FbxManager::Create();
-    if (!manager)
+    //  Ű  ó    (remapVertexBuffer   )
+    std::vector<Vertex> welded(weldedCount);
+    std::vector<bool> filled(weldedCount, false);
+    for (size_t i = 0; i < sm.vertices.size(); ++i)
     {
-        cout << "FBX Manager  .\n";
-        return -1;
+        const unsigned int dst = remap[i];
+        if (dst == ~0u || filled[dst]) continue;
+        welded[dst] = sm.vertices[i];
+        filled[dst] = true;
     }
 
-    FbxIOSettings* ios = FbxIOSettings::Create(manager, IOSROOT);
-    manager->SetIOSettings(ios);
+    meshopt_remapIndexBuffer(sm.indices.data(), sm.indices.data(), sm.indices.size(), remap.data());
+    sm.vertices = std::move(welded);
+}
 
-    for (const auto& entry : fs::directory_iterator(importDir))
-    {
-        if (!entry.is_regular_file()) continue;
+static void OptimizeSkinnedSubMesh(SubMesh& sm, SubMeshOptimizeStats& stats)
+{
+    stats.srcVertices = sm.vertices.size();
+    stats.dstVertices = sm.vertices.size();
+    stats.triangles = sm.indices.size() / 3;
 
-        fs::path path = entry.path();
-        if (path.extension() != ".fbx") continue;
+    if (sm.vertices.empty() || sm.indices.empty())
+        return;
 
-        std::string name = path.stem().string();
-        std::string fbxFileName = path.string();
-        std::string binFileName = exportDir + "/" + name + ".bin";
+    stats.transformedBefore = meshopt_analyzeVertexCache(
+        sm.indices.data(), sm.indices.size(), sm.vertices.size(), kVertexCacheSize, 0, 0).vertices_transformed;
+
+    WeldSkinnedSubMesh(sm);
+
+    meshopt_optimizeVertexCache(
+        sm.indices.data(),
+        sm.indices.data(),
+        sm.indices.size(),
+        sm.vertices.size());
+
+    meshopt_optimizeOverdraw(
+        sm.indices.data(),
+        sm.indices.data(),
+        sm.indices.size(),
+        &sm.vertices[0].position[0],
+        sm.vertices.size(),
+        sizeof(Vertex),
+        kOverdrawThreshold);
+
+    const size_t fetchedCount = meshopt_optimizeVertexFetch(
+        sm.vertices.data(),
+        sm.indices.data(),
+        sm.indices.size(),
+        sm.vertices.data(),
+        sm.vertices.size(),
+        sizeof(Vertex));
+    sm.vertices.resize(fetchedCount);
+
+    stats.dstVertices = sm.vertices.size();
+    stats.transformedAfter = meshopt_analyzeVertexCache(
+        sm.indices.data(), sm.indices.size(), sm.vertices.size(), kVertexCacheSize, 0, 0).vertices_transformed;
+}
 
-        cout << "\n==========================================\n";
-        cout << "ó : " << fbxFileName << "\n";
+static void OptimizeSkinnedSubMeshes(SkinnedExportContext& ctx)
+{
+    std::vector<SubMeshOptimizeStats> stats(ctx.subMeshes.size());
 
-        FbxImporter* importer = FbxImporter::Create(manager, "");
-        bool ok = importer->Initialize(fbxFileName.c_str(), -1, manager->GetIOSettings());
-        if (!ok)
+    ParallelFor(ctx.subMeshes.size(), [&](size_t i)
         {
-            cout << "FBX   : " << fbxFileName << "\n";
-            importer->Destroy();
-            continue;
-        }
+            SubMesh& sm = ctx.subMeshes[i];
+            OptimizeSkinnedSubMesh(sm, stats[i]);
+
+#if DEBUGLOG
+            const SubMeshOptimizeStats& st = stats[i];
+            const double tris = static_cast<double>(std::max<size_t>(1, st.triangles));
+            DLOG("[GPU OPT] mesh=\""); DLOG(sm.meshName); DLOG("\" ");
+            DLOG("vertices="); DLOG(st.srcVertices); DLOG("->"); DLOG(st.dstVertices); DLOG(" ");
+            DLOG("triangles="); DLOG(st.triangles); DLOG(" ");
+            DLOG("ACMR="); DLOG(st.transformedBefore / tris); DLOG("->"); DLOGLN(st.transformedAfter / tris);
+#endif
+        });
 
-        FbxScene* scene = FbxScene::Create(manager, ("scene_" + name).c_str());
-        importer->Import(scene);
-        importer->Destroy();
+    SubMeshOptimizeStats total{};
+    for (const SubMeshOptimizeStats& st : stats)
+    {
+        total.srcVertices += st.srcVertices;
+        total.dstVertices += st.dstVertices;
+        total.triangles += st.triangles;
+        total.transformedBefore += st.transformedBefore;
+        total.transformedAfter += st.transformedAfter;
+    }
 
-        ExtractFromFBX(scene);
+    if (total.triangles == 0) return;
 
-        if (SaveModelBin(binFileName))
-            cout << "BIN  Ϸ: " << binFileName << "\n";
-        else
-            cout << "BIN  : " << binFileName << "\n";
+    const double tris = static_cast<double>(total.triangles);
+    BatchLog() << "GPU ȭ:  " << total.srcVertices << " -> " << total.dstVertices
+        << ", ACMR(ĳ " << kVertexCacheSize << ") "
+        << (total.transformedBefore / tris) << " -> " << (total.transformedAfter / tris) << "\n";
+}
+
+// ==========================================================
+//  ϳ ó (SkinnedModelBinExport.h)
+// ==========================================================
+static std::string BuildSkinnedBinFilePath(const std::string& exportDir, const std::string& name)
+{
+    return exportDir + "/" + name + ".bin";
+}
 
-        scene->Destroy();
+bool ExportSkinnedModelScene(
+    FbxScene* scene,
+    const std::string& name,
+    const std::string& exportDir,
+    bool skipIfEmpty,
+    std::vector<std::string>& outOutputs)
+{
+    const std::string binFileName = BuildSkinnedBinFilePath(exportDir, name);
+
+    SkinnedExportContext ctx{};
+    ExtractFromFBX(scene, ctx);
+
+    if (skipIfEmpty && ctx.subMeshes.empty())
+    {
+        BatchLog() << "Ų ޽ : Ų BIN \n";
+        return true;
     }
 
-    manager->Destroy();
-    return 0;
+    OptimizeSkinnedSubMeshes(ctx);
+
+    MbinStreamDecodeBenchmark decodeBench;
+    const bool benchmarkDecode = COMPRESS_STREAMS && BENCHMARK_STREAM_DECODE;
+
+    const bool saved = SubmitBinaryFile(binFileName, BuildModelBin(ctx, benchmarkDecode ? &decodeBench : nullptr)).get();
+    if (benchmarkDecode)
+        decodeBench.Run(BatchLog());
+
+    if (saved)
+    {
+        BatchLog() << "BIN  Ϸ: " << binFileName << "\n";
+        outOutputs.push_back(binFileName);
+    }
+    else
+        BatchLog() << "BIN  : " << binFileName << "\n";
+
+    return saved;
 }
+
+} // namespace SkinnedModelBin
+
+//  (UnifiedBinExtractor)    Լ  
+#ifndef UNIFIED_BIN_EXTRACTOR
+
+// ==========================================================
+// FBX  ϳ ó (ġ ۾ )
+// ==========================================================
+static bool ExportSkinnedModelFile(
+    FbxManager* manager,
+    const BatchExportJob& job,
+    const std::string& exportDir,
+    std::vector<std::string>& outOutputs)
+{
+    const std::string fbxFileName = job.fbxPath.string();
+
+    BatchLog() << "\n==========================================\n";
+    BatchLog() << "ó : " << fbxFileName << "\n";
+
+    FbxScene* scene = ImportFbxScene(manager, fbxFileName, "scene_" + job.stem);
+    if (!scene) return false;
+
+    ConvertSceneToExportSpace(scene);
+    TriangulateScene(scene);
+
+    const bool ok = SkinnedModelBin::ExportSkinnedModelScene(scene, job.stem, exportDir, false, outOutputs);
+
+    scene->Destroy();
+    return ok;
+}
+
+// ==========================================================
+// main
+// ==========================================================
+
+// ġ : Ŀ  0 = ھ , ޸  0 =  
+static constexpr unsigned kBatchWorkerCount = 0;
+static constexpr uint64_t kBatchMemoryBudgetBytes = 16ull << 30;
+static constexpr double kBatchPeakBytesPerFileByte = 16.0;
+
+int main()
+{
+    std::string importDir = "import";
+    std::string exportDir = "export";
+
+    namespace fs = std::filesystem;
+
+    // export  
+    std::error_code ec;
+    fs::create_directories(exportDir, ec);
+
+    BatchExportSettings batchSettings{};
+    batchSettings.workerCount = kBatchWorkerCount;
+    batchSettings.memoryBudgetBytes = kBatchMemoryBudgetBytes;
+    batchSettings.peakBytesPerFileByte = kBatchPeakBytesPerFileByte;
+
+    const std::vector<BatchExportJob> jobs = CollectBatchExportJobs(importDir, batchSettings);
+
+    ExportCache cache(exportDir + "/.exportcache_skinned", SkinnedModelBin::ComputeExportSettingsHash());
+    cache.Load();
+
+    const BatchExportSummary summary = RunBatchExport(jobs, batchSettings,
+        [&](FbxManager* manager, const BatchExportJob& job)
+        {
+            return RunCachedExportJob(cache, job,
+                [&](std::vector<std::string>& outputs)
+                {
+                    return ExportSkinnedModelFile(manager, job, exportDir, outputs);
+                });
+        });
+
+    PrintBatchExportSummary(summary, jobs.size());
+    cache.PrintSummary();
+    if (!cache.Save())
+        std::cout << "ĳ   \n";
+    return (summary.failed == 0) ? 0 : 1;
+}
+
+#endif // UNIFIED_BIN_EXTRACTOR
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <fbxsdk.h>
+
+// ==========================================================
+// ƽ :    ( ⿡ )
+// - scene ConvertSceneToExportSpace + TriangulateScene  
+// -   δ outOutputs ߰ (ͽƮ ĳ Ͽ)
+// ==========================================================
+
+namespace StaticModelBin
+{
+    //   + FINAL_SCALE_F + LOD 
+    uint64_t ComputeExportSettingsHash();
+
+    // skipIfEmpty: Ų ޽ð ϳ    ʰ  ó
+    bool ExportStaticModelScene(
+        FbxScene* scene,
+        const std::string& name,
+        const std::string& exportDir,
+        bool skipIfEmpty,
+        std::vector<std::string>& outOutputs);
+}
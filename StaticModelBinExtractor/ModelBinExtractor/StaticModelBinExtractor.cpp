@@ -14,11 +14,30 @@
 #include <system_error>
 #include <cmath>
 #include <set>
+#include <array>
 
 #include <fbxsdk.h>
 #include "meshoptimizer.h"
+#include "../../Common/BatchExport.h"
+#include "../../Common/BinaryWriter.h"
+#include "../../Common/ParallelFor.h"
+#include "../../Common/ExportCache.h"
+#include "../../Common/FbxMaterialExtract.h"
+#include "../../Common/FbxPolygonVertexDedup.h"
+#include "../../Common/FbxSceneImport.h"
+#include "../../Common/MbinClusterLod.h"
+#include "../../Common/MbinDepthStream.h"
+#include "../../Common/MbinFormat.h"
+#include "../../Common/MbinMeshlet.h"
+#include "../../Common/MbinQuantize.h"
+#include "../../Common/MbinSectionedWriter.h"
+#include "../../Common/MbinStreamCodec.h"
+#include "StaticModelBinExport.h"
 using namespace std;
 
+namespace StaticModelBin
+{
+
 // ==========================================================
 // ƽ(Ų)  
 // - " BIN   ٲ۴" :
@@ -30,18 +49,69 @@ using namespace std;
 
 static constexpr float FINAL_SCALE_F = 1.0f; // ConvertScene(m)   1.0 
 
-#define DEBUGLOG 1
+// MBIN v6 ȭ  (MbinQuantize.h, 80 -> 32Ʈ). false  v5 ״
+static constexpr bool QUANTIZE_VERTICES = false;
+static constexpr bool QUANTIZE_POSITION_HALF = false; // true: fp16, false: unorm16 (޽ AABB )
+
+// /ε meshopt ڵ Ʈ  (MbinStreamCodec.h,  flags ǥ)
+static constexpr bool COMPRESS_STREAMS = false;
+// COMPRESS_STREAMS  ϸ  ӵ(GB/s) պ   α׷
+// (ٸ ġ Ŀ ھ  Ƿ Ȯ ġ kBatchWorkerCount = 1)
+static constexpr bool BENCHMARK_STREAM_DECODE = false;
+
+// MBIN v7  ġ (MbinSectionedFormat.h):   + 16Ʈ  /ε + ڿ ̺
+//  MbinReader.h mmap    ε. false   ġ(v5/v6)
+// ȭ/  v7 ״ 
+static constexpr bool WRITE_SECTIONED_LAYOUT = false;
+
+// v7 :  65536  ޽ô 16Ʈ ε ( flags ǥ)
+// /ε  ϳ Ǯ ϳ (VTXB/IDXB), ޽ô firstIndex/indexCount/baseVertex ׸
+static constexpr bool WRITE_INDEX16 = false;
+
+// LOD ޽ meshlet (MbinMeshlet.h, ޽ ̴ / GPU ø,  flags ǥ)
+static constexpr bool BUILD_MESHLETS = false;
+static constexpr uint32_t kMeshletMaxVertices = 64;
+static constexpr uint32_t kMeshletMaxTriangles = 124;
+static constexpr float kMeshletConeWeight = 0.25f;   //   ø   0
+static constexpr bool ENCODE_MESHLETS = false;       // meshopt_encodeMeshlet ( API)
+
+static_assert(kMeshletMaxVertices <= 256 && kMeshletMaxTriangles <= 256, "meshlet limits exceed meshopt_encodeMeshlet range");
+
+// Ŭ LOD DAG (MbinClusterLod.h,  LOD,  flags ǥ)
+// LOD0  ϳ  ܰ Ŭ͸ Ƿ LOD1/LOD2   ʴ´
+// Ŭ ũ kMeshletMaxVertices / kMeshletMaxTriangles
+static constexpr bool BUILD_CLUSTER_LOD = false;
+static constexpr uint32_t kClusterLodGroupSize = 8;        // ׷ Ŭ  (meshopt_partitionClusters)
+static constexpr float kClusterLodSimplifyRatio = 0.5f;    // ׷ ܼȭ ﰢ ǥ 
+static constexpr float kClusterLodNormalWeight = 0.5f;
+static constexpr float kClusterLodUvWeight = 1.0f;
+
+//  Ƽ ޽ø /ε  ϳ  ( x Ƽ Ը draw ϳ -> Ƽ󸶴 ϳ)
+// ޽ô Ƽ  ,  庰 ε  OOBB draw range  ( flags ǥ)
+// LOD ܼȭ   ϹǷ   LOD/ø  ״
+static constexpr bool MERGE_SUBMESHES_BY_MATERIAL = false;
+
+//  FbxMesh  ,   ޽ø ã  ϳ(޽  ) + νϽ ȯ ̺ ( flags ǥ)
+//  LOD ܼȭ  . νϽ kMinInstanceCount ̸̸ ó  ũ
+static constexpr bool DETECT_INSTANCES = false;
+static constexpr uint32_t kMinInstanceCount = 2;
+
+//  н / ׸ڸʿ ġ  Ʈ + ׸ ε (MbinDepthStream.h,  flags ǥ)
+// 80Ʈ   12Ʈ(ȭ 8Ʈ) ġ ġ, UV/   ׸ ε 
+static constexpr bool BUILD_DEPTH_STREAMS = false;
+
+#define DEBUGLOG 0
 
 #if DEBUGLOG
-#define DLOG(x) do { std::cout << (x); } while(0)
-#define DLOGLN(x) do { std::cout << (x) << "\n"; } while(0)
+#define DLOG(x) do { BatchLog() << (x); } while(0)
+#define DLOGLN(x) do { BatchLog() << (x) << "\n"; } while(0)
 #else
 #define DLOG(x) do {} while(0)
 #define DLOGLN(x) do {} while(0)
 #endif
 
 // ==========================================================
-//   
+//   (  ۾ ؽƮ)
 // ==========================================================
 
 struct Vertex {
@@ -53,35 +123,28 @@ struct Vertex {
     float boneWeights[4];
 };
 
-struct MaterialTexTransform
-{
-    float scale[2] = { 1.0f, 1.0f };
-    float offset[2] = { 0.0f, 0.0f };
-    uint32_t wrapMode[2] = { 0u, 0u }; // 0=Repeat, 1=Clamp
-};
-
-struct Material
+//  ޽    ϳ (MERGE_SUBMESHES_BY_MATERIAL)
+struct SubMeshDrawRange
 {
-    string name;
-    string diffuseTextureName;
-    string normalTextureName;
-    string emissiveTextureName;
-    string specularTextureName;
+    string meshName;
+    string authoringPath;
 
-    float diffuseColor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
-    float emissiveColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
-    float specularColor[4] = { 0.0f, 0.0f, 0.0f, 0.0f }; // rgb=specular, a=shininess
+    uint32_t firstIndex = 0;
+    uint32_t indexCount = 0;
+    uint32_t firstVertex = 0;
+    uint32_t vertexCount = 0;
 
-    MaterialTexTransform diffuseTransform;
-    MaterialTexTransform normalTransform;
-    MaterialTexTransform emissiveTransform;
-    MaterialTexTransform specularTransform;
+    uint32_t hasExplicitLocalOOBB = 0;
+    float explicitLocalOOBBMatrix[16] = {};
 };
 
+static constexpr uint32_t kNoInstancePrototype = UINT32_MAX;
+
 struct SubMesh {
     string meshName;
     string authoringPath;
     uint32_t materialIndex = 0;
+    uint32_t instancePrototype = kNoInstancePrototype; // DETECT_INSTANCES:  ȣ (޽  )
 
     uint32_t hasExplicitLocalOOBB = 0;
     float explicitLocalOOBBMatrix[16] =
@@ -94,13 +157,37 @@ struct SubMesh {
 
     vector<Vertex> vertices;
     vector<uint32_t> indices;
+
+    vector<SubMeshDrawRange> drawRanges; //  ޽ø (ε   迭 )
+
+    // LOD ܼȭ   ܰ: /ε   ܰ Ʒ LOD sameAsSubMesh  
+    // (ResolveLodSubMesh а, Ʒ LOD     TakeGeometryFromPreviousLod Ѱܹ޴´)
+    bool sameAsPreviousLod = false;
+    uint32_t sameAsSubMesh = 0;
+};
+
+//  ϳ ׸  (DETECT_INSTANCES)
+struct StaticInstance
+{
+    string meshName;
+    string authoringPath;
+    uint32_t prototype = 0;
+    uint32_t flags = 0;       // MbinInstanceFlags
+    float transform[16] = {}; // ޽  -> ũ  (OOBB İ  ġ)
 };
 
-vector<Material> g_Materials;
-unordered_map<string, uint32_t> g_MaterialNameToIndex;
-vector<SubMesh> g_SubMeshes;
+// ġ Ŀ ϳ:   ۾ ؽƮ ´
+struct StaticExportContext
+{
+    vector<Material> materials;
+    unordered_map<string, uint32_t> materialNameToIndex;
+    vector<SubMesh> subMeshes;
+    vector<StaticInstance> instances;
+};
 
 static constexpr int kStaticLodCount = 3;
+//   Ϸ  LOD  (Ŭ LOD LOD0)
+static constexpr int kStaticLodFileCount = BUILD_CLUSTER_LOD ? 1 : kStaticLodCount;
 
 struct StaticLodBuildSettings
 {
@@ -160,6 +247,7 @@ struct WeldedSubMesh
     string meshName;
     string authoringPath;
     uint32_t materialIndex = 0;
+    uint32_t instancePrototype = kNoInstancePrototype;
 
     uint32_t hasExplicitLocalOOBB = 0;
     float explicitLocalOOBBMatrix[16] =
@@ -178,152 +266,89 @@ static int ClampStaticLodLevel(int lodLevel);
 static float GetStaticLodTriangleRatio(const StaticLodBuildSettings& settings, int lodLevel);
 
 static uint32_t FloatToBits(float v);
-static void CopySubMeshMetaToWeldedSubMesh(const SubMesh& src, WeldedSubMesh& dst);
-static void CopyWeldedSubMeshMetaToSubMesh(const WeldedSubMesh& src, SubMesh& dst);
+template <class SrcT, class DstT>
+static void CopySubMeshMeta(const SrcT& src, DstT& dst);
 static WeldedVertexKey MakeWeldedVertexKey(const Vertex& v);
 static uint32_t FindOrAddWeldedVertex(
     const Vertex& srcVertex,
     std::vector<Vertex>& outVertices,
     std::unordered_map<WeldedVertexKey, uint32_t, WeldedVertexKeyHasher>& keyToIndex);
 static WeldedSubMesh BuildWeldedSubMeshFromSubMesh(const SubMesh& src);
-static SubMesh BuildSubMeshFromWeldedSubMesh(const WeldedSubMesh& src);
+static SubMesh BuildSubMeshFromWeldedSubMesh(WeldedSubMesh&& src);
 
 static uint32_t ComputeTargetTriangleCount(
     uint32_t sourceTriangleCount,
     float triangleRatio);
-static WeldedSubMesh BuildMeshoptSimplifiedWeldedSubMesh(
+static bool BuildMeshoptSimplifiedWeldedSubMesh(
     const WeldedSubMesh& src,
     uint32_t targetTriangleCount,
     float targetError,
     float normalWeight,
     float uvWeight,
-    bool permissive);
+    bool permissive,
+    WeldedSubMesh& out,
+    float* outResultError);
 
-static std::vector<SubMesh> BuildLodSubMeshesFromBase(
-    const std::vector<SubMesh>& baseSubMeshes,
+static void BuildLodChainFromBase(
+    SubMesh&& baseSubMesh,
     const StaticLodBuildSettings& settings,
-    int lodLevel);
+    std::array<std::vector<SubMesh>, kStaticLodCount>& outLods,
+    size_t subMeshIndex);
+static const SubMesh& ResolveLodSubMesh(
+    const std::array<std::vector<SubMesh>, kStaticLodCount>& lodSubMeshes,
+    int lod,
+    size_t subMeshIndex);
+static void TakeGeometryFromPreviousLod(
+    std::array<std::vector<SubMesh>, kStaticLodCount>& lodSubMeshes,
+    int lod);
+static std::array<std::vector<SubMesh>, kStaticLodCount> BuildAllLodSubMeshesFromBase(
+    std::vector<SubMesh>&& baseSubMeshes,
+    const StaticLodBuildSettings& settings);
+static void BuildAllLodMeshlets(
+    const std::array<std::vector<SubMesh>, kStaticLodCount>& lodSubMeshes,
+    std::array<std::vector<MbinSubMeshMeshlets>, kStaticLodCount>& outMeshlets);
+static void BuildAllClusterLods(
+    const std::vector<SubMesh>& baseSubMeshes,
+    std::vector<MbinSubMeshClusterLod>& outClusterLods);
+static void BuildAllLodDepthStreams(
+    const std::array<std::vector<SubMesh>, kStaticLodCount>& lodSubMeshes,
+    std::array<std::vector<MbinSubMeshDepthStream>, kStaticLodCount>& outDepthStreams);
+static std::vector<SubMesh> MergeSubMeshesByMaterial(
+    std::vector<SubMesh>&& subMeshes,
+    const std::vector<Material>& materials,
+    const std::array<std::vector<SubMesh>, kStaticLodCount>& lodSubMeshes,
+    int lod,
+    std::vector<uint32_t>& outNewIndex);
 
 // ==========================================================
-//   Ʈ
+//   (Ʈ ۾  )
 // ==========================================================
 
-static std::ofstream g_out;
-
-static void WriteRaw(const void* data, size_t size)
+static void WriteRaw(BinaryWriter& out, const void* data, size_t size)
 {
-    g_out.write(reinterpret_cast<const char*>(data), size);
+    out.WriteRaw(data, size);
 }
-static void WriteUInt16(uint16_t v) { WriteRaw(&v, sizeof(v)); }
-static void WriteUInt32(uint32_t v) { WriteRaw(&v, sizeof(v)); }
-static void WriteInt32(int32_t v) { WriteRaw(&v, sizeof(v)); }
+static void WriteUInt16(BinaryWriter& out, uint16_t v) { WriteRaw(out, &v, sizeof(v)); }
+static void WriteUInt32(BinaryWriter& out, uint32_t v) { WriteRaw(out, &v, sizeof(v)); }
+static void WriteInt32(BinaryWriter& out, int32_t v) { WriteRaw(out, &v, sizeof(v)); }
 
-static void WriteFloatArray(const float* f, size_t count)
+static void WriteFloatArray(BinaryWriter& out, const float* f, size_t count)
 {
-    WriteRaw(f, sizeof(float) * count);
+    WriteRaw(out, f, sizeof(float) * count);
 }
 
-static void WriteStringUtf8(const std::string& s)
+static void WriteStringUtf8(BinaryWriter& out, const std::string& s)
 {
     uint16_t len = static_cast<uint16_t>(s.size());
-    WriteUInt16(len);
-    if (len > 0) WriteRaw(s.data(), len);
-}
-
-static void WriteMaterialTexTransform(const MaterialTexTransform& t)
-{
-    WriteFloatArray(t.scale, 2);
-    WriteFloatArray(t.offset, 2);
-    WriteRaw(t.wrapMode, sizeof(uint32_t) * 2);
-}
-
-// ==========================================================
-// [C++20] u8path ü: ϸ stem ̱
-// ==========================================================
-
-static std::string SafeStemFromFbxFileName(const char* fn)
-{
-    if (!fn || !fn[0]) return "";
-
-    try
-    {
-        std::string s(fn);
-        std::u8string u8(reinterpret_cast<const char8_t*>(s.data()), s.size());
-        std::filesystem::path p(u8);
-
-        std::u8string stem_u8 = p.stem().u8string();
-        return std::string(reinterpret_cast<const char*>(stem_u8.data()), stem_u8.size());
-    }
-    catch (...)
-    {
-        std::string s(fn);
-        size_t pos = s.find_last_of("/\\");
-        std::string base = (pos == std::string::npos) ? s : s.substr(pos + 1);
-        size_t dot = base.find_last_of('.');
-        if (dot != std::string::npos) base = base.substr(0, dot);
-        return base;
-    }
-}
-
-static std::string ExtractFirstTextureStem(FbxProperty prop)
-{
-    if (!prop.IsValid()) return "";
-
-    // LayeredTexture ( 0)
-    if (prop.GetSrcObjectCount<FbxLayeredTexture>() > 0)
-    {
-        auto* layered = prop.GetSrcObject<FbxLayeredTexture>(0);
-        if (layered && layered->GetSrcObjectCount<FbxTexture>() > 0)
-        {
-            auto* tex = FbxCast<FbxFileTexture>(layered->GetSrcObject<FbxTexture>(0));
-            if (tex) return SafeStemFromFbxFileName(tex->GetFileName());
-        }
-        return "";
-    }
-
-    // Ϲ ؽó
-    if (prop.GetSrcObjectCount<FbxTexture>() > 0)
-    {
-        auto* tex = FbxCast<FbxFileTexture>(prop.GetSrcObject<FbxTexture>(0));
-        if (tex) return SafeStemFromFbxFileName(tex->GetFileName());
-    }
-    return "";
-}
-
-static FbxTexture* ExtractFirstTextureObject(FbxProperty prop)
-{
-    if (!prop.IsValid()) return nullptr;
-
-    if (prop.GetSrcObjectCount<FbxLayeredTexture>() > 0)
-    {
-        auto* layered = prop.GetSrcObject<FbxLayeredTexture>(0);
-        if (layered && layered->GetSrcObjectCount<FbxTexture>() > 0)
-            return layered->GetSrcObject<FbxTexture>(0);
-        return nullptr;
-    }
-
-    if (prop.GetSrcObjectCount<FbxTexture>() > 0)
-        return prop.GetSrcObject<FbxTexture>(0);
-
-    return nullptr;
-}
-
-static const char* WrapModeToString(FbxTexture::EWrapMode mode)
-{
-    switch (mode)
-    {
-    case FbxTexture::eRepeat: return "Repeat";
-    case FbxTexture::eClamp:  return "Clamp";
-    default:                  return "Unknown";
-    }
+    WriteUInt16(out, len);
+    if (len > 0) WriteRaw(out, s.data(), len);
 }
 
-static const char* MaterialClassToString(FbxSurfaceMaterial* mat)
+static void WriteMaterialTexTransform(BinaryWriter& out, const MaterialTexTransform& t)
 {
-    if (!mat) return "null";
-    if (FbxCast<FbxSurfacePhong>(mat))   return "Phong";
-    if (FbxCast<FbxSurfaceLambert>(mat)) return "Lambert";
-    return "Other";
+    WriteFloatArray(out, t.scale, 2);
+    WriteFloatArray(out, t.offset, 2);
+    WriteRaw(out, t.wrapMode, sizeof(uint32_t) * 2);
 }
 
 static const char* MappingModeToString(FbxGeometryElement::EMappingMode mode)
@@ -419,255 +444,6 @@ static void DumpColliderHelperDecision(FbxNode* node, FbxMesh* mesh)
     DLOGLN("======================================================");
 }
 
-static void DumpDouble3Value(const char* label, const FbxDouble3& v)
-{
-    DLOG("  ");
-    DLOG(label);
-    DLOG(" = (");
-    DLOG(v[0]); DLOG(", ");
-    DLOG(v[1]); DLOG(", ");
-    DLOG(v[2]); DLOGLN(")");
-}
-
-static void DumpDoubleValue(const char* label, double v)
-{
-    DLOG("  ");
-    DLOG(label);
-    DLOG(" = ");
-    DLOGLN(v);
-}
-
-static void DumpTextureSlotDebug(const char* slotName, FbxProperty prop)
-{
-    DLOG("  [TextureSlot] ");
-    DLOG(slotName);
-
-    if (!prop.IsValid())
-    {
-        DLOGLN(" : property invalid");
-        return;
-    }
-
-    const bool hasLayered = (prop.GetSrcObjectCount<FbxLayeredTexture>() > 0);
-    FbxTexture* tex = ExtractFirstTextureObject(prop);
-
-    if (!tex)
-    {
-        DLOG(" : connected=0");
-        DLOG(" layered="); DLOG(hasLayered ? 1 : 0);
-        DLOGLN("");
-        return;
-    }
-
-    auto* fileTex = FbxCast<FbxFileTexture>(tex);
-
-    DLOG(" : connected=1");
-    DLOG(" layered="); DLOG(hasLayered ? 1 : 0);
-    DLOG(" type=\""); DLOG(fileTex ? "FileTexture" : "Texture"); DLOG("\"");
-
-    DLOG(" scale=(");
-    DLOG(tex->GetScaleU()); DLOG(", ");
-    DLOG(tex->GetScaleV()); DLOG(")");
-
-    DLOG(" trans=(");
-    DLOG(tex->GetTranslationU()); DLOG(", ");
-    DLOG(tex->GetTranslationV()); DLOG(")");
-
-    DLOG(" wrap=(");
-    DLOG(WrapModeToString(tex->GetWrapModeU())); DLOG(", ");
-    DLOG(WrapModeToString(tex->GetWrapModeV())); DLOG(")");
-
-    if (fileTex)
-    {
-        const char* fileName = fileTex->GetFileName();
-        DLOG(" file=\""); DLOG(fileName ? fileName : ""); DLOG("\"");
-        DLOG(" stem=\""); DLOG(SafeStemFromFbxFileName(fileName)); DLOG("\"");
-    }
-
-    DLOGLN("");
-}
-
-static void DumpMaterialDebug(FbxSurfaceMaterial* mat)
-{
-    if (!mat)
-    {
-        DLOGLN("[MaterialDump] null");
-        return;
-    }
-
-    DLOGLN("\n--------------------------------------------------");
-    DLOG("[MaterialDump] name=\""); DLOG(mat->GetName()); DLOG("\" ");
-    DLOG("class=\""); DLOG(MaterialClassToString(mat)); DLOGLN("\"");
-
-    if (auto* lambert = FbxCast<FbxSurfaceLambert>(mat))
-    {
-        DumpDouble3Value("Lambert.Ambient", lambert->Ambient.Get());
-        DumpDoubleValue("Lambert.AmbientFactor", lambert->AmbientFactor.Get());
-
-        DumpDouble3Value("Lambert.Diffuse", lambert->Diffuse.Get());
-        DumpDoubleValue("Lambert.DiffuseFactor", lambert->DiffuseFactor.Get());
-
-        DumpDouble3Value("Lambert.Emissive", lambert->Emissive.Get());
-        DumpDoubleValue("Lambert.EmissiveFactor", lambert->EmissiveFactor.Get());
-
-        DumpDouble3Value("Lambert.TransparentColor", lambert->TransparentColor.Get());
-        DumpDoubleValue("Lambert.TransparencyFactor", lambert->TransparencyFactor.Get());
-    }
-
-    if (auto* phong = FbxCast<FbxSurfacePhong>(mat))
-    {
-        DumpDouble3Value("Phong.Specular", phong->Specular.Get());
-        DumpDoubleValue("Phong.SpecularFactor", phong->SpecularFactor.Get());
-        DumpDoubleValue("Phong.Shininess", phong->Shininess.Get());
-        DumpDouble3Value("Phong.Reflection", phong->Reflection.Get());
-        DumpDoubleValue("Phong.ReflectionFactor", phong->ReflectionFactor.Get());
-    }
-
-    DumpTextureSlotDebug("Diffuse", mat->FindProperty(FbxSurfaceMaterial::sDiffuse));
-    DumpTextureSlotDebug("NormalMap", mat->FindProperty(FbxSurfaceMaterial::sNormalMap));
-    DumpTextureSlotDebug("Bump", mat->FindProperty(FbxSurfaceMaterial::sBump));
-    DumpTextureSlotDebug("Emissive", mat->FindProperty(FbxSurfaceMaterial::sEmissive));
-    DumpTextureSlotDebug("Specular", mat->FindProperty(FbxSurfaceMaterial::sSpecular));
-}
-
-static uint32_t EncodeWrapMode(FbxTexture::EWrapMode mode)
-{
-    return (mode == FbxTexture::eClamp) ? 1u : 0u;
-}
-
-static void FillColor4(float out[4], double x, double y, double z, double w)
-{
-    out[0] = (float)x;
-    out[1] = (float)y;
-    out[2] = (float)z;
-    out[3] = (float)w;
-}
-
-static void FillTexTransformFromProperty(FbxProperty prop, MaterialTexTransform& outTransform)
-{
-    outTransform = MaterialTexTransform{};
-
-    FbxTexture* tex = ExtractFirstTextureObject(prop);
-    if (!tex) return;
-
-    outTransform.scale[0] = (float)tex->GetScaleU();
-    outTransform.scale[1] = (float)tex->GetScaleV();
-    outTransform.offset[0] = (float)tex->GetTranslationU();
-    outTransform.offset[1] = (float)tex->GetTranslationV();
-    outTransform.wrapMode[0] = EncodeWrapMode(tex->GetWrapModeU());
-    outTransform.wrapMode[1] = EncodeWrapMode(tex->GetWrapModeV());
-}
-
-static bool IsNearlyBlack3(const float c[4], float eps = 1e-6f)
-{
-    return
-        (fabsf(c[0]) <= eps) &&
-        (fabsf(c[1]) <= eps) &&
-        (fabsf(c[2]) <= eps);
-}
-
-static bool IsIdentityTexTransform(const MaterialTexTransform& t, float eps = 1e-6f)
-{
-    return
-        (fabsf(t.scale[0] - 1.0f) <= eps) &&
-        (fabsf(t.scale[1] - 1.0f) <= eps) &&
-        (fabsf(t.offset[0]) <= eps) &&
-        (fabsf(t.offset[1]) <= eps) &&
-        (t.wrapMode[0] == 0u) &&
-        (t.wrapMode[1] == 0u);
-}
-
-static void ExtractMaterialAttributes(FbxSurfaceMaterial* mat, Material& outMat)
-{
-    if (!mat) return;
-
-    FbxProperty diffuseProp = mat->FindProperty(FbxSurfaceMaterial::sDiffuse);
-    FbxProperty normalProp = mat->FindProperty(FbxSurfaceMaterial::sNormalMap);
-    FbxProperty bumpProp = mat->FindProperty(FbxSurfaceMaterial::sBump);
-    FbxProperty emissiveProp = mat->FindProperty(FbxSurfaceMaterial::sEmissive);
-    FbxProperty specularProp = mat->FindProperty(FbxSurfaceMaterial::sSpecular);
-
-    outMat.diffuseTextureName = ExtractFirstTextureStem(diffuseProp);
-    outMat.normalTextureName = ExtractFirstTextureStem(normalProp);
-    outMat.emissiveTextureName = ExtractFirstTextureStem(emissiveProp);
-    outMat.specularTextureName = ExtractFirstTextureStem(specularProp);
-
-    FillTexTransformFromProperty(diffuseProp, outMat.diffuseTransform);
-
-    if (outMat.normalTextureName.empty())
-    {
-        outMat.normalTextureName = ExtractFirstTextureStem(bumpProp);
-        FillTexTransformFromProperty(bumpProp, outMat.normalTransform);
-    }
-    else
-    {
-        FillTexTransformFromProperty(normalProp, outMat.normalTransform);
-    }
-
-    FillTexTransformFromProperty(emissiveProp, outMat.emissiveTransform);
-    FillTexTransformFromProperty(specularProp, outMat.specularTransform);
-
-    if (auto* lambert = FbxCast<FbxSurfaceLambert>(mat))
-    {
-        const FbxDouble3 d = lambert->Diffuse.Get();
-        const double df = lambert->DiffuseFactor.Get();
-        FillColor4(outMat.diffuseColor, d[0] * df, d[1] * df, d[2] * df, 1.0);
-
-        const FbxDouble3 e = lambert->Emissive.Get();
-        const double ef = lambert->EmissiveFactor.Get();
-        FillColor4(outMat.emissiveColor, e[0] * ef, e[1] * ef, e[2] * ef, 1.0);
-    }
-
-    if (auto* phong = FbxCast<FbxSurfacePhong>(mat))
-    {
-        const FbxDouble3 s = phong->Specular.Get();
-        const double sf = phong->SpecularFactor.Get();
-        const double shininess = phong->Shininess.Get();
-        FillColor4(outMat.specularColor, s[0] * sf, s[1] * sf, s[2] * sf, shininess);
-    }
-
-    if (!outMat.normalTextureName.empty() &&
-        IsIdentityTexTransform(outMat.normalTransform) &&
-        !IsIdentityTexTransform(outMat.diffuseTransform))
-    {
-        outMat.normalTransform = outMat.diffuseTransform;
-    }
-
-    if (!outMat.emissiveTextureName.empty() &&
-        IsIdentityTexTransform(outMat.emissiveTransform) &&
-        !IsIdentityTexTransform(outMat.diffuseTransform))
-    {
-        outMat.emissiveTransform = outMat.diffuseTransform;
-    }
-
-    if (!outMat.specularTextureName.empty() &&
-        IsIdentityTexTransform(outMat.specularTransform) &&
-        !IsIdentityTexTransform(outMat.diffuseTransform))
-    {
-        outMat.specularTransform = outMat.diffuseTransform;
-    }
-
-    if (!outMat.emissiveTextureName.empty() && IsNearlyBlack3(outMat.emissiveColor))
-    {
-        FillColor4(outMat.emissiveColor, 1.0, 1.0, 1.0, 1.0);
-    }
-
-    if (!outMat.specularTextureName.empty())
-    {
-        if (IsNearlyBlack3(outMat.specularColor))
-        {
-            outMat.specularColor[0] = 1.0f;
-            outMat.specularColor[1] = 1.0f;
-            outMat.specularColor[2] = 1.0f;
-        }
-
-        if (outMat.specularColor[3] <= 0.0f)
-        {
-            outMat.specularColor[3] = 32.0f;
-        }
-    }
-}
-
 // ==========================================================
 // FBX Node Geometric Transform ( )
 // ==========================================================
@@ -741,39 +517,6 @@ static std::string GetNodeRelativeAuthoringPath(FbxScene* scene, FbxNode* node)
     return JoinPathSegments(segments);
 }
 
-static int GetPolygonMaterialSlot(FbxNode* node, FbxMesh* mesh, int polygonIndex)
-{
-    if (!node || !mesh) return 0;
-
-    const int nodeMaterialCount = node->GetMaterialCount();
-    if (nodeMaterialCount <= 1) return 0;
-
-    FbxGeometryElementMaterial* matElem = mesh->GetElementMaterial();
-    if (!matElem) return 0;
-
-    int localMaterialSlot = 0;
-
-    if (matElem->GetMappingMode() == FbxGeometryElement::eByPolygon)
-    {
-        if (polygonIndex >= 0 && polygonIndex < matElem->GetIndexArray().GetCount())
-            localMaterialSlot = matElem->GetIndexArray().GetAt(polygonIndex);
-    }
-    else if (matElem->GetMappingMode() == FbxGeometryElement::eAllSame)
-    {
-        if (matElem->GetIndexArray().GetCount() > 0)
-            localMaterialSlot = matElem->GetIndexArray().GetAt(0);
-    }
-    else
-    {
-        localMaterialSlot = 0;
-    }
-
-    if (localMaterialSlot < 0 || localMaterialSlot >= nodeMaterialCount)
-        localMaterialSlot = 0;
-
-    return localMaterialSlot;
-}
-
 static std::string NormalizeMaterialLikeName(const std::string& text)
 {
     std::string out = text;
@@ -997,24 +740,24 @@ static void FillExplicitLocalOOBBMatrix(
 // Material 
 // ==========================================================
 
-static void WriteMaterialSection(const std::vector<Material>& materials)
+static void WriteMaterialSection(BinaryWriter& out, const std::vector<Material>& materials)
 {
     for (const auto& m : materials)
     {
-        WriteStringUtf8(m.name);
-        WriteStringUtf8(m.diffuseTextureName);
-        WriteStringUtf8(m.normalTextureName);
-        WriteStringUtf8(m.emissiveTextureName);
-        WriteStringUtf8(m.specularTextureName);
-
-        WriteFloatArray(m.diffuseColor, 4);
-        WriteFloatArray(m.emissiveColor, 4);
-        WriteFloatArray(m.specularColor, 4);
-
-        WriteMaterialTexTransform(m.diffuseTransform);
-        WriteMaterialTexTransform(m.normalTransform);
-        WriteMaterialTexTransform(m.emissiveTransform);
-        WriteMaterialTexTransform(m.specularTransform);
+        WriteStringUtf8(out, m.name);
+        WriteStringUtf8(out, m.diffuseTextureName);
+        WriteStringUtf8(out, m.normalTextureName);
+        WriteStringUtf8(out, m.emissiveTextureName);
+        WriteStringUtf8(out, m.specularTextureName);
+
+        WriteFloatArray(out, m.diffuseColor, 4);
+        WriteFloatArray(out, m.emissiveColor, 4);
+        WriteFloatArray(out, m.specularColor, 4);
+
+        WriteMaterialTexTransform(out, m.diffuseTransform);
+        WriteMaterialTexTransform(out, m.normalTransform);
+        WriteMaterialTexTransform(out, m.emissiveTransform);
+        WriteMaterialTexTransform(out, m.specularTransform);
     }
 }
 
@@ -1022,24 +765,47 @@ static void WriteMaterialSection(const std::vector<Material>& materials)
 //  (boneCount=0)
 // ==========================================================
 
+static uint32_t MakeModelHeaderFlags()
+{
+    uint32_t flags = 0;
+    if (QUANTIZE_VERTICES)
+        flags |= MBIN_FLAG_QUANTIZED_VERTEX | (QUANTIZE_POSITION_HALF ? MBIN_FLAG_POSITION_HALF : 0u);
+    if (COMPRESS_STREAMS)
+        flags |= MBIN_FLAG_COMPRESSED_STREAMS;
+    if (BUILD_MESHLETS)
+        flags |= MBIN_FLAG_MESHLETS | (ENCODE_MESHLETS ? MBIN_FLAG_MESHLETS_ENCODED : 0u);
+    if (BUILD_CLUSTER_LOD)
+        flags |= MBIN_FLAG_CLUSTER_LOD;
+    if (MERGE_SUBMESHES_BY_MATERIAL)
+        flags |= MBIN_FLAG_DRAW_RANGES;
+    if (DETECT_INSTANCES)
+        flags |= MBIN_FLAG_INSTANCES;
+    if (BUILD_DEPTH_STREAMS)
+        flags |= MBIN_FLAG_DEPTH_STREAMS;
+    if (WRITE_SECTIONED_LAYOUT && WRITE_INDEX16)
+        flags |= MBIN_FLAG_INDEX16;
+    return flags;
+}
+
 static void WriteModelHeader(
+    BinaryWriter& out,
     const std::vector<Material>& materials,
     const std::vector<SubMesh>& subMeshes)
 {
     char magic[4] = { 'M', 'B', 'I', 'N' };
-    WriteRaw(magic, 4);
+    WriteRaw(out, magic, 4);
 
-    uint32_t version = 5;
-    uint32_t flags = 0;
+    uint32_t version = QUANTIZE_VERTICES ? kMbinQuantizedVersion : 5;
+    uint32_t flags = MakeModelHeaderFlags();
     uint32_t boneCount = 0; // Ų 
     uint32_t materialCount = (uint32_t)materials.size();
     uint32_t subCount = (uint32_t)subMeshes.size();
 
-    WriteUInt32(version);
-    WriteUInt32(flags);
-    WriteUInt32(boneCount);
-    WriteUInt32(materialCount);
-    WriteUInt32(subCount);
+    WriteUInt32(out, version);
+    WriteUInt32(out, flags);
+    WriteUInt32(out, boneCount);
+    WriteUInt32(out, materialCount);
+    WriteUInt32(out, subCount);
 }
 
 // ==========================================================
@@ -1055,103 +821,328 @@ static void WriteSkeletonSection_Empty()
 // SubMesh 
 // ==========================================================
 
-static void WriteSubMeshSection(const std::vector<SubMesh>& subMeshes)
+static void WriteSubMeshSection(
+    BinaryWriter& out,
+    const std::vector<SubMesh>& subMeshes,
+    MbinStreamDecodeBenchmark* decodeBench)
 {
+    std::vector<MbinQuantizedVertex> quantized;
+    std::vector<uint8_t> encoded;
+
     for (const auto& sm : subMeshes)
     {
-        WriteStringUtf8(sm.meshName);
-        WriteStringUtf8(sm.authoringPath);
-        WriteUInt32(sm.materialIndex);
-        WriteUInt32(sm.hasExplicitLocalOOBB);
-        WriteFloatArray(sm.explicitLocalOOBBMatrix, 16);
+        WriteStringUtf8(out, sm.meshName);
+        WriteStringUtf8(out, sm.authoringPath);
+        WriteUInt32(out, sm.materialIndex);
+        WriteUInt32(out, sm.hasExplicitLocalOOBB);
+        WriteFloatArray(out, sm.explicitLocalOOBBMatrix, 16);
 
         uint32_t vtxCount = (uint32_t)sm.vertices.size();
         uint32_t idxCount = (uint32_t)sm.indices.size();
-        WriteUInt32(vtxCount);
-        WriteUInt32(idxCount);
+        WriteUInt32(out, vtxCount);
+        WriteUInt32(out, idxCount);
+
+        // Vertex ü ġ =  ġ ° 
+        // (position, normal, uv, tangent, boneIndices/boneWeights:   , ׻ 0)
+        static_assert(sizeof(Vertex) == sizeof(float) * 16 + sizeof(uint32_t) * 4, "Vertex must be tightly packed");
+        const void* vertexData = sm.vertices.data();
+        size_t vertexSize = sizeof(Vertex);
+
+        if (QUANTIZE_VERTICES)
+        {
+            // v6:  Ķ(float 10) + 32Ʈ 
+            MbinQuantizeParams params{};
+            QuantizeMbinVertices(sm.vertices, QUANTIZE_POSITION_HALF, quantized, params);
+            WriteRaw(out, &params, sizeof(params));
+
+            vertexData = quantized.data();
+            vertexSize = sizeof(MbinQuantizedVertex);
+        }
 
-        for (const Vertex& v : sm.vertices)
+        if (COMPRESS_STREAMS)
         {
-            WriteFloatArray(v.position, 3);
-            WriteFloatArray(v.normal, 3);
-            WriteFloatArray(v.uv, 2);
-            WriteFloatArray(v.tangent, 4);
-
-            //   (׻ 0)
-            WriteRaw(v.boneIndices, sizeof(uint32_t) * 4);
-            WriteFloatArray(v.boneWeights, 4);
+            EncodeMbinVertexStream(vertexData, vtxCount, vertexSize, encoded);
+            if (decodeBench) decodeBench->AddVertexStream(encoded, vertexData, vtxCount, vertexSize);
+            WriteUInt32(out, (uint32_t)encoded.size());
+            WriteRaw(out, encoded.data(), encoded.size());
+
+            EncodeMbinIndexStream(sm.indices.data(), idxCount, vtxCount, encoded);
+            if (decodeBench) decodeBench->AddIndexStream(encoded, sm.indices.data(), idxCount);
+            WriteUInt32(out, (uint32_t)encoded.size());
+            WriteRaw(out, encoded.data(), encoded.size());
         }
+        else
+        {
+            if (vtxCount > 0)
+                WriteRaw(out, vertexData, vertexSize * vtxCount);
 
-        if (idxCount > 0)
-            WriteRaw(sm.indices.data(), sizeof(uint32_t) * idxCount);
+            if (idxCount > 0)
+                WriteRaw(out, sm.indices.data(), sizeof(uint32_t) * idxCount);
+        }
     }
 }
 
-static bool SaveModelBin(
-    const std::string& filename,
-    const std::vector<Material>& materials,
-    const std::vector<SubMesh>& subMeshes)
-{
-    g_out.open(filename, ios::binary);
-    if (!g_out.is_open()) return false;
-
-    WriteModelHeader(materials, subMeshes);
-    WriteSkeletonSection_Empty();
-    WriteMaterialSection(materials);
-    WriteSubMeshSection(subMeshes);
-
-    g_out.close();
-    return true;
-}
+// ==========================================================
+// Draw range  (MERGE_SUBMESHES_BY_MATERIAL, ޽   ״)
+// - ޽ø uint32 rangeCount, range
+//   meshName, authoringPath, firstIndex, indexCount, firstVertex, vertexCount,
+//   hasExplicitLocalOOBB, OOBB float[16]
+// ==========================================================
 
-static std::string BuildLodBinFilePath(
-    const std::string& exportDir,
-    const std::string& stem,
-    int lodLevel)
+static void WriteDrawRangeSection(BinaryWriter& out, const std::vector<SubMesh>& subMeshes)
 {
-    return exportDir + "/" + stem + "_LOD" + std::to_string(lodLevel) + ".bin";
+    for (const auto& sm : subMeshes)
+    {
+        WriteUInt32(out, (uint32_t)sm.drawRanges.size());
+        for (const auto& r : sm.drawRanges)
+        {
+            WriteStringUtf8(out, r.meshName);
+            WriteStringUtf8(out, r.authoringPath);
+            WriteUInt32(out, r.firstIndex);
+            WriteUInt32(out, r.indexCount);
+            WriteUInt32(out, r.firstVertex);
+            WriteUInt32(out, r.vertexCount);
+            WriteUInt32(out, r.hasExplicitLocalOOBB);
+            WriteFloatArray(out, r.explicitLocalOOBBMatrix, 16);
+        }
+    }
 }
 
-static int ClampStaticLodLevel(int lodLevel)
-{
-    if (lodLevel < 0) return 0;
-    if (lodLevel >= kStaticLodCount) return (kStaticLodCount - 1);
-    return lodLevel;
-}
+// ==========================================================
+// νϽ  (DETECT_INSTANCES)
+// - uint32 instanceCount, νϽ
+//   meshName, authoringPath, firstSubMesh, subMeshCount, flags, transform float[16]
+// -  ȣ -> ޽  ϸ (  ޽  ٲ  Ƿ)
+// ==========================================================
 
-static float GetStaticLodTriangleRatio(const StaticLodBuildSettings& settings, int lodLevel)
+//  ޽ô    ְ LOD/յ  Ѵ
+static bool FindInstancePrototypeRange(
+    const std::vector<SubMesh>& subMeshes,
+    uint32_t prototype,
+    uint32_t& outFirst,
+    uint32_t& outCount)
 {
-    const int clampedLodLevel = ClampStaticLodLevel(lodLevel);
-    return settings.triangleRatio[clampedLodLevel];
+    outFirst = 0;
+    outCount = 0;
+    for (size_t i = 0; i < subMeshes.size(); ++i)
+    {
+        if (subMeshes[i].instancePrototype != prototype) continue;
+        if (outCount == 0) outFirst = (uint32_t)i;
+        ++outCount;
+    }
+    return outCount > 0;
 }
 
-static uint32_t FloatToBits(float v)
+static void WriteInstanceSection(
+    BinaryWriter& out,
+    const std::vector<SubMesh>& subMeshes,
+    const std::vector<StaticInstance>& instances)
 {
-    uint32_t bits = 0;
-    std::memcpy(&bits, &v, sizeof(uint32_t));
-    return bits;
+    WriteUInt32(out, (uint32_t)instances.size());
+    for (const auto& inst : instances)
+    {
+        uint32_t first = 0, count = 0;
+        FindInstancePrototypeRange(subMeshes, inst.prototype, first, count);
+
+        WriteStringUtf8(out, inst.meshName);
+        WriteStringUtf8(out, inst.authoringPath);
+        WriteUInt32(out, first);
+        WriteUInt32(out, count);
+        WriteUInt32(out, inst.flags);
+        WriteFloatArray(out, inst.transform, 16);
+    }
 }
 
-static void CopySubMeshMetaToWeldedSubMesh(const SubMesh& src, WeldedSubMesh& dst)
+//  ũ  (ڿ   ణ ˳ϰ)
+static size_t EstimateModelBinBytes(
+    const std::vector<Material>& materials,
+    const std::vector<SubMesh>& subMeshes,
+    const std::vector<StaticInstance>& instances)
 {
-    dst.meshName = src.meshName;
-    dst.authoringPath = src.authoringPath;
-    dst.materialIndex = src.materialIndex;
-    dst.hasExplicitLocalOOBB = src.hasExplicitLocalOOBB;
-
-    for (int i = 0; i < 16; ++i)
-        dst.explicitLocalOOBBMatrix[i] = src.explicitLocalOOBBMatrix[i];
+    size_t bytes = 64 + materials.size() * 512;
+    for (const auto& inst : instances)
+        bytes += 128 + inst.meshName.size() + inst.authoringPath.size();
+    for (const auto& sm : subMeshes)
+    {
+        bytes += 256 + sm.meshName.size() + sm.authoringPath.size();
+        bytes += sm.vertices.size() * sizeof(Vertex);
+        bytes += sm.indices.size() * sizeof(uint32_t);
+        for (const auto& r : sm.drawRanges)
+            bytes += 128 + r.meshName.size() + r.authoringPath.size();
+    }
+    return bytes;
 }
 
-static void CopyWeldedSubMeshMetaToSubMesh(const WeldedSubMesh& src, SubMesh& dst)
+// ==========================================================
+// v7  ġ (WRITE_SECTIONED_LAYOUT)
+// ==========================================================
+
+static BinaryWriter BuildSectionedModelBin(
+    const std::vector<Material>& materials,
+    const std::vector<SubMesh>& subMeshes,
+    const std::vector<MbinSubMeshMeshlets>* meshlets,
+    const std::vector<MbinSubMeshClusterLod>* clusterLods,
+    const std::vector<MbinSubMeshDepthStream>* depthStreams,
+    const std::vector<StaticInstance>& instances,
+    MbinStreamDecodeBenchmark* decodeBench)
 {
-    dst.meshName = src.meshName;
-    dst.authoringPath = src.authoringPath;
-    dst.materialIndex = src.materialIndex;
-    dst.hasExplicitLocalOOBB = src.hasExplicitLocalOOBB;
+    MbinSectionedBuilder builder;
 
-    for (int i = 0; i < 16; ++i)
-        dst.explicitLocalOOBBMatrix[i] = src.explicitLocalOOBBMatrix[i];
+    for (const auto& m : materials)
+        builder.AddMaterial(MakeMbinMaterialRecord(builder, m));
+
+    for (const auto& sm : subMeshes)
+    {
+        MbinSubMeshRecord record = MakeMbinSubMeshRecord();
+        record.name = builder.InternString(sm.meshName);
+        record.authoringPath = builder.InternString(sm.authoringPath);
+        record.materialIndex = sm.materialIndex;
+        record.hasExplicitLocalOOBB = sm.hasExplicitLocalOOBB;
+        std::memcpy(record.explicitLocalOOBBMatrix, sm.explicitLocalOOBBMatrix, sizeof(record.explicitLocalOOBBMatrix));
+
+        AddMbinSubMeshStreams(builder, record, sm.vertices, sm.indices,
+            QUANTIZE_VERTICES, QUANTIZE_POSITION_HALF, COMPRESS_STREAMS, WRITE_INDEX16, decodeBench);
+    }
+
+    if (MERGE_SUBMESHES_BY_MATERIAL)
+    {
+        std::vector<MbinDrawRangeRecord> ranges;
+        for (const auto& sm : subMeshes)
+        {
+            ranges.clear();
+            for (const auto& r : sm.drawRanges)
+            {
+                MbinDrawRangeRecord record{};
+                record.name = builder.InternString(r.meshName);
+                record.authoringPath = builder.InternString(r.authoringPath);
+                record.firstIndex = r.firstIndex;
+                record.indexCount = r.indexCount;
+                record.firstVertex = r.firstVertex;
+                record.vertexCount = r.vertexCount;
+                record.hasExplicitLocalOOBB = r.hasExplicitLocalOOBB;
+                std::memcpy(record.explicitLocalOOBBMatrix, r.explicitLocalOOBBMatrix, sizeof(record.explicitLocalOOBBMatrix));
+                ranges.push_back(record);
+            }
+            builder.AddSubMeshDrawRanges(ranges);
+        }
+    }
+
+    if (DETECT_INSTANCES)
+    {
+        for (const auto& inst : instances)
+        {
+            MbinInstanceRecord record{};
+            record.name = builder.InternString(inst.meshName);
+            record.authoringPath = builder.InternString(inst.authoringPath);
+            FindInstancePrototypeRange(subMeshes, inst.prototype, record.firstSubMesh, record.subMeshCount);
+            record.flags = inst.flags;
+            std::memcpy(record.transform, inst.transform, sizeof(record.transform));
+            builder.AddInstance(record);
+        }
+    }
+
+    if (meshlets)
+    {
+        for (const MbinSubMeshMeshlets& m : *meshlets)
+            builder.AddSubMeshMeshlets(m);
+    }
+
+    if (clusterLods)
+    {
+        for (const MbinSubMeshClusterLod& c : *clusterLods)
+            builder.AddSubMeshClusterLod(c);
+    }
+
+    if (depthStreams)
+    {
+        for (const MbinSubMeshDepthStream& d : *depthStreams)
+            builder.AddSubMeshDepthStream(d);
+    }
+
+    return builder.Build(MakeModelHeaderFlags());
+}
+
+// meshlets: BUILD_MESHLETS  subMeshes 1:1, ƴϸ nullptr
+// clusterLods: BUILD_CLUSTER_LOD  subMeshes 1:1, ƴϸ nullptr
+// depthStreams: BUILD_DEPTH_STREAMS  subMeshes 1:1, ƴϸ nullptr
+// instances: DETECT_INSTANCES ƴϸ  
+static BinaryWriter BuildModelBin(
+    const std::vector<Material>& materials,
+    const std::vector<SubMesh>& subMeshes,
+    const std::vector<MbinSubMeshMeshlets>* meshlets,
+    const std::vector<MbinSubMeshClusterLod>* clusterLods,
+    const std::vector<MbinSubMeshDepthStream>* depthStreams,
+    const std::vector<StaticInstance>& instances,
+    MbinStreamDecodeBenchmark* decodeBench)
+{
+    if (WRITE_SECTIONED_LAYOUT)
+        return BuildSectionedModelBin(materials, subMeshes, meshlets, clusterLods, depthStreams, instances, decodeBench);
+
+    BinaryWriter out;
+    out.Reserve(EstimateModelBinBytes(materials, subMeshes, instances) +
+        (meshlets ? EstimateMbinMeshletSectionBytes(*meshlets) : 0) +
+        (clusterLods ? EstimateMbinClusterLodSectionBytes(*clusterLods) : 0) +
+        (depthStreams ? EstimateMbinDepthStreamSectionBytes(*depthStreams) : 0));
+
+    WriteModelHeader(out, materials, subMeshes);
+    WriteSkeletonSection_Empty();
+    WriteMaterialSection(out, materials);
+    WriteSubMeshSection(out, subMeshes, decodeBench);
+    if (meshlets)
+        WriteMbinMeshletSection(out, *meshlets);
+    if (clusterLods)
+        WriteMbinClusterLodSection(out, *clusterLods);
+    if (MERGE_SUBMESHES_BY_MATERIAL)
+        WriteDrawRangeSection(out, subMeshes);
+    if (DETECT_INSTANCES)
+        WriteInstanceSection(out, subMeshes, instances);
+    if (depthStreams)
+        WriteMbinDepthStreamSection(out, *depthStreams);
+
+    return out;
+}
+
+static std::string BuildLodBinFilePath(
+    const std::string& exportDir,
+    const std::string& stem,
+    int lodLevel)
+{
+    return exportDir + "/" + stem + "_LOD" + std::to_string(lodLevel) + ".bin";
+}
+
+static int ClampStaticLodLevel(int lodLevel)
+{
+    if (lodLevel < 0) return 0;
+    if (lodLevel >= kStaticLodCount) return (kStaticLodCount - 1);
+    return lodLevel;
+}
+
+static float GetStaticLodTriangleRatio(const StaticLodBuildSettings& settings, int lodLevel)
+{
+    const int clampedLodLevel = ClampStaticLodLevel(lodLevel);
+    return settings.triangleRatio[clampedLodLevel];
+}
+
+static uint32_t FloatToBits(float v)
+{
+    uint32_t bits = 0;
+    std::memcpy(&bits, &v, sizeof(uint32_t));
+    return bits;
+}
+
+// SubMesh / WeldedSubMesh  Ÿ ʵ (/ε ) 
+// -  ü ʵ带 ߰ϸ ⿡ ߰ (/ܼȭ/  ̰ )
+template <class SrcT, class DstT>
+static void CopySubMeshMeta(const SrcT& src, DstT& dst)
+{
+    dst.meshName = src.meshName;
+    dst.authoringPath = src.authoringPath;
+    dst.materialIndex = src.materialIndex;
+    dst.instancePrototype = src.instancePrototype;
+    dst.hasExplicitLocalOOBB = src.hasExplicitLocalOOBB;
+
+    for (int i = 0; i < 16; ++i)
+        dst.explicitLocalOOBBMatrix[i] = src.explicitLocalOOBBMatrix[i];
 }
 
 static WeldedVertexKey MakeWeldedVertexKey(const Vertex& v)
@@ -1192,7 +1183,7 @@ static uint32_t FindOrAddWeldedVertex(
 static WeldedSubMesh BuildWeldedSubMeshFromSubMesh(const SubMesh& src)
 {
     WeldedSubMesh out{};
-    CopySubMeshMetaToWeldedSubMesh(src, out);
+    CopySubMeshMeta(src, out);
 
     out.vertices.reserve(src.vertices.size());
     out.indices.reserve(src.indices.empty() ? src.vertices.size() : src.indices.size());
@@ -1227,13 +1218,13 @@ static WeldedSubMesh BuildWeldedSubMeshFromSubMesh(const SubMesh& src)
     return out;
 }
 
-static SubMesh BuildSubMeshFromWeldedSubMesh(const WeldedSubMesh& src)
+static SubMesh BuildSubMeshFromWeldedSubMesh(WeldedSubMesh&& src)
 {
     SubMesh out{};
-    CopyWeldedSubMeshMetaToSubMesh(src, out);
+    CopySubMeshMeta(src, out);
 
-    out.vertices = src.vertices;
-    out.indices = src.indices;
+    out.vertices = std::move(src.vertices);
+    out.indices = std::move(src.indices);
 
     return out;
 }
@@ -1264,32 +1255,32 @@ static uint32_t ComputeTargetTriangleCount(
     return targetTriangleCount;
 }
 
-static WeldedSubMesh BuildMeshoptSimplifiedWeldedSubMesh(
+// ----------------------------------------------------------
+// src ܼȭؼ out ä.
+// - ܼȭ  (ǥ src ̻,   پ ) false.
+//   ̶ out ǵ帮 Ƿ ȣڰ src ״  ȴ. (ʿ 纻 )
+// ----------------------------------------------------------
+static bool BuildMeshoptSimplifiedWeldedSubMesh(
     const WeldedSubMesh& src,
     uint32_t targetTriangleCount,
     float targetError,
     float normalWeight,
     float uvWeight,
-    bool permissive)
+    bool permissive,
+    WeldedSubMesh& out,
+    float* outResultError)
 {
-    WeldedSubMesh out{};
-    out.meshName = src.meshName;
-    out.authoringPath = src.authoringPath;
-    out.materialIndex = src.materialIndex;
-    out.hasExplicitLocalOOBB = src.hasExplicitLocalOOBB;
-
-    for (int i = 0; i < 16; ++i)
-        out.explicitLocalOOBBMatrix[i] = src.explicitLocalOOBBMatrix[i];
+    if (outResultError) *outResultError = 0.0f;
 
     const size_t sourceIndexCount = src.indices.size();
     const size_t sourceVertexCount = src.vertices.size();
     const uint32_t sourceTriangleCount = static_cast<uint32_t>(sourceIndexCount / 3u);
 
     if (sourceTriangleCount == 0 || sourceVertexCount == 0)
-        return out;
+        return false;
 
     if (targetTriangleCount >= sourceTriangleCount)
-        return src;
+        return false;
 
     const size_t targetIndexCount = static_cast<size_t>(targetTriangleCount) * 3u;
 
@@ -1323,13 +1314,16 @@ static WeldedSubMesh BuildMeshoptSimplifiedWeldedSubMesh(
         &lodError);
 
     if (lodIndexCount < 3)
-        return src;
+        return false;
 
     if (lodIndexCount >= sourceIndexCount)
-        return src;
+        return false;
 
     lodIndices.resize(lodIndexCount);
 
+    out = WeldedSubMesh{};
+    CopySubMeshMeta(src, out);
+
     std::vector<uint32_t> remap(sourceVertexCount, 0xFFFFFFFFu);
     out.vertices.reserve(std::min(sourceVertexCount, lodIndexCount));
     out.indices.reserve(lodIndexCount);
@@ -1366,169 +1360,869 @@ static WeldedSubMesh BuildMeshoptSimplifiedWeldedSubMesh(
             sizeof(Vertex));
     }
 
-    return out;
+    if (outResultError) *outResultError = lodError;
+    return true;
 }
 
-static std::vector<SubMesh> BuildLodSubMeshesFromBase(
-    const std::vector<SubMesh>& baseSubMeshes,
+// ----------------------------------------------------------
+// SubMesh ϳ LOD ü
+// - weld   (LOD0 = welded)
+// - LOD n LOD n-1  ܼȭ (ĳ̵)
+//   ﰢ ǥ ׻ base(welded)  ,   ܰ迡  ŭ  
+// - ʹ ܰ ̿  ʰ move (ܼȭ   ܰ踸 纻)
+// - base(  ̹ εȭ) weld   -> ũ ޸ 
+// ----------------------------------------------------------
+static void BuildLodChainFromBase(
+    SubMesh&& baseSubMesh,
     const StaticLodBuildSettings& settings,
-    int lodLevel)
+    std::array<std::vector<SubMesh>, kStaticLodCount>& outLods,
+    size_t subMeshIndex)
 {
-    const int clampedLodLevel = ClampStaticLodLevel(lodLevel);
-    const float targetTriangleRatio = GetStaticLodTriangleRatio(settings, clampedLodLevel);
+    const uint32_t srcVertexCount =
+        static_cast<uint32_t>(baseSubMesh.vertices.size());
+    const uint32_t srcIndexCount =
+        static_cast<uint32_t>(baseSubMesh.indices.size());
+    const uint32_t srcTriangleCount = srcIndexCount / 3;
+
+    std::array<WeldedSubMesh, kStaticLodCount> chain;
+    chain[0] = BuildWeldedSubMeshFromSubMesh(baseSubMesh);
+
+    const std::string meshName = baseSubMesh.meshName;
+    std::vector<Vertex>().swap(baseSubMesh.vertices);
+    std::vector<uint32_t>().swap(baseSubMesh.indices);
+
+    const uint32_t weldedVertexCount =
+        static_cast<uint32_t>(chain[0].vertices.size());
+    const uint32_t weldedTriangleCount =
+        static_cast<uint32_t>(chain[0].indices.size()) / 3;
 
 #if DEBUGLOG
-    DLOG("[LOD BUILD] lodLevel="); DLOG(clampedLodLevel);
-    DLOG(" targetTriangleRatio="); DLOGLN(targetTriangleRatio);
+    DLOG("[LOD WELD] mesh=\""); DLOG(meshName); DLOG("\" ");
+    DLOG("srcVertices="); DLOG(srcVertexCount); DLOG(" ");
+    DLOG("weldedVertices="); DLOG(weldedVertexCount); DLOG(" ");
+    DLOG("srcTriangles="); DLOG(srcTriangleCount); DLOG(" ");
+    DLOG("weldedTriangles="); DLOGLN(weldedTriangleCount);
 #endif
 
-    std::vector<SubMesh> outSubMeshes;
-    outSubMeshes.reserve(baseSubMeshes.size());
-
-    for (const SubMesh& baseSubMesh : baseSubMeshes)
-    {
-        const WeldedSubMesh weldedSubMesh = BuildWeldedSubMeshFromSubMesh(baseSubMesh);
+    float accumulatedError = 0.0f;
 
-        const uint32_t srcVertexCount =
-            static_cast<uint32_t>(baseSubMesh.vertices.size());
-        const uint32_t srcIndexCount =
-            static_cast<uint32_t>(baseSubMesh.indices.size());
-        const uint32_t srcTriangleCount = srcIndexCount / 3;
+    // ܼȭ   ܰ 纻  ǥø ( ܰ   ܰ迡 )
+    std::array<bool, kStaticLodCount> sameAsPrevious = {};
+    int sourceLevel = 0;
 
-        const uint32_t weldedVertexCount =
-            static_cast<uint32_t>(weldedSubMesh.vertices.size());
-        const uint32_t weldedIndexCount =
-            static_cast<uint32_t>(weldedSubMesh.indices.size());
-        const uint32_t weldedTriangleCount = weldedIndexCount / 3;
+    for (int lodLevel = 1; lodLevel < kStaticLodFileCount; ++lodLevel)
+    {
+        // ̹ ܰ Է (ܼȭǸ Ʒ sourceLevel ̹ ܰ ٲ)
+        const int sourceLod = sourceLevel;
+        const WeldedSubMesh& source = chain[sourceLod];
 
         const uint32_t targetTriangleCount =
-            ComputeTargetTriangleCount(weldedTriangleCount, targetTriangleRatio);
-
-        const WeldedSubMesh simplifiedWeldedSubMesh =
-            (clampedLodLevel == 0)
-            ? weldedSubMesh
-            : BuildMeshoptSimplifiedWeldedSubMesh(
-                weldedSubMesh,
-                targetTriangleCount,
-                settings.targetError[clampedLodLevel],
-                settings.normalWeight[clampedLodLevel],
-                settings.uvWeight[clampedLodLevel],
-                settings.permissive[clampedLodLevel]);
-
-        SubMesh rebuiltSubMesh =
-            BuildSubMeshFromWeldedSubMesh(simplifiedWeldedSubMesh);
+            ComputeTargetTriangleCount(
+                weldedTriangleCount,
+                GetStaticLodTriangleRatio(settings, lodLevel));
+
+        const float remainingError =
+            std::max(0.0f, settings.targetError[lodLevel] - accumulatedError);
+
+        float lodError = 0.0f;
+        const bool simplified = BuildMeshoptSimplifiedWeldedSubMesh(
+            source,
+            targetTriangleCount,
+            remainingError,
+            settings.normalWeight[lodLevel],
+            settings.uvWeight[lodLevel],
+            settings.permissive[lodLevel],
+            chain[lodLevel],
+            &lodError);
+
+        if (simplified)
+        {
+            accumulatedError += lodError;
+            sourceLevel = lodLevel;
+        }
+        else
+        {
+            sameAsPrevious[lodLevel] = true;
+        }
+        const WeldedSubMesh& result = simplified ? chain[lodLevel] : source;
 
 #if DEBUGLOG
-        const uint32_t simplifiedVertexCount =
-            static_cast<uint32_t>(simplifiedWeldedSubMesh.vertices.size());
-        const uint32_t simplifiedIndexCount =
-            static_cast<uint32_t>(simplifiedWeldedSubMesh.indices.size());
-        const uint32_t simplifiedTriangleCount = simplifiedIndexCount / 3;
-
-        const uint32_t rebuiltVertexCount =
-            static_cast<uint32_t>(rebuiltSubMesh.vertices.size());
-        const uint32_t rebuiltIndexCount =
-            static_cast<uint32_t>(rebuiltSubMesh.indices.size());
-        const uint32_t rebuiltTriangleCount = rebuiltIndexCount / 3;
-
-        DLOG("[LOD WELD] mesh=\""); DLOG(baseSubMesh.meshName); DLOG("\" ");
-        DLOG("lodLevel="); DLOG(clampedLodLevel); DLOG(" ");
-        DLOG("srcVertices="); DLOG(srcVertexCount); DLOG(" ");
-        DLOG("weldedVertices="); DLOG(weldedVertexCount); DLOG(" ");
-        DLOG("srcTriangles="); DLOG(srcTriangleCount); DLOG(" ");
-        DLOG("weldedTriangles="); DLOGLN(weldedTriangleCount);
-
-        DLOG("[LOD SIMPLIFY] mesh=\""); DLOG(baseSubMesh.meshName); DLOG("\" ");
-        DLOG("lodLevel="); DLOG(clampedLodLevel); DLOG(" ");
+        DLOG("[LOD SIMPLIFY] mesh=\""); DLOG(meshName); DLOG("\" ");
+        DLOG("lodLevel="); DLOG(lodLevel); DLOG(" ");
+        DLOG("sourceLod="); DLOG(sourceLod); DLOG(" ");
+        DLOG("sourceTriangles="); DLOG(source.indices.size() / 3); DLOG(" ");
         DLOG("targetTriangles="); DLOG(targetTriangleCount); DLOG(" ");
-        DLOG("targetError="); DLOG(settings.targetError[clampedLodLevel]); DLOG(" ");
-        DLOG("normalWeight="); DLOG(settings.normalWeight[clampedLodLevel]); DLOG(" ");
-        DLOG("uvWeight="); DLOG(settings.uvWeight[clampedLodLevel]); DLOG(" ");
-        DLOG("permissive="); DLOG(settings.permissive[clampedLodLevel] ? 1 : 0); DLOG(" ");
-        DLOG("simplifiedVertices="); DLOG(simplifiedVertexCount); DLOG(" ");
-        DLOG("simplifiedTriangles="); DLOGLN(simplifiedTriangleCount);
-
-        DLOG("[LOD REBUILD] mesh=\""); DLOG(baseSubMesh.meshName); DLOG("\" ");
-        DLOG("lodLevel="); DLOG(clampedLodLevel); DLOG(" ");
-        DLOG("rebuiltVertices="); DLOG(rebuiltVertexCount); DLOG(" ");
-        DLOG("rebuiltTriangles="); DLOGLN(rebuiltTriangleCount);
+        DLOG("targetError="); DLOG(remainingError); DLOG(" ");
+        DLOG("normalWeight="); DLOG(settings.normalWeight[lodLevel]); DLOG(" ");
+        DLOG("uvWeight="); DLOG(settings.uvWeight[lodLevel]); DLOG(" ");
+        DLOG("permissive="); DLOG(settings.permissive[lodLevel] ? 1 : 0); DLOG(" ");
+        DLOG("simplified="); DLOG(simplified ? 1 : 0); DLOG(" ");
+        DLOG("resultError="); DLOG(lodError); DLOG(" ");
+        DLOG("accumulatedError="); DLOG(accumulatedError); DLOG(" ");
+        DLOG("simplifiedVertices="); DLOG(result.vertices.size()); DLOG(" ");
+        DLOG("simplifiedTriangles="); DLOGLN(result.indices.size() / 3);
 #endif
+    }
 
-        outSubMeshes.push_back(std::move(rebuiltSubMesh));
+    for (int lodLevel = 0; lodLevel < kStaticLodCount; ++lodLevel)
+    {
+        if (sameAsPrevious[lodLevel])
+        {
+            SubMesh& out = outLods[lodLevel][subMeshIndex];
+            CopySubMeshMeta(outLods[lodLevel - 1][subMeshIndex], out);
+            out.sameAsPreviousLod = true;
+            out.sameAsSubMesh = static_cast<uint32_t>(subMeshIndex);
+            continue;
+        }
+        outLods[lodLevel][subMeshIndex] = BuildSubMeshFromWeldedSubMesh(std::move(chain[lodLevel]));
     }
+}
 
-    return outSubMeshes;
+// sameAsPreviousLod   /ε ִ ޽
+static const SubMesh& ResolveLodSubMesh(
+    const std::array<std::vector<SubMesh>, kStaticLodCount>& lodSubMeshes,
+    int lod,
+    size_t subMeshIndex)
+{
+    const SubMesh* sm = &lodSubMeshes[lod][subMeshIndex];
+    while (sm->sameAsPreviousLod)
+    {
+        --lod;
+        sm = &lodSubMeshes[lod][sm->sameAsSubMesh];
+    }
+    return *sm;
+}
+
+// lod - 1     ( ó)  /ε lod ű
+static void TakeGeometryFromPreviousLod(
+    std::array<std::vector<SubMesh>, kStaticLodCount>& lodSubMeshes,
+    int lod)
+{
+    for (SubMesh& sm : lodSubMeshes[lod])
+    {
+        if (!sm.sameAsPreviousLod) continue;
+
+        SubMesh& prev = lodSubMeshes[lod - 1][sm.sameAsSubMesh];
+        sm.vertices = std::move(prev.vertices);
+        sm.indices = std::move(prev.indices);
+        sm.sameAsPreviousLod = false;
+    }
+}
+
+static void LogLodBuildHeader(const StaticLodBuildSettings& settings)
+{
+#if DEBUGLOG
+    for (int lodLevel = 0; lodLevel < kStaticLodFileCount; ++lodLevel)
+    {
+        DLOG("[LOD BUILD] lodLevel="); DLOG(lodLevel);
+        DLOG(" sourceLod="); DLOG(lodLevel > 0 ? lodLevel - 1 : 0);
+        DLOG(" targetTriangleRatio="); DLOGLN(GetStaticLodTriangleRatio(settings, lodLevel));
+    }
+#endif
+}
+
+// ----------------------------------------------------------
+// SubMesh LOD ü ϳ  ۾ .
+// - LOD ܰ賢 ĳ̵  Ƿ SubMesh θ 
+// -  [lod][subMesh] Կ ٷ  ->    /Ʈ
+// - baseSubMeshes Һȴ ( ۾ ڱ base weld  )
+// ----------------------------------------------------------
+static std::array<std::vector<SubMesh>, kStaticLodCount> BuildAllLodSubMeshesFromBase(
+    std::vector<SubMesh>&& baseSubMeshes,
+    const StaticLodBuildSettings& settings)
+{
+    std::array<std::vector<SubMesh>, kStaticLodCount> outLods;
+
+    const size_t subMeshCount = baseSubMeshes.size();
+    for (int lod = 0; lod < kStaticLodCount; ++lod)
+        outLods[lod].resize(subMeshCount);
+
+    LogLodBuildHeader(settings);
+
+    ParallelFor(subMeshCount, [&](size_t subMeshIndex)
+        {
+            BuildLodChainFromBase(
+                std::move(baseSubMeshes[subMeshIndex]),
+                settings,
+                outLods,
+                subMeshIndex);
+        });
+
+    baseSubMeshes.clear();
+    return outLods;
+}
+
+// ----------------------------------------------------------
+// LOD ޽ meshlet (BUILD_MESHLETS)
+// -  ε ( ĳ/ġ ȭ ) 
+// - [lod][subMesh] ۾ ϳ ,  Կ ٷ
+// ----------------------------------------------------------
+static void BuildAllLodMeshlets(
+    const std::array<std::vector<SubMesh>, kStaticLodCount>& lodSubMeshes,
+    std::array<std::vector<MbinSubMeshMeshlets>, kStaticLodCount>& outMeshlets)
+{
+    MbinMeshletSettings settings{};
+    settings.maxVertices = kMeshletMaxVertices;
+    settings.maxTriangles = kMeshletMaxTriangles;
+    settings.coneWeight = kMeshletConeWeight;
+    settings.encode = ENCODE_MESHLETS;
+
+    const size_t subMeshCount = lodSubMeshes[0].size();
+    for (int lod = 0; lod < kStaticLodCount; ++lod)
+        outMeshlets[lod].resize(subMeshCount);
+
+    ParallelFor(subMeshCount * kStaticLodFileCount, [&](size_t task)
+        {
+            const size_t lod = task / subMeshCount;
+            const size_t subMeshIndex = task % subMeshCount;
+            const SubMesh& sm = ResolveLodSubMesh(lodSubMeshes, (int)lod, subMeshIndex);
+            BuildMbinSubMeshMeshlets(sm.vertices, sm.indices, settings, outMeshlets[lod][subMeshIndex]);
+        });
+
+    for (int lod = 0; lod < kStaticLodFileCount; ++lod)
+    {
+        size_t meshletCount = 0, vertexRefs = 0, triangles = 0;
+        for (const MbinSubMeshMeshlets& m : outMeshlets[lod])
+        {
+            meshletCount += m.meshlets.size();
+            for (const MbinMeshletRecord& r : m.meshlets)
+            {
+                vertexRefs += r.vertexCount;
+                triangles += r.triangleCount;
+            }
+        }
+
+        if (meshletCount == 0) continue;
+
+        const double n = static_cast<double>(meshletCount);
+        BatchLog() << "Meshlet LOD" << lod << ": " << meshletCount << ""
+            << " (  " << (vertexRefs / n) << "/" << kMeshletMaxVertices
+            << ", ﰢ " << (triangles / n) << "/" << kMeshletMaxTriangles << ")"
+            << ", " << EstimateMbinMeshletSectionBytes(outMeshlets[lod]) << " bytes\n";
+    }
+}
+
+// ----------------------------------------------------------
+// ޽ Ŭ LOD DAG (BUILD_CLUSTER_LOD)
+// - LOD0(weld +  ĳ/ġ ȭ ) 
+// - ޽ ϳ ܰ賢  Ƿ ޽ θ 
+// ----------------------------------------------------------
+static void BuildAllClusterLods(
+    const std::vector<SubMesh>& baseSubMeshes,
+    std::vector<MbinSubMeshClusterLod>& outClusterLods)
+{
+    MbinClusterLodSettings settings{};
+    settings.maxVertices = kMeshletMaxVertices;
+    settings.maxTriangles = kMeshletMaxTriangles;
+    settings.groupSize = kClusterLodGroupSize;
+    settings.simplifyRatio = kClusterLodSimplifyRatio;
+    settings.normalWeight = kClusterLodNormalWeight;
+    settings.uvWeight = kClusterLodUvWeight;
+
+    outClusterLods.resize(baseSubMeshes.size());
+
+    ParallelFor(baseSubMeshes.size(), [&](size_t subMeshIndex)
+        {
+            const SubMesh& sm = baseSubMeshes[subMeshIndex];
+            BuildMbinSubMeshClusterLod(sm.vertices, sm.indices, settings, outClusterLods[subMeshIndex]);
+        });
+
+    size_t clusterCount = 0, rootCount = 0, rootTriangles = 0, sourceTriangles = 0;
+    uint32_t depthCount = 0;
+    for (size_t i = 0; i < outClusterLods.size(); ++i)
+    {
+        const MbinSubMeshClusterLod& c = outClusterLods[i];
+        clusterCount += c.clusters.size();
+        depthCount = std::max(depthCount, c.depthCount);
+        sourceTriangles += baseSubMeshes[i].indices.size() / 3;
+        for (const MbinClusterLodRecord& r : c.clusters)
+        {
+            if (r.parentError != FLT_MAX) continue;
+            ++rootCount;
+            rootTriangles += r.triangleCount;
+        }
+    }
+
+    if (clusterCount == 0) return;
+
+    BatchLog() << "Cluster LOD: Ŭ " << clusterCount << ", ִ  " << depthCount
+        << ", Ʈ " << rootCount << " (ﰢ " << rootTriangles << "/" << sourceTriangles << ")"
+        << ", " << EstimateMbinClusterLodSectionBytes(outClusterLods) << " bytes\n";
+}
+
+// ----------------------------------------------------------
+// LOD ġ  Ʈ + ׸ ε (BUILD_DEPTH_STREAMS)
+// -  ε  , ȭ     (  ġ)
+// ----------------------------------------------------------
+static void BuildAllLodDepthStreams(
+    const std::array<std::vector<SubMesh>, kStaticLodCount>& lodSubMeshes,
+    std::array<std::vector<MbinSubMeshDepthStream>, kStaticLodCount>& outDepthStreams)
+{
+    const size_t subMeshCount = lodSubMeshes[0].size();
+    for (int lod = 0; lod < kStaticLodCount; ++lod)
+        outDepthStreams[lod].resize(subMeshCount);
+
+    ParallelFor(subMeshCount * kStaticLodFileCount, [&](size_t task)
+        {
+            const size_t lod = task / subMeshCount;
+            const size_t subMeshIndex = task % subMeshCount;
+            const SubMesh& sm = ResolveLodSubMesh(lodSubMeshes, (int)lod, subMeshIndex);
+            BuildMbinSubMeshDepthStream(sm.vertices, sm.indices,
+                QUANTIZE_VERTICES, QUANTIZE_POSITION_HALF, outDepthStreams[lod][subMeshIndex]);
+        });
+
+    for (int lod = 0; lod < kStaticLodFileCount; ++lod)
+    {
+        size_t vertices = 0, shadowVertices = 0;
+        std::vector<uint8_t> used;
+        for (const MbinSubMeshDepthStream& d : outDepthStreams[lod])
+        {
+            // ׸ ε  ϴ   = Ÿ ģ   
+            used.assign(d.positionCount, 0);
+            for (uint32_t i : d.shadowIndices) used[i] = 1;
+            vertices += d.positionCount;
+            for (uint8_t u : used) shadowVertices += u;
+        }
+
+        if (vertices == 0) continue;
+
+        BatchLog() << "Depth stream LOD" << lod << ":  " << vertices << " -> ׸ " << shadowVertices
+            << ", " << EstimateMbinDepthStreamSectionBytes(outDepthStreams[lod]) << " bytes\n";
+    }
+}
+
+// ----------------------------------------------------------
+// Ƽ  (MERGE_SUBMESHES_BY_MATERIAL)
+// -  materialIndex ޽ /ε ̾ δ (ε    ̵)
+// -  materialIndex ,  Ƽ ȿ   ״ ( )
+// -  ޽ ϳ = draw range ϳ (̸//OOBB )
+// - 帶  ĳ/ġ ȭ  ۸ ״ Ƿ ȭ  
+// - νϽ (޽  )  ʰ   ڿ δ
+//   (sameAsPreviousLod ǥô ״, outNewIndex =  ȣ ->   ȣ)
+// - sameAsPreviousLod ޽ô Ʒ LOD ͸ ̾ δ (Ʒ LOD   ̾ )
+// ----------------------------------------------------------
+static std::vector<SubMesh> MergeSubMeshesByMaterial(
+    std::vector<SubMesh>&& subMeshes,
+    const std::vector<Material>& materials,
+    const std::array<std::vector<SubMesh>, kStaticLodCount>& lodSubMeshes,
+    int lod,
+    std::vector<uint32_t>& outNewIndex)
+{
+    outNewIndex.assign(subMeshes.size(), UINT32_MAX);
+
+    std::vector<size_t> order(subMeshes.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b)
+        {
+            return subMeshes[a].materialIndex < subMeshes[b].materialIndex;
+        });
+
+    std::vector<SubMesh> merged;
+    for (size_t i : order)
+    {
+        SubMesh& src = subMeshes[i];
+        if (src.instancePrototype != kNoInstancePrototype) continue;
+
+        const SubMesh& data = src.sameAsPreviousLod
+            ? ResolveLodSubMesh(lodSubMeshes, lod - 1, src.sameAsSubMesh)
+            : src;
+        if (data.indices.empty()) continue;
+
+        if (merged.empty() || merged.back().materialIndex != src.materialIndex)
+        {
+            SubMesh dst;
+            dst.materialIndex = src.materialIndex;
+            dst.meshName = (src.materialIndex < materials.size()) ? materials[src.materialIndex].name : std::string();
+            merged.push_back(std::move(dst));
+        }
+
+        SubMesh& dst = merged.back();
+
+        SubMeshDrawRange range;
+        range.meshName = src.meshName;
+        range.authoringPath = src.authoringPath;
+        range.firstIndex = (uint32_t)dst.indices.size();
+        range.indexCount = (uint32_t)data.indices.size();
+        range.firstVertex = (uint32_t)dst.vertices.size();
+        range.vertexCount = (uint32_t)data.vertices.size();
+        range.hasExplicitLocalOOBB = src.hasExplicitLocalOOBB;
+        std::memcpy(range.explicitLocalOOBBMatrix, src.explicitLocalOOBBMatrix, sizeof(range.explicitLocalOOBBMatrix));
+
+        dst.vertices.insert(dst.vertices.end(), data.vertices.begin(), data.vertices.end());
+        dst.indices.reserve(dst.indices.size() + data.indices.size());
+        for (uint32_t index : data.indices)
+            dst.indices.push_back(range.firstVertex + index);
+
+        dst.drawRanges.push_back(std::move(range));
+
+        std::vector<Vertex>().swap(src.vertices);
+        std::vector<uint32_t>().swap(src.indices);
+    }
+
+    for (size_t i = 0; i < subMeshes.size(); ++i)
+    {
+        if (subMeshes[i].instancePrototype == kNoInstancePrototype) continue;
+        outNewIndex[i] = (uint32_t)merged.size();
+        merged.push_back(std::move(subMeshes[i]));
+    }
+
+    subMeshes.clear();
+    return merged;
+}
+
+static void MergeAllLodSubMeshesByMaterial(
+    std::array<std::vector<SubMesh>, kStaticLodCount>& lodSubMeshes,
+    const std::vector<Material>& materials)
+{
+    //  LOD: sameAsPreviousLod Ű Ʒ LOD    ȣ д´
+    std::array<std::vector<uint32_t>, kStaticLodCount> newIndex;
+    std::array<size_t, kStaticLodCount> before = {};
+    for (int lod = kStaticLodFileCount - 1; lod >= 0; --lod)
+    {
+        before[lod] = lodSubMeshes[lod].size();
+        std::vector<SubMesh> merged =
+            MergeSubMeshesByMaterial(std::move(lodSubMeshes[lod]), materials, lodSubMeshes, lod, newIndex[lod]);
+        lodSubMeshes[lod] = std::move(merged);
+    }
+
+    //  ǥ(νϽ ) Ʒ LOD   ȣ
+    for (int lod = 1; lod < kStaticLodFileCount; ++lod)
+        for (SubMesh& sm : lodSubMeshes[lod])
+            if (sm.sameAsPreviousLod)
+                sm.sameAsSubMesh = newIndex[lod - 1][sm.sameAsSubMesh];
+
+    for (int lod = 0; lod < kStaticLodFileCount; ++lod)
+    {
+        BatchLog() << "Material merge LOD" << lod << ": ޽ " << before[lod]
+            << " -> " << lodSubMeshes[lod].size() << " (Ƽ)\n";
+    }
 }
 
 // ==========================================================
 // FBX -> RAM  (Ų )
 // ==========================================================
 
-static void ExtractFromFBX_StaticOnly(FbxScene* scene)
+//  Ƽ  ->  Ƽ ε (̸ ã,  0)
+static uint32_t ResolveGlobalMaterialIndex(FbxNode* node, int slot, const StaticExportContext& ctx)
+{
+    if (slot < node->GetMaterialCount())
+    {
+        FbxSurfaceMaterial* mat = node->GetMaterial(slot);
+        if (mat)
+        {
+            auto it = ctx.materialNameToIndex.find(mat->GetName());
+            if (it != ctx.materialNameToIndex.end())
+                return it->second;
+        }
+    }
+    return 0;
+}
+
+//  -> ũ  ( ۷ι +  + ǥ )
+static FbxAMatrix ComputeNodeBakeTransform(FbxNode* node)
 {
-    g_SubMeshes.clear();
-    g_Materials.clear();
-    g_MaterialNameToIndex.clear();
+    FbxAMatrix global = node->EvaluateGlobalTransform();
+    FbxAMatrix geo = GetGeometry(node);
+    FbxAMatrix xform = global * geo;
 
-    // 1) ǥ/ ȯ
-    FbxAxisSystem::DirectX.ConvertScene(scene);
-    FbxSystemUnit::m.ConvertScene(scene);
+    // ------------------------------------------------------
+    // [HACK] baked  ׻  (/, /, /)̶ ϰ 
+    // (x,y,z  -1 )
+    // ------------------------------------------------------
+    FbxAMatrix invFix;
+    invFix.SetIdentity();
+    invFix.SetS(FbxVector4(-1.0, -1.0, -1.0, 0.0));
+
+    // ǥ踦 °   ' ' 
+    xform = invFix * xform;
+
+    return xform;
+}
+
+// ----------------------------------------------------------
+//  ϳ -> Ƽ Ժ SubMesh (   )
+// - xform:  ->  
+//    ũ = ComputeNodeBakeTransform(node), νϽ  =   (޽  ״)
+// ----------------------------------------------------------
+static void ExtractNodeSubMeshes(
+    FbxScene* scene,
+    FbxNode* node,
+    FbxMesh* mesh,
+    const FbxAMatrix& xform,
+    const StaticExportContext& ctx,
+    std::vector<SubMesh>& outSubMeshes)
+{
+    const std::string authoredPath = GetNodeRelativeAuthoringPath(scene, node);
+
+    const int nodeMaterialCount = std::max(1, node->GetMaterialCount());
 
-    // 2) Triangulate
+    std::vector<SubMesh> splitSubMeshes(nodeMaterialCount);
+
+    std::vector<FbxVector4> splitLocalMin(nodeMaterialCount, FbxVector4(DBL_MAX, DBL_MAX, DBL_MAX, 0.0));
+    std::vector<FbxVector4> splitLocalMax(nodeMaterialCount, FbxVector4(-DBL_MAX, -DBL_MAX, -DBL_MAX, 0.0));
+    std::vector<bool> splitLocalBoundsValid(nodeMaterialCount, false);
+
+    for (int mi = 0; mi < nodeMaterialCount; ++mi)
     {
-        FbxGeometryConverter conv(scene->GetFbxManager());
-        conv.Triangulate(scene, true);
-    }
+        const uint32_t globalMaterialIndex = ResolveGlobalMaterialIndex(node, mi, ctx);
 
-    // 3) Material (ü  ȸ)
-    function<void(FbxNode*)> CollectMaterials = [&](FbxNode* node)
+        splitSubMeshes[mi].meshName = node->GetName();
+        splitSubMeshes[mi].authoringPath = authoredPath;
+        splitSubMeshes[mi].materialIndex = globalMaterialIndex;
+    
+        if (StartsWithCubePrefix(node->GetName()))
         {
-            if (!node) return;
+            DLOG("[CubeMaterialBind] node=\""); DLOG(node->GetName());
+            DLOG("\" slot="); DLOG(mi);
+            DLOG(" globalMaterialIndex="); DLOG(globalMaterialIndex);
 
-            const bool skipThisNode = ShouldSkipColliderHelperNode(node);
+            if (globalMaterialIndex < ctx.materials.size())
+            {
+                DLOG(" materialName=\""); DLOG(ctx.materials[globalMaterialIndex].name); DLOG("\"");
+            }
 
-            if (!skipThisNode)
+            DLOGLN("");
+        }
+    }
+
+    bool flip = (xform.Determinant() < 0.0);
+
+    // normal matrix
+    FbxAMatrix nMat = xform;
+    nMat.SetT(FbxVector4(0, 0, 0, 0));
+    nMat = nMat.Inverse().Transpose();
+
+    int cpCount = mesh->GetControlPointsCount();
+    FbxVector4* cp = mesh->GetControlPoints();
+
+    // UV set
+    FbxStringList uvSetNames;
+    mesh->GetUVSetNames(uvSetNames);
+    const char* uvSetName = (uvSetNames.GetCount() > 0) ? uvSetNames[0] : nullptr;
+    bool hasUVSet = (uvSetName != nullptr);
+
+    //   ߺ  (slot ε +   , ũ Ȯ)
+    std::vector<FbxDedupedSlot> dedupedSlots;
+    DedupPolygonVertices(node, mesh, nodeMaterialCount, uvSetName, dedupedSlots);
+
+    auto EvaluateVertex = [&](int p, int vi, int cpIdx) -> Vertex
+        {
+            Vertex v{};
+            if (cpIdx < 0 || cpIdx >= cpCount) return v;
+
+            // position bake
+            FbxVector4 posW = xform.MultT(cp[cpIdx]);
+            v.position[0] = (float)posW[0] * FINAL_SCALE_F;
+            v.position[1] = (float)posW[1] * FINAL_SCALE_F;
+            v.position[2] = (float)posW[2] * FINAL_SCALE_F;
+
+            // normal bake
+            FbxVector4 nL;
+            mesh->GetPolygonVertexNormal(p, vi, nL);
+            FbxVector4 nW = nMat.MultT(nL);
+            nW.Normalize();
+            v.normal[0] = (float)nW[0];
+            v.normal[1] = (float)nW[1];
+            v.normal[2] = (float)nW[2];
+
+            // UV
+            if (hasUVSet)
             {
-                int matCount = node->GetMaterialCount();
-                for (int i = 0; i < matCount; ++i)
+                FbxVector2 uv; bool unmapped = false;
+                if (mesh->GetPolygonVertexUV(p, vi, uvSetName, uv, unmapped))
                 {
-                    FbxSurfaceMaterial* mat = node->GetMaterial(i);
-                    if (!mat) continue;
+                    v.uv[0] = (float)uv[0];
+                    v.uv[1] = 1.0f - (float)uv[1];
+                }
+            }
+
+            return v;
+        };
 
-                    string matName = mat->GetName();
-                    if (g_MaterialNameToIndex.count(matName)) continue;
+    for (int mi = 0; mi < nodeMaterialCount; ++mi)
+    {
+        const FbxDedupedSlot& ds = dedupedSlots[mi];
+        if (ds.vertices.empty()) continue;
 
-                    Material m{};
-                    m.name = matName;
-                    ExtractMaterialAttributes(mat, m);
+        SubMesh& sm = splitSubMeshes[mi];
+        sm.vertices.resize(ds.vertices.size());
+        sm.indices.resize(ds.indices.size());
 
-#if DEBUGLOG
-                    DumpMaterialDebug(mat);
-#endif
+        for (const FbxPolygonVertexRef& ref : ds.vertices)
+        {
+            if (ref.controlPoint < 0) continue;
+            ExpandFbxMinMax(splitLocalMin[mi], splitLocalMax[mi], cp[ref.controlPoint]);
+            splitLocalBoundsValid[mi] = true;
+        }
 
-                    uint32_t idx = (uint32_t)g_Materials.size();
-                    g_Materials.push_back(m);
-                    g_MaterialNameToIndex[matName] = idx;
-                }
+        //   ó   ȣ پ ִ
+        // -> ȣ emitted ̸̻  ﰢ ó  
+        //    źƮ  ﰢ  (weld ù    Ͱ  )
+        uint32_t emitted = 0;
+
+        for (size_t t = 0; t < ds.triangles.size(); ++t)
+        {
+            const int p = ds.triangles[t];
+            const uint32_t* triIdx = &ds.indices[t * 3];
+
+            int order[3] = { 0,1,2 };
+            if (flip) std::swap(order[1], order[2]);
+
+            if (StartsWithCubePrefix(node->GetName()))
+            {
+                DLOG("[CubePolygonMaterial] node=\""); DLOG(node->GetName());
+                DLOG("\" polygon="); DLOG(p);
+                DLOG(" localMaterialSlot="); DLOGLN(mi);
             }
-#if DEBUGLOG
-            else
+
+            for (int k = 0; k < 3; ++k)
+                sm.indices[t * 3 + k] = triIdx[order[k]];
+
+            const uint32_t maxIdx = std::max(triIdx[0], std::max(triIdx[1], triIdx[2]));
+            if (maxIdx < emitted) continue; //    ̹ 
+
+            Vertex triV[3]{};
+            for (int k = 0; k < 3; ++k)
             {
-                DLOG("[SKIP MATERIAL NODE] ");
-                DLOGLN(node->GetName());
+                const int vi = order[k];
+                triV[k] = EvaluateVertex(p, vi, ds.vertices[triIdx[vi]].controlPoint);
             }
+
+            // tangent ( order ̹ flip ݿ)
+            ComputeTangentForTri(triV[0], triV[1], triV[2]);
+
+            for (int k = 0; k < 3; ++k)
+            {
+                const uint32_t idx = triIdx[order[k]];
+                if (idx >= emitted) sm.vertices[idx] = triV[k];
+            }
+
+            emitted = maxIdx + 1;
+        }
+    }
+
+    for (int mi = 0; mi < nodeMaterialCount; ++mi)
+    {
+        SubMesh& sm = splitSubMeshes[mi];
+        if (sm.vertices.empty()) continue;
+
+        if (splitLocalBoundsValid[mi])
+        {
+            FillExplicitLocalOOBBMatrix(
+                sm,
+                xform,
+                splitLocalMin[mi],
+                splitLocalMax[mi]
+            );
+        }
+
+#if DEBUGLOG
+        DLOG("[SubMesh] mesh=\""); DLOG(sm.meshName); DLOG("\" ");
+        DLOG("materialIndex="); DLOG(sm.materialIndex);
+
+        if (sm.materialIndex < ctx.materials.size())
+        {
+            const auto& mat = ctx.materials[sm.materialIndex];
+            DLOG(" ("); DLOG(mat.name); DLOG(")");
+            DLOG(" diffuse=\""); DLOG(mat.diffuseTextureName); DLOG("\"");
+            DLOG(" normal=\""); DLOG(mat.normalTextureName); DLOG("\"");
+        }
+        DLOGLN("");
 #endif
+        outSubMeshes.push_back(std::move(sm));
+    }
+}
+
+// ----------------------------------------------------------
+// νϽ ã (DETECT_INSTANCES)
+// 1)  FbxMesh +   Ƽ -> ٷ   ( )
+// 2) ó  ޽ô     ؽ -> ü 񱳷   ã
+//    (ؼ  ޽ó FbxMesh ޶ //UV/ε  )
+// 3) 尡 kMinInstanceCount ̻   ޽ + νϽ,
+//      η ٽ  ( ũ,  Ʈ )
+// - Ʈ ȯ νϽ ȯ  ( =  )
+// -  : ܵ  ޽( ) ->  ޽( ,  )
+// ----------------------------------------------------------
+static uint64_t HashSubMeshContent(const std::vector<SubMesh>& subMeshes)
+{
+    ExportHasher h;
+    h.AddU64(subMeshes.size());
+    for (const auto& sm : subMeshes)
+    {
+        h.AddU32(sm.materialIndex);
+        h.AddU64(sm.vertices.size());
+        h.Update(sm.vertices.data(), sm.vertices.size() * sizeof(Vertex));
+        h.AddU64(sm.indices.size());
+        h.Update(sm.indices.data(), sm.indices.size() * sizeof(uint32_t));
+    }
+    return h.Finish();
+}
+
+static bool IsSameSubMeshContent(const std::vector<SubMesh>& a, const std::vector<SubMesh>& b)
+{
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        if (a[i].materialIndex != b[i].materialIndex ||
+            a[i].vertices.size() != b[i].vertices.size() ||
+            a[i].indices != b[i].indices)
+            return false;
+        if (!a[i].vertices.empty() &&
+            std::memcmp(a[i].vertices.data(), b[i].vertices.data(), a[i].vertices.size() * sizeof(Vertex)) != 0)
+            return false;
+    }
+    return true;
+}
+
+static void FillInstanceTransform(FbxNode* node, StaticInstance& inst)
+{
+    const FbxAMatrix xform = ComputeNodeBakeTransform(node);
+
+    //    * FINAL_SCALE_F ̹Ƿ ̵  
+    for (int r = 0; r < 4; ++r)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            const double scale = (r == 3 && c < 3) ? FINAL_SCALE_F : 1.0;
+            inst.transform[r * 4 + c] = (float)(xform[r][c] * scale);
+        }
+    }
+
+    inst.flags = (xform.Determinant() < 0.0) ? MBIN_INSTANCE_MIRRORED : 0u;
+}
+
+static void ExtractStaticInstances(FbxScene* scene, const std::vector<FbxNode*>& staticNodes, StaticExportContext& ctx)
+{
+    struct PrototypeCandidate
+    {
+        std::vector<SubMesh> localSubMeshes;
+        std::vector<size_t> nodes; // staticNodes ε
+    };
+
+    std::vector<PrototypeCandidate> candidates;
+    std::map<std::pair<FbxMesh*, std::vector<uint32_t>>, size_t> sharedMeshToCandidate;
+    std::unordered_map<uint64_t, std::vector<size_t>> contentHashToCandidates;
+    std::vector<size_t> nodeCandidate(staticNodes.size());
+
+    FbxAMatrix identity;
+    identity.SetIdentity();
 
-            for (int i = 0; i < node->GetChildCount(); ++i)
-                CollectMaterials(node->GetChild(i));
+    for (size_t n = 0; n < staticNodes.size(); ++n)
+    {
+        FbxNode* node = staticNodes[n];
+        FbxMesh* mesh = node->GetMesh();
+
+        std::vector<uint32_t> slotMaterials(std::max(1, node->GetMaterialCount()));
+        for (int mi = 0; mi < (int)slotMaterials.size(); ++mi)
+            slotMaterials[mi] = ResolveGlobalMaterialIndex(node, mi, ctx);
+
+        auto sharedKey = std::make_pair(mesh, std::move(slotMaterials));
+        auto shared = sharedMeshToCandidate.find(sharedKey);
+        if (shared != sharedMeshToCandidate.end())
+        {
+            nodeCandidate[n] = shared->second;
+            candidates[shared->second].nodes.push_back(n);
+            continue;
+        }
+
+        std::vector<SubMesh> local;
+        ExtractNodeSubMeshes(scene, node, mesh, identity, ctx, local);
+
+        size_t found = candidates.size();
+        std::vector<size_t>& sameHash = contentHashToCandidates[HashSubMeshContent(local)];
+        for (size_t c : sameHash)
+        {
+            if (IsSameSubMeshContent(candidates[c].localSubMeshes, local))
+            {
+                found = c;
+                break;
+            }
+        }
+
+        if (found == candidates.size())
+        {
+            sameHash.push_back(found);
+            candidates.push_back({ std::move(local), {} });
+        }
+
+        sharedMeshToCandidate.emplace(std::move(sharedKey), found);
+        nodeCandidate[n] = found;
+        candidates[found].nodes.push_back(n);
+    }
+
+    auto IsInstanced = [](const PrototypeCandidate& c)
+        {
+            return c.nodes.size() >= kMinInstanceCount && !c.localSubMeshes.empty();
         };
 
-    CollectMaterials(scene->GetRootNode());
+    // ܵ :   ( ũ)
+    size_t uniqueNodes = 0;
+    for (size_t n = 0; n < staticNodes.size(); ++n)
+    {
+        if (IsInstanced(candidates[nodeCandidate[n]])) continue;
+        FbxNode* node = staticNodes[n];
+        ExtractNodeSubMeshes(scene, node, node->GetMesh(), ComputeNodeBakeTransform(node), ctx, ctx.subMeshes);
+        ++uniqueNodes;
+    }
+
+    //  + νϽ
+    uint32_t prototypeCount = 0;
+    for (PrototypeCandidate& c : candidates)
+    {
+        if (!IsInstanced(c)) continue;
+
+        const uint32_t prototype = prototypeCount++;
+        FbxNode* firstNode = staticNodes[c.nodes.front()];
+        const char* meshName = firstNode->GetMesh()->GetName();
+
+        for (SubMesh& sm : c.localSubMeshes)
+        {
+            sm.instancePrototype = prototype;
+            sm.meshName = (meshName && meshName[0]) ? meshName : firstNode->GetName();
+            sm.authoringPath.clear(); // δ νϽ
+            ctx.subMeshes.push_back(std::move(sm));
+        }
+
+        for (size_t n : c.nodes)
+        {
+            StaticInstance inst;
+            inst.meshName = staticNodes[n]->GetName();
+            inst.authoringPath = GetNodeRelativeAuthoringPath(scene, staticNodes[n]);
+            inst.prototype = prototype;
+            FillInstanceTransform(staticNodes[n], inst);
+            ctx.instances.push_back(std::move(inst));
+        }
+    }
+
+    BatchLog() << "Instancing: Ų  " << staticNodes.size() << " -> ܵ " << uniqueNodes
+        << " +  " << prototypeCount << " (νϽ " << ctx.instances.size() << ")\n";
+}
+
+static void ExtractFromFBX_StaticOnly(FbxScene* scene, StaticExportContext& ctx)
+{
+    ctx.subMeshes.clear();
+    ctx.instances.clear();
+    ctx.materials.clear();
+    ctx.materialNameToIndex.clear();
+
+    // 1~2) ǥ/ ȯ + Triangulate Ʈ Ŀ  
+
+    // 3) Material (ü  ȸ)
+    CollectSceneMaterials(scene->GetRootNode(), ctx.materials, ctx.materialNameToIndex, DEBUGLOG != 0,
+        [](FbxNode* node)
+        {
+            if (!ShouldSkipColliderHelperNode(node)) return false;
+#if DEBUGLOG
+            DLOG("[SKIP MATERIAL NODE] ");
+            DLOGLN(node->GetName());
+#endif
+            return true;
+        });
 #if DEBUGLOG
     DLOGLN("\n[Material List]");
-    for (size_t i = 0; i < g_Materials.size(); ++i)
+    for (size_t i = 0; i < ctx.materials.size(); ++i)
     {
-        const auto& m = g_Materials[i];
+        const auto& m = ctx.materials[i];
         DLOG("  ["); DLOG(i); DLOG("] ");
         DLOG("name=\""); DLOG(m.name); DLOG("\" ");
         DLOG("diffuse=\""); DLOG(m.diffuseTextureName); DLOG("\" ");
@@ -1572,228 +2266,235 @@ static void ExtractFromFBX_StaticOnly(FbxScene* scene)
         };
     dfs(scene->GetRootNode());
 
+    vector<FbxNode*> staticNodes;
     for (auto& mr : meshRefs)
     {
         if (!mr.node || !mr.mesh) continue;
         if (mr.hasSkin) continue; //  Ų ޽ : Ų 
         if (ShouldSkipColliderHelperNode(mr.node)) continue;
+        staticNodes.push_back(mr.node);
+    }
 
-        FbxNode* node = mr.node;
-        FbxMesh* mesh = mr.mesh;
+    if (DETECT_INSTANCES)
+    {
+        ExtractStaticInstances(scene, staticNodes, ctx);
+        return;
+    }
 
-        const std::string authoredPath = GetNodeRelativeAuthoringPath(scene, node);
+    // 5) Ų:  ۷ι +   ũ
+    for (FbxNode* node : staticNodes)
+        ExtractNodeSubMeshes(scene, node, node->GetMesh(), ComputeNodeBakeTransform(node), ctx, ctx.subMeshes);
+}
 
-        const int nodeMaterialCount = std::max(1, node->GetMaterialCount());
+// ==========================================================
+// LOD  /  ͽƮ ĳ Ű
+// - (BIN) ޶  ϸ kExportToolVersion ø 
+// -  ü : export/.exportcache_static 
+// ==========================================================
 
-        std::vector<SubMesh> splitSubMeshes(nodeMaterialCount);
-        std::vector<bool> splitSubMeshUsed(nodeMaterialCount, false);
+static constexpr uint32_t kExportToolVersion = 4;
 
-        std::vector<FbxVector4> splitLocalMin(nodeMaterialCount, FbxVector4(DBL_MAX, DBL_MAX, DBL_MAX, 0.0));
-        std::vector<FbxVector4> splitLocalMax(nodeMaterialCount, FbxVector4(-DBL_MAX, -DBL_MAX, -DBL_MAX, 0.0));
-        std::vector<bool> splitLocalBoundsValid(nodeMaterialCount, false);
+static StaticLodBuildSettings MakeStaticLodBuildSettings()
+{
+    StaticLodBuildSettings lodSettings{};
 
-        for (int mi = 0; mi < nodeMaterialCount; ++mi)
-        {
-            uint32_t globalMaterialIndex = 0;
+    lodSettings.triangleRatio[0] = 1.0f;
+    lodSettings.triangleRatio[1] = 0.5f;
+    lodSettings.triangleRatio[2] = 0.2f;
 
-            if (mi < node->GetMaterialCount())
-            {
-                FbxSurfaceMaterial* mat = node->GetMaterial(mi);
-                if (mat)
-                {
-                    auto it = g_MaterialNameToIndex.find(mat->GetName());
-                    if (it != g_MaterialNameToIndex.end())
-                        globalMaterialIndex = it->second;
-                }
-            }
+    lodSettings.targetError[0] = 0.0f;
+    lodSettings.targetError[1] = 5e-2f;
+    lodSettings.targetError[2] = 2e-1f;
 
-            splitSubMeshes[mi].meshName = node->GetName();
-            splitSubMeshes[mi].authoringPath = authoredPath;
-            splitSubMeshes[mi].materialIndex = globalMaterialIndex;
-        
-            if (StartsWithCubePrefix(node->GetName()))
-            {
-                DLOG("[CubeMaterialBind] node=\""); DLOG(node->GetName());
-                DLOG("\" slot="); DLOG(mi);
-                DLOG(" globalMaterialIndex="); DLOG(globalMaterialIndex);
+    lodSettings.normalWeight[0] = 0.0f;
+    lodSettings.normalWeight[1] = 0.5f;
+    lodSettings.normalWeight[2] = 0.25f;
 
-                if (globalMaterialIndex < g_Materials.size())
-                {
-                    DLOG(" materialName=\""); DLOG(g_Materials[globalMaterialIndex].name); DLOG("\"");
-                }
+    lodSettings.uvWeight[0] = 0.0f;
+    lodSettings.uvWeight[1] = 4.0f;
+    lodSettings.uvWeight[2] = 1.0f;
 
-                DLOGLN("");
-            }
-        }
+    lodSettings.permissive[0] = false;
+    lodSettings.permissive[1] = true;
+    lodSettings.permissive[2] = true;
 
-        // 5) Ų:  ۷ι +   ũ
-        FbxAMatrix global = node->EvaluateGlobalTransform();
-        FbxAMatrix geo = GetGeometry(node);
-        FbxAMatrix xform = global * geo;
+    return lodSettings;
+}
 
-        // ------------------------------------------------------
-        // [HACK] baked  ׻  (/, /, /)̶ ϰ 
-        // (x,y,z  -1 )
-        // ------------------------------------------------------
-        FbxAMatrix invFix;
-        invFix.SetIdentity();
-        invFix.SetS(FbxVector4(-1.0, -1.0, -1.0, 0.0));
+static uint64_t ComputeExportSettingsHash(const StaticLodBuildSettings& lodSettings)
+{
+    ExportHasher h;
+    h.AddString("StaticModelBinExtractor");
+    h.AddU32(kExportToolVersion);
+    h.AddFloat(FINAL_SCALE_F);
+    h.AddBool(QUANTIZE_VERTICES);
+    h.AddBool(QUANTIZE_POSITION_HALF);
+    h.AddBool(COMPRESS_STREAMS);
+    h.AddBool(WRITE_SECTIONED_LAYOUT);
+    h.AddBool(WRITE_INDEX16);
+    h.AddBool(BUILD_MESHLETS);
+    h.AddU32(kMeshletMaxVertices);
+    h.AddU32(kMeshletMaxTriangles);
+    h.AddFloat(kMeshletConeWeight);
+    h.AddBool(ENCODE_MESHLETS);
+    h.AddBool(BUILD_CLUSTER_LOD);
+    h.AddU32(kClusterLodGroupSize);
+    h.AddFloat(kClusterLodSimplifyRatio);
+    h.AddFloat(kClusterLodNormalWeight);
+    h.AddFloat(kClusterLodUvWeight);
+    h.AddBool(MERGE_SUBMESHES_BY_MATERIAL);
+    h.AddBool(DETECT_INSTANCES);
+    h.AddU32(kMinInstanceCount);
+    h.AddBool(BUILD_DEPTH_STREAMS);
+
+    for (int lod = 0; lod < kStaticLodCount; ++lod)
+    {
+        h.AddFloat(lodSettings.triangleRatio[lod]);
+        h.AddFloat(lodSettings.targetError[lod]);
+        h.AddFloat(lodSettings.normalWeight[lod]);
+        h.AddFloat(lodSettings.uvWeight[lod]);
+        h.AddBool(lodSettings.permissive[lod]);
+    }
 
-        // ǥ踦 °   ' ' 
-        xform = invFix * xform;
+    return h.Finish();
+}
 
+// ==========================================================
+//  ϳ ó (StaticModelBinExport.h)
+// ==========================================================
 
-        bool flip = (xform.Determinant() < 0.0);
+uint64_t ComputeExportSettingsHash()
+{
+    return ComputeExportSettingsHash(MakeStaticLodBuildSettings());
+}
 
-        // normal matrix
-        FbxAMatrix nMat = xform;
-        nMat.SetT(FbxVector4(0, 0, 0, 0));
-        nMat = nMat.Inverse().Transpose();
+bool ExportStaticModelScene(
+    FbxScene* scene,
+    const std::string& name,
+    const std::string& exportDir,
+    bool skipIfEmpty,
+    std::vector<std::string>& outOutputs)
+{
+    StaticExportContext ctx{};
+    ExtractFromFBX_StaticOnly(scene, ctx);
 
-        int polyCount = mesh->GetPolygonCount();
-        int cpCount = mesh->GetControlPointsCount();
-        FbxVector4* cp = mesh->GetControlPoints();
+    if (skipIfEmpty && ctx.subMeshes.empty())
+    {
+        BatchLog() << "Ų ޽ : ƽ BIN \n";
+        return true;
+    }
 
-        // UV set
-        FbxStringList uvSetNames;
-        mesh->GetUVSetNames(uvSetNames);
-        const char* uvSetName = (uvSetNames.GetCount() > 0) ? uvSetNames[0] : nullptr;
-        bool hasUVSet = (uvSetName != nullptr);
+    const StaticLodBuildSettings lodSettings = MakeStaticLodBuildSettings();
 
-        for (int mi = 0; mi < nodeMaterialCount; ++mi)
-        {
-            splitSubMeshes[mi].vertices.reserve(polyCount * 3);
-            splitSubMeshes[mi].indices.reserve(polyCount * 3);
-        }
+    std::array<std::vector<SubMesh>, kStaticLodCount> lodSubMeshes =
+        BuildAllLodSubMeshesFromBase(std::move(ctx.subMeshes), lodSettings);
 
-        for (int p = 0; p < polyCount; ++p)
-        {
-            int order[3] = { 0,1,2 };
-            int localMaterialSlot = GetPolygonMaterialSlot(node, mesh, p);
-            if (localMaterialSlot < 0 || localMaterialSlot >= nodeMaterialCount)
-                localMaterialSlot = 0;
+    // meshlet / Ŭ LOD յ   
+    if (MERGE_SUBMESHES_BY_MATERIAL)
+        MergeAllLodSubMeshesByMaterial(lodSubMeshes, ctx.materials);
 
-            if (StartsWithCubePrefix(node->GetName()))
-            {
-                DLOG("[CubePolygonMaterial] node=\""); DLOG(node->GetName());
-                DLOG("\" polygon="); DLOG(p);
-                DLOG(" localMaterialSlot="); DLOGLN(localMaterialSlot);
-            }
+    std::array<std::vector<MbinSubMeshMeshlets>, kStaticLodCount> lodMeshlets;
+    if (BUILD_MESHLETS)
+        BuildAllLodMeshlets(lodSubMeshes, lodMeshlets);
 
-            SubMesh& sm = splitSubMeshes[localMaterialSlot];
-            splitSubMeshUsed[localMaterialSlot] = true;
-            if (flip) std::swap(order[1], order[2]);
+    // Ŭ LOD LOD0 Ͽ (LOD1/LOD2   )
+    std::vector<MbinSubMeshClusterLod> clusterLods;
+    if (BUILD_CLUSTER_LOD)
+        BuildAllClusterLods(lodSubMeshes[0], clusterLods);
 
-            Vertex triV[3]{};
-            FbxVector4 triLocalPos[3];
+    std::array<std::vector<MbinSubMeshDepthStream>, kStaticLodCount> lodDepthStreams;
+    if (BUILD_DEPTH_STREAMS)
+        BuildAllLodDepthStreams(lodSubMeshes, lodDepthStreams);
 
-            for (int k = 0; k < 3; ++k)
-            {
-                int vi = order[k];
-                int cpIdx = mesh->GetPolygonVertex(p, vi);
-                if (cpIdx < 0 || cpIdx >= cpCount) { triV[k] = Vertex{}; continue; }
-
-                Vertex v{};
-                for (int i = 0; i < 4; ++i) { v.boneIndices[i] = 0; v.boneWeights[i] = 0.0f; }
-
-                // position bake
-                FbxVector4 posL = cp[cpIdx];
-                triLocalPos[k] = posL;
-                FbxVector4 posW = xform.MultT(posL);
-                v.position[0] = (float)posW[0] * FINAL_SCALE_F;
-                v.position[1] = (float)posW[1] * FINAL_SCALE_F;
-                v.position[2] = (float)posW[2] * FINAL_SCALE_F;
-
-                // normal bake
-                FbxVector4 nL;
-                mesh->GetPolygonVertexNormal(p, vi, nL);
-                FbxVector4 nW = nMat.MultT(nL);
-                nW.Normalize();
-                v.normal[0] = (float)nW[0];
-                v.normal[1] = (float)nW[1];
-                v.normal[2] = (float)nW[2];
-
-                // UV
-                if (hasUVSet)
-                {
-                    FbxVector2 uv; bool unmapped = false;
-                    if (mesh->GetPolygonVertexUV(p, vi, uvSetName, uv, unmapped))
-                    {
-                        v.uv[0] = (float)uv[0];
-                        v.uv[1] = 1.0f - (float)uv[1];
-                    }
-                    else
-                    {
-                        v.uv[0] = v.uv[1] = 0.0f;
-                    }
-                }
-                else
-                {
-                    v.uv[0] = v.uv[1] = 0.0f;
-                }
+    MbinStreamDecodeBenchmark decodeBench;
+    MbinStreamDecodeBenchmark* const decodeBenchPtr =
+        (COMPRESS_STREAMS && BENCHMARK_STREAM_DECODE) ? &decodeBench : nullptr;
 
-                triV[k] = v;
-            }
+    // LOD ۸  I/O 忡 ѱ ( LOD ȭ ħ)   Ȯ
+    std::array<std::future<bool>, kStaticLodCount> pendingWrites;
+    for (int lod = 0; lod < kStaticLodFileCount; ++lod)
+    {
+        // ܼȭ   ޽ô ٷ Ʒ LOD ۸ ״ Ѱܹ޴´ (  ̹ ȭ)
+        if (lod > 0)
+            TakeGeometryFromPreviousLod(lodSubMeshes, lod);
+
+        pendingWrites[lod] = SubmitBinaryFile(
+            BuildLodBinFilePath(exportDir, name, lod),
+            BuildModelBin(
+                ctx.materials,
+                lodSubMeshes[lod],
+                BUILD_MESHLETS ? &lodMeshlets[lod] : nullptr,
+                BUILD_CLUSTER_LOD ? &clusterLods : nullptr,
+                BUILD_DEPTH_STREAMS ? &lodDepthStreams[lod] : nullptr,
+                ctx.instances,
+                decodeBenchPtr));
+    }
 
-            for (int k = 0; k < 3; ++k)
-            {
-                ExpandFbxMinMax(splitLocalMin[localMaterialSlot], splitLocalMax[localMaterialSlot], triLocalPos[k]);
-                splitLocalBoundsValid[localMaterialSlot] = true;
-            }
-            // tangent ( order ̹ flip ݿ)
-            ComputeTangentForTri(triV[0], triV[1], triV[2]);
+    if (COMPRESS_STREAMS && BENCHMARK_STREAM_DECODE)
+        decodeBench.Run(BatchLog());
 
-            // push
-            uint32_t base = (uint32_t)sm.vertices.size();
-            sm.vertices.push_back(triV[0]);
-            sm.vertices.push_back(triV[1]);
-            sm.vertices.push_back(triV[2]);
+    bool allSaved = true;
 
-            sm.indices.push_back(base + 0);
-            sm.indices.push_back(base + 1);
-            sm.indices.push_back(base + 2);
+    for (int lod = 0; lod < kStaticLodFileCount; ++lod)
+    {
+        const std::string lodBinFileName = BuildLodBinFilePath(exportDir, name, lod);
+
+        if (pendingWrites[lod].get())
+        {
+            BatchLog() << "BIN  Ϸ: " << lodBinFileName << "\n";
+            outOutputs.push_back(lodBinFileName);
+        }
+        else
+        {
+            BatchLog() << "BIN  : " << lodBinFileName << "\n";
+            allSaved = false;
         }
+    }
 
+    return allSaved;
+}
 
-        for (int mi = 0; mi < nodeMaterialCount; ++mi)
-        {
-            SubMesh& sm = splitSubMeshes[mi];
-            if (!splitSubMeshUsed[mi]) continue;
-            if (sm.vertices.empty()) continue;
+} // namespace StaticModelBin
 
-            if (splitLocalBoundsValid[mi])
-            {
-                FillExplicitLocalOOBBMatrix(
-                    sm,
-                    xform,
-                    splitLocalMin[mi],
-                    splitLocalMax[mi]
-                );
-            }
+//  (UnifiedBinExtractor)    Լ  
+#ifndef UNIFIED_BIN_EXTRACTOR
 
-#if DEBUGLOG
-            DLOG("[SubMesh] mesh=\""); DLOG(sm.meshName); DLOG("\" ");
-            DLOG("materialIndex="); DLOG(sm.materialIndex);
+// ==========================================================
+// FBX  ϳ ó (ġ ۾ )
+// ==========================================================
 
-            if (sm.materialIndex < g_Materials.size())
-            {
-                const auto& mat = g_Materials[sm.materialIndex];
-                DLOG(" ("); DLOG(mat.name); DLOG(")");
-                DLOG(" diffuse=\""); DLOG(mat.diffuseTextureName); DLOG("\"");
-                DLOG(" normal=\""); DLOG(mat.normalTextureName); DLOG("\"");
-            }
-            DLOGLN("");
-#endif
-            g_SubMeshes.push_back(std::move(sm));
-        }
+static bool ExportStaticModelFile(
+    FbxManager* manager,
+    const BatchExportJob& job,
+    const std::string& exportDir,
+    std::vector<std::string>& outOutputs)
+{
+    const std::string fbxFileName = job.fbxPath.string();
 
-    }
+    BatchLog() << "\n==========================================\n";
+    BatchLog() << "ó : " << fbxFileName << "\n";
+
+    FbxScene* scene = ImportFbxScene(manager, fbxFileName, "scene_" + job.stem);
+    if (!scene) return false;
+
+    ConvertSceneToExportSpace(scene);
+    TriangulateScene(scene);
+
+    const bool ok = StaticModelBin::ExportStaticModelScene(scene, job.stem, exportDir, false, outOutputs);
+
+    scene->Destroy();
+    return ok;
 }
 
 // ==========================================================
 // main
 // ==========================================================
 
+// ġ : Ŀ  0 = ھ , ޸  0 =  
+static constexpr unsigned kBatchWorkerCount = 0;
+static constexpr uint64_t kBatchMemoryBudgetBytes = 16ull << 30;
+static constexpr double kBatchPeakBytesPerFileByte = 24.0; // Ʈ + LOD 3ܰ 纻
+
 int main()
 {
     std::string importDir = "import";
@@ -1803,97 +2504,31 @@ int main()
     std::error_code ec;
     fs::create_directories(exportDir, ec);
 
-    FbxManager* manager = FbxManager::Create();
-    if (!manager)
-    {
-        cout << "FBX Manager  .\n";
-        return -1;
-    }
-
-    FbxIOSettings* ios = FbxIOSettings::Create(manager, IOSROOT);
-    manager->SetIOSettings(ios);
-
-    for (const auto& entry : fs::directory_iterator(importDir))
-    {
-        if (!entry.is_regular_file()) continue;
-
-        fs::path path = entry.path();
-        if (path.extension() != ".fbx") continue;
+    BatchExportSettings batchSettings{};
+    batchSettings.workerCount = kBatchWorkerCount;
+    batchSettings.memoryBudgetBytes = kBatchMemoryBudgetBytes;
+    batchSettings.peakBytesPerFileByte = kBatchPeakBytesPerFileByte;
 
-        std::string name = path.stem().string();
-        std::string fbxFileName = path.string();
+    const std::vector<BatchExportJob> jobs = CollectBatchExportJobs(importDir, batchSettings);
 
-        std::string lod0BinFileName = BuildLodBinFilePath(exportDir, name, 0);
-        std::string lod1BinFileName = BuildLodBinFilePath(exportDir, name, 1);
-        std::string lod2BinFileName = BuildLodBinFilePath(exportDir, name, 2);
+    ExportCache cache(exportDir + "/.exportcache_static", StaticModelBin::ComputeExportSettingsHash());
+    cache.Load();
 
-        cout << "\n==========================================\n";
-        cout << "ó : " << fbxFileName << "\n";
-
-        FbxImporter* importer = FbxImporter::Create(manager, "");
-        bool ok = importer->Initialize(fbxFileName.c_str(), -1, manager->GetIOSettings());
-        if (!ok)
+    const BatchExportSummary summary = RunBatchExport(jobs, batchSettings,
+        [&](FbxManager* manager, const BatchExportJob& job)
         {
-            cout << "FBX   : " << fbxFileName << "\n";
-            importer->Destroy();
-            continue;
-        }
-
-        FbxScene* scene = FbxScene::Create(manager, ("scene_" + name).c_str());
-        importer->Import(scene);
-        importer->Destroy();
-
-        ExtractFromFBX_StaticOnly(scene);
-
-        const std::vector<SubMesh> baseSubMeshes = g_SubMeshes;
-
-        StaticLodBuildSettings lodSettings{};
-
-        lodSettings.triangleRatio[0] = 1.0f;
-        lodSettings.triangleRatio[1] = 0.5f;
-        lodSettings.triangleRatio[2] = 0.2f;
-
-        lodSettings.targetError[0] = 0.0f;
-        lodSettings.targetError[1] = 5e-2f;
-        lodSettings.targetError[2] = 2e-1f;
-
-        lodSettings.normalWeight[0] = 0.0f;
-        lodSettings.normalWeight[1] = 0.5f;
-        lodSettings.normalWeight[2] = 0.25f;
-
-        lodSettings.uvWeight[0] = 0.0f;
-        lodSettings.uvWeight[1] = 4.0f;
-        lodSettings.uvWeight[2] = 1.0f;
-
-        lodSettings.permissive[0] = false;
-        lodSettings.permissive[1] = true;
-        lodSettings.permissive[2] = true;
-
-        const std::vector<SubMesh> lod0SubMeshes =
-            BuildLodSubMeshesFromBase(baseSubMeshes, lodSettings, 0);
-        const std::vector<SubMesh> lod1SubMeshes =
-            BuildLodSubMeshesFromBase(baseSubMeshes, lodSettings, 1);
-        const std::vector<SubMesh> lod2SubMeshes =
-            BuildLodSubMeshesFromBase(baseSubMeshes, lodSettings, 2);
-
-        if (SaveModelBin(lod0BinFileName, g_Materials, lod0SubMeshes))
-            cout << "BIN  Ϸ: " << lod0BinFileName << "\n";
-        else
-            cout << "BIN  : " << lod0BinFileName << "\n";
-
-        if (SaveModelBin(lod1BinFileName, g_Materials, lod1SubMeshes))
-            cout << "BIN  Ϸ: " << lod1BinFileName << "\n";
-        else
-            cout << "BIN  : " << lod1BinFileName << "\n";
-
-        if (SaveModelBin(lod2BinFileName, g_Materials, lod2SubMeshes))
-            cout << "BIN  Ϸ: " << lod2BinFileName << "\n";
-        else
-            cout << "BIN  : " << lod2BinFileName << "\n";
-
-        scene->Destroy();
-    }
-
-    manager->Destroy();
-    return 0;
+            return RunCachedExportJob(cache, job,
+                [&](std::vector<std::string>& outputs)
+                {
+                    return ExportStaticModelFile(manager, job, exportDir, outputs);
+                });
+        });
+
+    PrintBatchExportSummary(summary, jobs.size());
+    cache.PrintSummary();
+    if (!cache.Save())
+        std::cout << "ĳ   \n";
+    return (summary.failed == 0) ? 0 : 1;
 }
+
+#endif // UNIFIED_BIN_EXTRACTOR
@@ -0,0 +1,140 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <filesystem>
+#include <system_error>
+
+#include <fbxsdk.h>
+#include "../../Common/BatchExport.h"
+#include "../../Common/ExportCache.h"
+#include "../../Common/FbxSceneImport.h"
+#include "../../StaticModelBinExtractor/ModelBinExtractor/StaticModelBinExport.h"
+#include "../../SkinnedModelBinExtractor/ModelBinExtractor/SkinnedModelBinExport.h"
+#include "../../AnimeBinExtractor/AnimeBinExtractor/AnimeBinExport.h"
+
+// ==========================================================
+//  
+// - FBX ϳ   Ʈ + ConvertScene + Triangulate ϰ
+//     ƽ LOD BIN / Ų BIN / ִϸ̼ ABIN  .
+// -  ڵ     Լ ״ .
+//   (  .cpp UNIFIED_BIN_EXTRACTOR Ƿ   ->  main )
+// -   ǳʶ: Ų ޽ð  ƽ BIN ,   ABIN  
+// -  ϸ ܵ      
+//   export/static/<stem>_LOD{n}.bin, export/skinned/<stem>.bin, export/anime/<stem>.bin
+// ==========================================================
+
+//  ͽƮ ĳ:   ó /  ٲ ø 
+// (  /  ؽ÷ Բ )
+static constexpr uint32_t kExportToolVersion = 1;
+
+static uint64_t ComputeExportSettingsHash()
+{
+    ExportHasher h;
+    h.AddString("UnifiedBinExtractor");
+    h.AddU32(kExportToolVersion);
+    h.AddU64(StaticModelBin::ComputeExportSettingsHash());
+    h.AddU64(SkinnedModelBin::ComputeExportSettingsHash());
+    h.AddU64(AnimeBin::ComputeExportSettingsHash());
+    return h.Finish();
+}
+
+struct UnifiedExportDirs
+{
+    std::string staticDir;
+    std::string skinnedDir;
+    std::string animeDir;
+};
+
+// ==========================================================
+// FBX  ϳ ó (ġ ۾ )
+// ==========================================================
+
+static bool ExportUnifiedFile(
+    FbxManager* manager,
+    const BatchExportJob& job,
+    const UnifiedExportDirs& dirs,
+    std::vector<std::string>& outOutputs)
+{
+    const std::string fbxFileName = job.fbxPath.string();
+
+    BatchLog() << "\n==========================================\n";
+    BatchLog() << "ó : " << fbxFileName << "\n";
+
+    FbxScene* scene = ImportFbxScene(manager, fbxFileName, "scene_" + job.stem);
+    if (!scene) return false;
+
+    ConvertSceneToExportSpace(scene);
+    TriangulateScene(scene);
+
+    bool ok = true;
+
+    // ִϸ̼  AnimStack ٲٹǷ ޽  ڿ д
+    BatchLog() << "\n[Static]\n";
+    ok = StaticModelBin::ExportStaticModelScene(scene, job.stem, dirs.staticDir, true, outOutputs) && ok;
+
+    BatchLog() << "\n[Skinned]\n";
+    ok = SkinnedModelBin::ExportSkinnedModelScene(scene, job.stem, dirs.skinnedDir, true, outOutputs) && ok;
+
+    BatchLog() << "\n[Anime]\n";
+    ok = AnimeBin::ExportAnimationScene(scene, job.stem, dirs.animeDir, true, outOutputs) && ok;
+
+    if (ok && outOutputs.empty())
+        BatchLog() << " ޽/ִϸ̼ ϴ: " << fbxFileName << "\n";
+
+    scene->Destroy();
+    return ok;
+}
+
+// ==========================================================
+// main
+// ==========================================================
+
+// ġ : Ŀ  0 = ھ , ޸  0 =  
+static constexpr unsigned kBatchWorkerCount = 0;
+static constexpr uint64_t kBatchMemoryBudgetBytes = 16ull << 30;
+static constexpr double kBatchPeakBytesPerFileByte = 24.0; // Ʈ + LOD 3ܰ 纻 (ƽ )
+
+int main()
+{
+    std::string importDir = "import";
+    std::string exportDir = "export";
+
+    UnifiedExportDirs dirs{};
+    dirs.staticDir = exportDir + "/static";
+    dirs.skinnedDir = exportDir + "/skinned";
+    dirs.animeDir = exportDir + "/anime";
+
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    fs::create_directories(dirs.staticDir, ec);
+    fs::create_directories(dirs.skinnedDir, ec);
+    fs::create_directories(dirs.animeDir, ec);
+
+    BatchExportSettings batchSettings{};
+    batchSettings.workerCount = kBatchWorkerCount;
+    batchSettings.memoryBudgetBytes = kBatchMemoryBudgetBytes;
+    batchSettings.peakBytesPerFileByte = kBatchPeakBytesPerFileByte;
+
+    const std::vector<BatchExportJob> jobs = CollectBatchExportJobs(importDir, batchSettings);
+
+    ExportCache cache(exportDir + "/.exportcache_unified", ComputeExportSettingsHash());
+    cache.Load();
+
+    const BatchExportSummary summary = RunBatchExport(jobs, batchSettings,
+        [&](FbxManager* manager, const BatchExportJob& job)
+        {
+            return RunCachedExportJob(cache, job,
+                [&](std::vector<std::string>& outputs)
+                {
+                    return ExportUnifiedFile(manager, job, dirs, outputs);
+                });
+        });
+
+    PrintBatchExportSummary(summary, jobs.size());
+    cache.PrintSummary();
+    if (!cache.Save())
+        std::cout << "ĳ   \n";
+
+    return (summary.failed == 0) ? 0 : 1;
+}